@@ -15,7 +15,12 @@
 
 //! The core `BacktestEngine` for backtesting on historical data.
 
-use std::ops::{Deref, DerefMut};
+use std::{
+    cmp::Reverse,
+    collections::BinaryHeap,
+    ffi::c_void,
+    ops::{Deref, DerefMut},
+};
 
 use nautilus_common::{
     clock::TestClock,
@@ -29,8 +34,17 @@ use nautilus_core::{
 };
 
 /// Provides a means of accumulating and draining time event handlers.
+///
+/// Each clock advanced into the accumulator appends a run of handlers already sorted by
+/// `ts_event`, so draining k-way merges the runs rather than sorting. All buffers are kept
+/// and reused across iterations.
 pub struct TimeEventAccumulator {
     event_handlers: Vec<TimeEventHandlerV2>,
+    run_ends: Vec<usize>,
+    cursors: Vec<usize>,
+    heap: BinaryHeap<Reverse<(UnixNanos, usize)>>,
+    order: Vec<usize>,
+    drained: Vec<TimeEventHandler>,
 }
 
 impl TimeEventAccumulator {
@@ -39,23 +53,97 @@ impl TimeEventAccumulator {
     pub const fn new() -> Self {
         Self {
             event_handlers: Vec::new(),
+            run_ends: Vec::new(),
+            cursors: Vec::new(),
+            heap: BinaryHeap::new(),
+            order: Vec::new(),
+            drained: Vec::new(),
         }
     }
 
     /// Advance the given clock to the `to_time_ns`.
+    ///
+    /// Any view previously returned by [`TimeEventAccumulator::drain_view`] is released first.
     pub fn advance_clock(&mut self, clock: &mut TestClock, to_time_ns: UnixNanos, set_time: bool) {
-        let events = clock.advance_time(to_time_ns, set_time);
-        let handlers = clock.match_handlers(events);
-        self.event_handlers.extend(handlers);
+        if !self.drained.is_empty() {
+            self.release();
+        }
+        clock.advance_time_into(to_time_ns, set_time, &mut self.event_handlers);
+        let end = self.event_handlers.len();
+        if end > self.run_ends.last().copied().unwrap_or(0) {
+            self.run_ends.push(end);
+        }
     }
 
     /// Drain the accumulated time event handlers in sorted order (by the events `ts_event`).
+    ///
+    /// Events with equal `ts_event` are ordered by the sequence their clocks were advanced in.
     pub fn drain(&mut self) -> Vec<TimeEventHandlerV2> {
-        // stable sort is not necessary since there is no relation between
-        // events of the same clock. Only time based ordering is needed.
-        self.event_handlers
-            .sort_unstable_by_key(|v| v.event.ts_event);
-        self.event_handlers.drain(..).collect()
+        self.merge();
+        let mut handlers: Vec<Option<TimeEventHandlerV2>> =
+            self.event_handlers.drain(..).map(Some).collect();
+        let drained = self
+            .order
+            .iter()
+            .map(|&i| handlers[i].take().expect("Handler should be drained once"))
+            .collect();
+        self.run_ends.clear();
+        drained
+    }
+
+    /// Drain the accumulated time event handlers in sorted order (by the events `ts_event`)
+    /// into a buffer owned by the accumulator, returning a view of it.
+    ///
+    /// The handlers (and their callbacks) are kept alive until [`TimeEventAccumulator::release`]
+    /// is called, and the buffer is reused across iterations.
+    pub fn drain_view(&mut self) -> &[TimeEventHandler] {
+        self.merge();
+        self.drained.clear();
+        self.drained.extend(
+            self.order
+                .iter()
+                .map(|&i| TimeEventHandler::from(&self.event_handlers[i])),
+        );
+        &self.drained
+    }
+
+    /// Releases the handlers of the last [`TimeEventAccumulator::drain_view`], keeping the
+    /// allocated buffers for reuse.
+    pub fn release(&mut self) {
+        self.drained.clear();
+        self.event_handlers.clear();
+        self.run_ends.clear();
+    }
+
+    /// Fills `order` with the indices of the handlers k-way merged by `ts_event`.
+    fn merge(&mut self) {
+        self.order.clear();
+        if self.run_ends.len() <= 1 {
+            self.order.extend(0..self.event_handlers.len());
+            return;
+        }
+
+        self.cursors.clear();
+        self.heap.clear();
+        let mut start = 0;
+        for (run, &end) in self.run_ends.iter().enumerate() {
+            self.cursors.push(start);
+            self.heap
+                .push(Reverse((self.event_handlers[start].event.ts_event, run)));
+            start = end;
+        }
+
+        while let Some(Reverse((_, run))) = self.heap.pop() {
+            let cursor = self.cursors[run];
+            self.order.push(cursor);
+
+            let next = cursor + 1;
+            self.cursors[run] = next;
+            if next < self.run_ends[run] {
+                self.heap
+                    .push(Reverse((self.event_handlers[next].event.ts_event, run)));
+            }
+        }
     }
 }
 
@@ -112,12 +200,39 @@ pub extern "C" fn time_event_accumulator_drain(accumulator: &mut TimeEventAccumu
     handlers.into()
 }
 
+/// Drains the accumulated time event handlers in sorted order into a buffer owned (and
+/// reused) by the accumulator, returning a borrowed view of it.
+///
+/// The view is valid until `time_event_accumulator_release` is called or a clock is next
+/// advanced into the accumulator. Its `cap` is zero as it does not own the buffer, so it must
+/// not be passed to `vec_time_event_handlers_drop`.
+#[no_mangle]
+pub extern "C" fn time_event_accumulator_drain_view(
+    accumulator: &mut TimeEventAccumulatorAPI,
+) -> CVec {
+    let handlers = accumulator.drain_view();
+    CVec {
+        ptr: handlers.as_ptr().cast_mut().cast::<c_void>(),
+        len: handlers.len(),
+        cap: 0,
+    }
+}
+
+/// Releases the handlers of the last drained view, keeping the buffers for reuse.
+#[no_mangle]
+pub extern "C" fn time_event_accumulator_release(accumulator: &mut TimeEventAccumulatorAPI) {
+    accumulator.release();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // Tests
 ////////////////////////////////////////////////////////////////////////////////
 #[cfg(test)]
 mod tests {
-    use nautilus_common::timer::{TimeEvent, TimeEventCallback};
+    use nautilus_common::{
+        clock::Clock,
+        timer::{TimeEvent, TimeEventCallback},
+    };
     use nautilus_core::uuid::UUID4;
     use pyo3::{prelude::*, types::PyList, Py, Python};
     use rstest::*;
@@ -163,9 +278,11 @@ mod tests {
             let handler2 = TimeEventHandlerV2::new(time_event2.clone(), callback.clone());
             let handler3 = TimeEventHandlerV2::new(time_event3.clone(), callback);
 
-            accumulator.event_handlers.push(handler1);
-            accumulator.event_handlers.push(handler2);
-            accumulator.event_handlers.push(handler3);
+            // Each handler forms its own sorted run, as if from separate clocks
+            for handler in [handler1, handler2, handler3] {
+                accumulator.event_handlers.push(handler);
+                accumulator.run_ends.push(accumulator.event_handlers.len());
+            }
 
             let drained_handlers = accumulator.drain();
 
@@ -175,4 +292,81 @@ mod tests {
             assert_eq!(drained_handlers[2].event.ts_event, time_event2.ts_event);
         });
     }
+
+    fn python_callback(py: Python<'_>) -> TimeEventCallback {
+        let py_list = PyList::empty_bound(py);
+        let py_append = Py::from(py_list.getattr("append").unwrap());
+        TimeEventCallback::from(py_append.into_py(py))
+    }
+
+    #[rstest]
+    fn test_accumulator_merges_clocks_in_time_order() {
+        pyo3::prepare_freethreaded_python();
+
+        Python::with_gil(|py| {
+            let mut clock1 = TestClock::new();
+            let mut clock2 = TestClock::new();
+            clock1.register_default_handler(python_callback(py));
+            clock2.register_default_handler(python_callback(py));
+            clock1.set_timer_ns("a", 200, UnixNanos::default(), None, None);
+            clock2.set_timer_ns("b", 300, UnixNanos::default(), None, None);
+
+            let mut accumulator = TimeEventAccumulator::new();
+            accumulator.advance_clock(&mut clock1, 900.into(), true);
+            accumulator.advance_clock(&mut clock2, 900.into(), true);
+
+            let fired: Vec<(u64, &str)> = accumulator
+                .drain()
+                .iter()
+                .map(|h| (h.event.ts_event.as_u64(), h.event.name.as_str()))
+                .collect();
+            assert_eq!(
+                fired,
+                vec![
+                    (200, "a"),
+                    (300, "b"),
+                    (400, "a"),
+                    (600, "a"),
+                    (600, "b"),
+                    (800, "a"),
+                    (900, "b"),
+                ]
+            );
+        });
+    }
+
+    #[rstest]
+    fn test_accumulator_drain_view_reuses_buffers() {
+        pyo3::prepare_freethreaded_python();
+
+        Python::with_gil(|py| {
+            let mut clock1 = TestClock::new();
+            let mut clock2 = TestClock::new();
+            clock1.register_default_handler(python_callback(py));
+            clock2.register_default_handler(python_callback(py));
+            clock1.set_timer_ns("a", 100, UnixNanos::default(), None, None);
+            clock2.set_timer_ns("b", 150, UnixNanos::default(), None, None);
+
+            let mut accumulator = TimeEventAccumulator::new();
+            accumulator.advance_clock(&mut clock1, 300.into(), true);
+            accumulator.advance_clock(&mut clock2, 300.into(), true);
+
+            let view = accumulator.drain_view();
+            let times: Vec<u64> = view.iter().map(|h| h.event.ts_event.as_u64()).collect();
+            assert_eq!(times, vec![100, 150, 200, 300, 300]);
+            assert!(view.iter().all(|h| !h.callback_ptr.is_null()));
+            let buffer_ptr = view.as_ptr();
+
+            accumulator.release();
+            assert!(accumulator.event_handlers.is_empty());
+
+            accumulator.advance_clock(&mut clock1, 500.into(), true);
+            accumulator.advance_clock(&mut clock2, 500.into(), true);
+
+            let view = accumulator.drain_view();
+            let times: Vec<u64> = view.iter().map(|h| h.event.ts_event.as_u64()).collect();
+            assert_eq!(times, vec![400, 450, 500]);
+            assert_eq!(view.as_ptr(), buffer_ptr);
+        });
+    }
 }
@@ -16,7 +16,8 @@
 //! Real-time and static test `Clock` implementations.
 
 use std::{
-    collections::{BTreeMap, HashMap},
+    cmp::Reverse,
+    collections::{BTreeMap, BinaryHeap, HashMap},
     ops::Deref,
 };
 
@@ -28,7 +29,7 @@ use nautilus_core::{
 };
 use ustr::Ustr;
 
-use crate::timer::{LiveTimer, TestTimer, TimeEvent, TimeEventCallback, TimeEventHandlerV2};
+use crate::timer::{LiveTimerHandle, TestTimer, TimeEvent, TimeEventCallback, TimeEventHandlerV2};
 
 /// Represents a type of clock.
 ///
@@ -97,9 +98,11 @@ pub trait Clock {
 /// Stores the current timestamp internally which can be advanced.
 pub struct TestClock {
     time: AtomicTime,
-    // use btree map to ensure stable ordering when scanning for timers
-    // in `advance_time`
     timers: BTreeMap<Ustr, TestTimer>,
+    // Min-heap of (next time, name) for each active timer, so `advance_time` only touches timers
+    // which fire. Entries are invalidated lazily: an entry is stale (and skipped) once its timer
+    // is removed, expired, or has a different next time.
+    queue: BinaryHeap<Reverse<(UnixNanos, Ustr)>>,
     default_callback: Option<TimeEventCallback>,
     callbacks: HashMap<Ustr, TimeEventCallback>,
 }
@@ -111,6 +114,7 @@ impl TestClock {
         Self {
             time: AtomicTime::new(false, UnixNanos::default()),
             timers: BTreeMap::new(),
+            queue: BinaryHeap::new(),
             default_callback: None,
             callbacks: HashMap::new(),
         }
@@ -130,7 +134,32 @@ impl TestClock {
     ///
     /// The method processes active timers, advancing them to `to_time_ns`, and collects any `TimeEvent`
     /// objects that are triggered as a result. Only timers that are not expired are processed.
+    ///
+    /// Events are returned in `ts_event` order (then by timer name), and only timers which fire
+    /// are visited.
     pub fn advance_time(&mut self, to_time_ns: UnixNanos, set_time: bool) -> Vec<TimeEvent> {
+        self.begin_advance(to_time_ns, set_time);
+        std::iter::from_fn(|| self.pop_event(to_time_ns)).collect()
+    }
+
+    /// Advances the internal clock as [`TestClock::advance_time`] does, appending a handler for
+    /// each triggered event to `handlers` rather than allocating new vectors.
+    ///
+    /// The appended handlers are in `ts_event` order (then by timer name).
+    pub fn advance_time_into(
+        &mut self,
+        to_time_ns: UnixNanos,
+        set_time: bool,
+        handlers: &mut Vec<TimeEventHandlerV2>,
+    ) {
+        self.begin_advance(to_time_ns, set_time);
+        while let Some(event) = self.pop_event(to_time_ns) {
+            let callback = self.callback_for(&event.name);
+            handlers.push(TimeEventHandlerV2::new(event, callback));
+        }
+    }
+
+    fn begin_advance(&mut self, to_time_ns: UnixNanos, set_time: bool) {
         // Time should be non-decreasing
         assert!(
             to_time_ns >= self.time.get_time_ns(),
@@ -142,16 +171,54 @@ impl TestClock {
         if set_time {
             self.time.set_time(to_time_ns);
         }
+    }
 
-        let mut timers: Vec<TimeEvent> = self
-            .timers
-            .iter_mut()
-            .filter(|(_, timer)| !timer.is_expired())
-            .flat_map(|(_, timer)| timer.advance(to_time_ns))
-            .collect();
+    /// Pops the next event at or before `to_time_ns`, rescheduling its timer if still active.
+    fn pop_event(&mut self, to_time_ns: UnixNanos) -> Option<TimeEvent> {
+        while let Some(&Reverse((next_time_ns, name))) = self.queue.peek() {
+            if next_time_ns > to_time_ns {
+                break;
+            }
+            self.queue.pop();
+
+            let Some(timer) = self.timers.get_mut(&name) else {
+                continue; // Stale entry for a removed timer
+            };
+            if timer.is_expired() || timer.next_time_ns() != next_time_ns {
+                continue; // Stale entry for a cancelled or replaced timer
+            }
 
-        timers.sort_by(|a, b| a.ts_event.cmp(&b.ts_event));
-        timers
+            let event = timer.next().map(|(event, _)| event);
+            if !timer.is_expired() {
+                self.queue.push(Reverse((timer.next_time_ns(), name)));
+            }
+            if event.is_some() {
+                return event;
+            }
+        }
+        None
+    }
+
+    /// Returns the earliest next time of all active timers, or `None` if there are none.
+    ///
+    /// This allows a backtest loop to jump directly to the next timer boundary.
+    pub fn next_event_time_ns(&mut self) -> Option<UnixNanos> {
+        while let Some(&Reverse((next_time_ns, name))) = self.queue.peek() {
+            match self.timers.get(&name) {
+                Some(timer) if !timer.is_expired() && timer.next_time_ns() == next_time_ns => {
+                    return Some(next_time_ns);
+                }
+                _ => {
+                    self.queue.pop(); // Discard stale entry
+                }
+            }
+        }
+        None
+    }
+
+    fn insert_timer(&mut self, name: Ustr, timer: TestTimer) {
+        self.queue.push(Reverse((timer.next_time_ns(), name)));
+        self.timers.insert(name, timer);
     }
 
     /// Matches `TimeEvent` objects with their corresponding event handlers.
@@ -164,17 +231,21 @@ impl TestClock {
         events
             .into_iter()
             .map(|event| {
-                let callback = self.callbacks.get(&event.name).cloned().unwrap_or_else(|| {
-                    // If callback_py is None, use the default_callback_py
-                    // TODO: clone for now
-                    self.default_callback
-                        .clone()
-                        .expect("Default callback should exist")
-                });
+                let callback = self.callback_for(&event.name);
                 TimeEventHandlerV2::new(event, callback)
             })
             .collect()
     }
+
+    fn callback_for(&self, name: &Ustr) -> TimeEventCallback {
+        self.callbacks.get(name).cloned().unwrap_or_else(|| {
+            // If callback_py is None, use the default_callback_py
+            // TODO: clone for now
+            self.default_callback
+                .clone()
+                .expect("Default callback should exist")
+        })
+    }
 }
 
 impl Default for TestClock {
@@ -254,7 +325,7 @@ impl Clock for TestClock {
             time_ns,
             Some(alert_time_ns),
         );
-        self.timers.insert(name_ustr, timer);
+        self.insert_timer(name_ustr, timer);
     }
 
     fn set_timer_ns(
@@ -280,7 +351,7 @@ impl Clock for TestClock {
         };
 
         let timer = TestTimer::new(name, interval_ns, start_time_ns, stop_time_ns);
-        self.timers.insert(name_ustr, timer);
+        self.insert_timer(name_ustr, timer);
     }
 
     fn next_time_ns(&self, name: &str) -> UnixNanos {
@@ -304,15 +375,19 @@ impl Clock for TestClock {
             timer.cancel();
         }
         self.timers = BTreeMap::new();
+        self.queue.clear();
     }
 }
 
 /// A real-time clock which uses system time.
 ///
 /// Timestamps are guaranteed to be unique and monotonically increasing.
+///
+/// Timers are scheduled on a hierarchical timing wheel shared by all live clocks and
+/// driven by a single dedicated thread (see [`LiveTimerHandle`]).
 pub struct LiveClock {
     time: &'static AtomicTime,
-    timers: HashMap<Ustr, LiveTimer>,
+    timers: HashMap<Ustr, LiveTimerHandle>,
     default_callback: Option<TimeEventCallback>,
 }
 
@@ -328,7 +403,7 @@ impl LiveClock {
     }
 
     #[must_use]
-    pub const fn get_timers(&self) -> &HashMap<Ustr, LiveTimer> {
+    pub const fn get_timers(&self) -> &HashMap<Ustr, LiveTimerHandle> {
         &self.timers
     }
 }
@@ -404,9 +479,8 @@ impl Clock for LiveClock {
         let ts_now = self.get_time_ns();
         alert_time_ns = std::cmp::max(alert_time_ns, ts_now);
         let interval_ns = (alert_time_ns - ts_now).into();
-        let mut timer = LiveTimer::new(name, interval_ns, ts_now, Some(alert_time_ns), callback);
-
-        timer.start();
+        let timer =
+            LiveTimerHandle::schedule(name, interval_ns, ts_now, Some(alert_time_ns), callback);
         self.timers.insert(Ustr::from(name), timer);
     }
 
@@ -431,8 +505,8 @@ impl Clock for LiveClock {
             None => self.default_callback.clone().unwrap(),
         };
 
-        let mut timer = LiveTimer::new(name, interval_ns, start_time_ns, stop_time_ns, callback);
-        timer.start();
+        let timer =
+            LiveTimerHandle::schedule(name, interval_ns, start_time_ns, stop_time_ns, callback);
         self.timers.insert(Ustr::from(name), timer);
     }
 
@@ -445,22 +519,14 @@ impl Clock for LiveClock {
     }
 
     fn cancel_timer(&mut self, name: &str) {
-        let timer = self.timers.remove(&Ustr::from(name));
-        match timer {
-            None => {}
-            Some(mut timer) => {
-                if let Err(e) = timer.cancel() {
-                    log::error!("Error on timer cancel: {e:?}");
-                }
-            }
+        if let Some(mut timer) = self.timers.remove(&Ustr::from(name)) {
+            timer.cancel();
         }
     }
 
     fn cancel_timers(&mut self) {
         for timer in &mut self.timers.values_mut() {
-            if let Err(e) = timer.cancel() {
-                log::error!("Error on timer cancel: {e:?}");
-            }
+            timer.cancel();
         }
         self.timers.clear();
     }
@@ -471,11 +537,18 @@ impl Clock for LiveClock {
 ////////////////////////////////////////////////////////////////////////////////
 #[cfg(test)]
 mod tests {
-    use std::{cell::RefCell, rc::Rc};
-
+    use std::{
+        cell::RefCell,
+        rc::Rc,
+        sync::{Arc, Mutex},
+        time::Duration,
+    };
+
+    use nautilus_core::datetime::NANOSECONDS_IN_MILLISECOND;
     use rstest::{fixture, rstest};
 
     use super::*;
+    use crate::testing::wait_until;
 
     #[derive(Default)]
     struct TestCallback {
@@ -591,4 +664,207 @@ mod tests {
         assert_eq!(events[1].name.as_str(), "timer1");
         assert_eq!(events[2].name.as_str(), "timer2");
     }
+
+    #[rstest]
+    fn test_next_event_time_ns(mut test_clock: TestClock) {
+        let start_time = test_clock.timestamp_ns();
+        assert_eq!(test_clock.next_event_time_ns(), None);
+
+        test_clock.set_timer_ns("timer1", 1000, start_time, None, None);
+        test_clock.set_time_alert_ns("alert1", (*start_time + 500).into(), None);
+        assert_eq!(
+            test_clock.next_event_time_ns(),
+            Some((*start_time + 500).into())
+        );
+
+        test_clock.advance_time((*start_time + 500).into(), true);
+        assert_eq!(
+            test_clock.next_event_time_ns(),
+            Some((*start_time + 1000).into())
+        );
+
+        test_clock.cancel_timer("timer1");
+        assert_eq!(test_clock.next_event_time_ns(), None);
+    }
+
+    #[rstest]
+    fn test_replaced_timer_fires_once(mut test_clock: TestClock) {
+        let start_time = test_clock.timestamp_ns();
+        test_clock.set_timer_ns("timer1", 1000, start_time, None, None);
+        test_clock.set_timer_ns("timer1", 1000, start_time, None, None);
+        test_clock.set_timer_ns("timer2", 3000, start_time, None, None);
+
+        let events = test_clock.advance_time((*start_time + 2000).into(), true);
+
+        assert_eq!(events.len(), 2);
+        assert!(events.iter().all(|e| e.name.as_str() == "timer1"));
+    }
+
+    #[rstest]
+    fn test_timer_with_stop_time_expires(mut test_clock: TestClock) {
+        let start_time = test_clock.timestamp_ns();
+        test_clock.set_timer_ns(
+            "timer1",
+            1000,
+            start_time,
+            Some((*start_time + 2000).into()),
+            None,
+        );
+
+        let events = test_clock.advance_time((*start_time + 5000).into(), true);
+
+        assert_eq!(events.len(), 2);
+        assert_eq!(test_clock.timer_count(), 0);
+        assert_eq!(test_clock.next_event_time_ns(), None);
+    }
+
+    #[rstest]
+    fn test_advance_time_into_appends_handlers(mut test_clock: TestClock) {
+        let start_time = test_clock.timestamp_ns();
+        test_clock.set_timer_ns("test_timer", 1000, start_time, None, None);
+        let mut handlers = Vec::new();
+
+        test_clock.advance_time_into((*start_time + 2500).into(), true, &mut handlers);
+        test_clock.advance_time_into((*start_time + 3000).into(), true, &mut handlers);
+
+        let times: Vec<u64> = handlers
+            .iter()
+            .map(|h| *h.event.ts_event - *start_time)
+            .collect();
+        assert_eq!(times, vec![1000, 2000, 3000]);
+        assert_eq!(*test_clock.timestamp_ns(), *start_time + 3000);
+    }
+
+    #[rstest]
+    fn test_events_ordered_across_timers(mut test_clock: TestClock) {
+        let start_time = test_clock.timestamp_ns();
+        test_clock.set_timer_ns("b", 300, start_time, None, None);
+        test_clock.set_timer_ns("a", 200, start_time, None, None);
+
+        let events = test_clock.advance_time((*start_time + 600).into(), true);
+        let fired: Vec<(u64, &str)> = events
+            .iter()
+            .map(|e| (*e.ts_event - *start_time, e.name.as_str()))
+            .collect();
+
+        assert_eq!(
+            fired,
+            vec![(200, "a"), (300, "b"), (400, "a"), (600, "a"), (600, "b")]
+        );
+    }
+
+    fn live_events_callback() -> (Arc<Mutex<Vec<TimeEvent>>>, TimeEventCallback) {
+        let events = Arc::new(Mutex::new(Vec::new()));
+        let sink = events.clone();
+        let callback = TimeEventCallback::RustSync(Arc::new(move |event: TimeEvent| {
+            sink.lock().unwrap().push(event);
+        }));
+        (events, callback)
+    }
+
+    #[rstest]
+    fn test_live_clock_time_alert_fires_once() {
+        let mut clock = LiveClock::new();
+        let (events, callback) = live_events_callback();
+        let alert_time = clock.timestamp_ns() + 20 * NANOSECONDS_IN_MILLISECOND;
+        clock.set_time_alert_ns("alert", alert_time, Some(callback));
+
+        wait_until(|| events.lock().unwrap().len() == 1, Duration::from_secs(2));
+        std::thread::sleep(Duration::from_millis(50));
+
+        let events = events.lock().unwrap();
+        assert_eq!(events.len(), 1);
+        assert_eq!(events[0].name.as_str(), "alert");
+        assert!(events[0].ts_init >= events[0].ts_event);
+        assert_eq!(clock.timer_count(), 0);
+    }
+
+    #[rstest]
+    fn test_live_clock_same_tick_alerts_dispatched_in_name_order() {
+        let mut clock = LiveClock::new();
+        let (events, callback) = live_events_callback();
+        clock.register_default_handler(callback);
+        let alert_time = clock.timestamp_ns() + 20 * NANOSECONDS_IN_MILLISECOND;
+        clock.set_time_alert_ns("b", alert_time, None);
+        clock.set_time_alert_ns("a", alert_time, None);
+
+        wait_until(|| events.lock().unwrap().len() == 2, Duration::from_secs(2));
+
+        let names: Vec<&str> = events
+            .lock()
+            .unwrap()
+            .iter()
+            .map(|e| e.name.as_str())
+            .collect();
+        assert_eq!(names, vec!["a", "b"]);
+    }
+
+    #[rstest]
+    fn test_live_clock_cancel_timer_prevents_events() {
+        let mut clock = LiveClock::new();
+        let (events, callback) = live_events_callback();
+        let alert_time = clock.timestamp_ns() + 100 * NANOSECONDS_IN_MILLISECOND;
+        clock.set_time_alert_ns("alert", alert_time, Some(callback));
+        assert_eq!(clock.timer_count(), 1);
+
+        clock.cancel_timer("alert");
+        std::thread::sleep(Duration::from_millis(200));
+
+        assert!(events.lock().unwrap().is_empty());
+        assert_eq!(clock.timer_count(), 0);
+    }
+
+    #[rstest]
+    fn test_live_clock_timer_with_stop_time_expires() {
+        let mut clock = LiveClock::new();
+        let (events, callback) = live_events_callback();
+        let interval_ns = 10 * NANOSECONDS_IN_MILLISECOND;
+        let start_time = clock.timestamp_ns();
+        let stop_time = start_time + 5 * interval_ns;
+        clock.set_timer_ns(
+            "timer",
+            interval_ns,
+            start_time,
+            Some(stop_time),
+            Some(callback),
+        );
+
+        let timer = clock.get_timers().get(&Ustr::from("timer")).unwrap();
+        wait_until(|| timer.is_expired(), Duration::from_secs(2));
+
+        let events = events.lock().unwrap();
+        assert!(!events.is_empty() && events.len() <= 5);
+        assert!(events
+            .windows(2)
+            .all(|w| *w[1].ts_event - *w[0].ts_event == interval_ns));
+    }
+
+    #[rstest]
+    fn test_live_clock_timer_started_in_past_catches_up_without_lag() {
+        let mut clock = LiveClock::new();
+        let (events, callback) = live_events_callback();
+        let interval_ns = 20 * NANOSECONDS_IN_MILLISECOND;
+        let start_time = clock.timestamp_ns() - 3 * interval_ns - interval_ns / 2;
+        clock.set_timer_ns("timer", interval_ns, start_time, None, Some(callback));
+
+        wait_until(|| events.lock().unwrap().len() >= 5, Duration::from_secs(2));
+        clock.cancel_timer("timer");
+
+        let events = events.lock().unwrap();
+        let first = events[0].ts_event;
+        for (i, event) in events.iter().enumerate() {
+            assert_eq!(event.ts_event, first + i as u64 * interval_ns);
+        }
+        // Events after the missed ones fire on time rather than offset by the initial lag
+        assert!(events[4].ts_init < events[4].ts_event + interval_ns);
+    }
+
+    #[rstest]
+    #[should_panic(expected = "Live timer does not support non thread-safe Rust callbacks")]
+    fn test_live_clock_rejects_non_thread_safe_rust_callback() {
+        let mut clock = LiveClock::new();
+        let callback = TimeEventCallback::Rust(Rc::new(|_event: TimeEvent| {}));
+        let alert_time = clock.timestamp_ns() + 100 * NANOSECONDS_IN_MILLISECOND;
+        clock.set_time_alert_ns("alert", alert_time, Some(callback));
+    }
 }
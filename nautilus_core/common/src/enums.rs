@@ -322,3 +322,11 @@ pub enum SerializationEncoding {
     #[serde(rename = "json")]
     Json = 1,
 }
+
+nautilus_core::impl_enum_str_table!(ComponentState);
+nautilus_core::impl_enum_str_table!(ComponentTrigger);
+nautilus_core::impl_enum_str_table!(
+    LogLevel,
+    [("WARN", LogLevel::Warning), ("WARNING", LogLevel::Warning)]
+);
+nautilus_core::impl_enum_str_table!(LogColor);
@@ -227,6 +227,12 @@ pub unsafe extern "C" fn test_clock_next_time(
     clock.next_time_ns(name)
 }
 
+/// Returns the earliest next time of all active timers, or 0 if there are none.
+#[no_mangle]
+pub extern "C" fn test_clock_next_event_time(clock: &mut TestClock_API) -> UnixNanos {
+    clock.next_event_time_ns().unwrap_or_default()
+}
+
 /// # Safety
 ///
 /// - Assumes `name_ptr` is a valid C string pointer.
@@ -13,15 +13,19 @@
 //  limitations under the License.
 // -------------------------------------------------------------------------------------------------
 
-use std::{ffi::c_char, str::FromStr};
+use std::ffi::c_char;
 
-use nautilus_core::ffi::string::{cstr_to_str, str_to_cstr};
+use nautilus_core::{
+    enum_table::EnumStrs,
+    ffi::parsing::{enum_codes_from_cstr_array, enum_from_cstr},
+};
 
 use crate::enums::{ComponentState, ComponentTrigger, LogColor, LogLevel};
 
+/// Returns the enum name as a C string pointer to static storage (must not be freed).
 #[no_mangle]
 pub extern "C" fn component_state_to_cstr(value: ComponentState) -> *const c_char {
-    str_to_cstr(&value.to_string())
+    value.as_static_cstr().as_ptr()
 }
 
 /// Returns an enum from a Python string.
@@ -31,14 +35,28 @@ pub extern "C" fn component_state_to_cstr(value: ComponentState) -> *const c_cha
 /// - Assumes `ptr` is a valid C string pointer.
 #[no_mangle]
 pub unsafe extern "C" fn component_state_from_cstr(ptr: *const c_char) -> ComponentState {
-    let value = cstr_to_str(ptr);
-    ComponentState::from_str(value)
-        .unwrap_or_else(|_| panic!("invalid `ComponentState` enum string value, was '{value}'"))
+    enum_from_cstr(ptr)
 }
 
+/// Parses the array of C strings `ptrs` of length `len` into `out` as [`ComponentState`] codes.
+///
+/// # Safety
+///
+/// - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+/// - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+#[no_mangle]
+pub unsafe extern "C" fn component_state_from_cstr_array(
+    ptrs: *const *const c_char,
+    len: usize,
+    out: *mut u8,
+) {
+    enum_codes_from_cstr_array::<ComponentState>(ptrs, len, out);
+}
+
+/// Returns the enum name as a C string pointer to static storage (must not be freed).
 #[no_mangle]
 pub extern "C" fn component_trigger_to_cstr(value: ComponentTrigger) -> *const c_char {
-    str_to_cstr(&value.to_string())
+    value.as_static_cstr().as_ptr()
 }
 
 /// Returns an enum from a Python string.
@@ -48,14 +66,28 @@ pub extern "C" fn component_trigger_to_cstr(value: ComponentTrigger) -> *const c
 /// - Assumes `ptr` is a valid C string pointer.
 #[no_mangle]
 pub unsafe extern "C" fn component_trigger_from_cstr(ptr: *const c_char) -> ComponentTrigger {
-    let value = cstr_to_str(ptr);
-    ComponentTrigger::from_str(value)
-        .unwrap_or_else(|_| panic!("invalid `ComponentTrigger` enum string value, was '{value}'"))
+    enum_from_cstr(ptr)
+}
+
+/// Parses the array of C strings `ptrs` of length `len` into `out` as [`ComponentTrigger`] codes.
+///
+/// # Safety
+///
+/// - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+/// - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+#[no_mangle]
+pub unsafe extern "C" fn component_trigger_from_cstr_array(
+    ptrs: *const *const c_char,
+    len: usize,
+    out: *mut u8,
+) {
+    enum_codes_from_cstr_array::<ComponentTrigger>(ptrs, len, out);
 }
 
+/// Returns the enum name as a C string pointer to static storage (must not be freed).
 #[no_mangle]
 pub extern "C" fn log_level_to_cstr(value: LogLevel) -> *const c_char {
-    str_to_cstr(&value.to_string())
+    value.as_static_cstr().as_ptr()
 }
 
 /// Returns an enum from a Python string.
@@ -65,14 +97,28 @@ pub extern "C" fn log_level_to_cstr(value: LogLevel) -> *const c_char {
 /// - Assumes `ptr` is a valid C string pointer.
 #[no_mangle]
 pub unsafe extern "C" fn log_level_from_cstr(ptr: *const c_char) -> LogLevel {
-    let value = cstr_to_str(ptr);
-    LogLevel::from_str(value)
-        .unwrap_or_else(|_| panic!("invalid `LogLevel` enum string value, was '{value}'"))
+    enum_from_cstr(ptr)
 }
 
+/// Parses the array of C strings `ptrs` of length `len` into `out` as [`LogLevel`] codes.
+///
+/// # Safety
+///
+/// - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+/// - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+#[no_mangle]
+pub unsafe extern "C" fn log_level_from_cstr_array(
+    ptrs: *const *const c_char,
+    len: usize,
+    out: *mut u8,
+) {
+    enum_codes_from_cstr_array::<LogLevel>(ptrs, len, out);
+}
+
+/// Returns the enum name as a C string pointer to static storage (must not be freed).
 #[no_mangle]
 pub extern "C" fn log_color_to_cstr(value: LogColor) -> *const c_char {
-    str_to_cstr(&value.to_string())
+    value.as_static_cstr().as_ptr()
 }
 
 /// Returns an enum from a Python string.
@@ -82,7 +128,20 @@ pub extern "C" fn log_color_to_cstr(value: LogColor) -> *const c_char {
 /// - Assumes `ptr` is a valid C string pointer.
 #[no_mangle]
 pub unsafe extern "C" fn log_color_from_cstr(ptr: *const c_char) -> LogColor {
-    let value = cstr_to_str(ptr);
-    LogColor::from_str(value)
-        .unwrap_or_else(|_| panic!("invalid `LogColor` enum string value, was '{value}'"))
+    enum_from_cstr(ptr)
+}
+
+/// Parses the array of C strings `ptrs` of length `len` into `out` as [`LogColor`] codes.
+///
+/// # Safety
+///
+/// - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+/// - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+#[no_mangle]
+pub unsafe extern "C" fn log_color_from_cstr_array(
+    ptrs: *const *const c_char,
+    len: usize,
+    out: *mut u8,
+) {
+    enum_codes_from_cstr_array::<LogColor>(ptrs, len, out);
 }
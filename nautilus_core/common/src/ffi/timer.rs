@@ -16,11 +16,13 @@
 use std::ffi::c_char;
 
 use nautilus_core::{
-    ffi::string::{cstr_to_ustr, str_to_cstr},
+    ffi::string::{cstr_to_str, cstr_to_ustr, str_to_cstr},
     uuid::UUID4,
 };
 
-use crate::timer::{TimeEvent, TimeEventCallback, TimeEventHandlerV2};
+use crate::timer::{
+    registered_timer_id, TimeEvent, TimeEventCallback, TimeEventHandlerV2, TIMER_ID_NONE,
+};
 
 #[repr(C)]
 #[derive(Clone, Debug)]
@@ -43,7 +45,22 @@ impl From<TimeEventHandlerV2> for TimeEventHandler {
             event: value.event,
             callback_ptr: match value.callback {
                 TimeEventCallback::Python(callback) => callback.as_ptr().cast::<c_char>(),
-                TimeEventCallback::Rust(_) => {
+                TimeEventCallback::Rust(_) | TimeEventCallback::RustSync(_) => {
+                    panic!("Legacy time event handler is not supported for Rust callback")
+                }
+            },
+        }
+    }
+}
+
+impl From<&TimeEventHandlerV2> for TimeEventHandler {
+    /// Borrows the callback of `value`, so the pointer is only valid while `value` is alive.
+    fn from(value: &TimeEventHandlerV2) -> Self {
+        Self {
+            event: value.event.clone(),
+            callback_ptr: match &value.callback {
+                TimeEventCallback::Python(callback) => callback.as_ptr().cast::<c_char>(),
+                TimeEventCallback::Rust(_) | TimeEventCallback::RustSync(_) => {
                     panic!("Legacy time event handler is not supported for Rust callback")
                 }
             },
@@ -69,6 +86,26 @@ pub unsafe extern "C" fn time_event_new(
     )
 }
 
+/// Returns the name of a [`TimeEvent`] as a C string pointer.
+///
+/// The pointer refers to the interned name, so is valid for the life of the process and must not
+/// be freed.
+#[no_mangle]
+pub extern "C" fn time_event_name(event: &TimeEvent) -> *const c_char {
+    event.name.as_char_ptr()
+}
+
+/// Returns the numeric timer ID assigned to the given name, or `TIMER_ID_NONE` if no
+/// recurring timer has been registered with it (see [`registered_timer_id`]).
+///
+/// # Safety
+///
+/// - Assumes `name_ptr` is borrowed from a valid Python UTF-8 `str`.
+#[no_mangle]
+pub unsafe extern "C" fn timer_id_from_cstr(name_ptr: *const c_char) -> u32 {
+    registered_timer_id(cstr_to_str(name_ptr)).unwrap_or(TIMER_ID_NONE)
+}
+
 /// Returns a [`TimeEvent`] as a C string pointer.
 #[no_mangle]
 pub extern "C" fn time_event_to_cstr(event: &TimeEvent) -> *const c_char {
@@ -42,6 +42,7 @@ pub mod runtime;
 pub mod testing;
 pub mod throttler;
 pub mod timer;
+pub mod timing_wheel;
 pub mod xrate;
 
 #[cfg(feature = "ffi")]
@@ -25,7 +25,10 @@ use ustr::Ustr;
 use super::timer::TimeEventHandler_Py;
 use crate::{
     clock::{Clock, LiveClock, TestClock},
-    timer::{LiveTimer, TestTimer, TimeEvent, TimeEventCallback, TimeEventHandlerV2},
+    timer::{
+        dispatch_time_event_handlers, LiveTimer, TestTimer, TimeEvent, TimeEventCallback,
+        TimeEventHandlerV2,
+    },
 };
 
 /// PyO3 compatible interface for an underlying [`TestClock`].
@@ -54,6 +57,23 @@ impl TestClock_Py {
         self.0.advance_time(to_time_ns.into(), set_time)
     }
 
+    /// Advances the clock and calls the handler for every time event triggered, in order,
+    /// returning the number of events dispatched.
+    ///
+    /// All callbacks are invoked under one GIL acquisition, without creating intermediate
+    /// `TimeEventHandler` objects.
+    fn advance_time_and_dispatch(slf: &Bound<'_, Self>, to_time_ns: u64, set_time: bool) -> usize {
+        // Release the borrow before dispatching, as callbacks may call back into the clock
+        let handlers = {
+            let mut clock = slf.borrow_mut();
+            let events = clock.0.advance_time(to_time_ns.into(), set_time);
+            clock.0.match_handlers(events)
+        };
+        let count = handlers.len();
+        dispatch_time_event_handlers(handlers);
+        count
+    }
+
     fn match_handlers(&self, events: Vec<TimeEvent>) -> Vec<TimeEventHandler_Py> {
         self.0
             .match_handlers(events)
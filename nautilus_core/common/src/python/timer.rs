@@ -23,7 +23,9 @@ use pyo3::{
 };
 use ustr::Ustr;
 
-use crate::timer::{RustTimeEventCallback, TimeEvent, TimeEventCallback, TimeEventHandlerV2};
+use crate::timer::{
+    RustTimeEventCallback, TimeEvent, TimeEventCallback, TimeEventHandlerV2, TIMER_ID_NONE,
+};
 
 #[pyo3::pyclass(
     module = "nautilus_trader.core.nautilus_pyo3.common",
@@ -49,7 +51,7 @@ impl From<TimeEventHandlerV2> for TimeEventHandler_Py {
             event: value.event,
             callback: match value.callback {
                 TimeEventCallback::Python(callback) => callback,
-                TimeEventCallback::Rust(_) => {
+                TimeEventCallback::Rust(_) | TimeEventCallback::RustSync(_) => {
                     panic!("Python time event handler is not supported for Rust callback")
                 }
             },
@@ -70,6 +72,7 @@ impl TimeEvent {
         let ts_init: u64 = tuple.3.extract()?;
 
         self.name = Ustr::from(tuple.0.extract()?);
+        self.timer_id = TIMER_ID_NONE;
         self.event_id = UUID4::from_str(tuple.1.extract()?).map_err(to_pyvalue_err)?;
         self.ts_event = ts_event.into();
         self.ts_init = ts_init.into();
@@ -125,6 +128,12 @@ impl TimeEvent {
         self.name.to_string()
     }
 
+    #[getter]
+    #[pyo3(name = "timer_id")]
+    fn py_timer_id(&self) -> Option<u32> {
+        (self.timer_id != TIMER_ID_NONE).then_some(self.timer_id)
+    }
+
     #[getter]
     #[pyo3(name = "event_id")]
     fn py_event_id(&self) -> UUID4 {
@@ -17,18 +17,19 @@
 
 use std::{
     cmp::Ordering,
+    collections::HashMap,
     fmt::{Debug, Display},
     num::NonZeroU64,
     rc::Rc,
     sync::{
         atomic::{self, AtomicBool, AtomicU64},
-        Arc,
+        Arc, Condvar, Mutex, OnceLock,
     },
 };
 
 use nautilus_core::{
     correctness::{check_valid_string, FAILED},
-    datetime::floor_to_nearest_microsecond,
+    datetime::{floor_to_nearest_microsecond, NANOSECONDS_IN_MILLISECOND},
     nanos::UnixNanos,
     time::get_atomic_clock_realtime,
     uuid::UUID4,
@@ -41,7 +42,10 @@ use tokio::{
 };
 use ustr::Ustr;
 
-use crate::runtime::get_runtime;
+use crate::{
+    runtime::get_runtime,
+    timing_wheel::{TimerKey, TimingWheel},
+};
 
 #[repr(C)]
 #[derive(Clone, Debug)]
@@ -56,6 +60,9 @@ use crate::runtime::get_runtime;
 pub struct TimeEvent {
     /// The event name, identifying the nature or purpose of the event.
     pub name: Ustr,
+    /// The numeric ID of the event name for recurring timers (see [`timer_id`]), otherwise
+    /// [`TIMER_ID_NONE`].
+    pub timer_id: u32,
     /// The unique identifier for the event.
     pub event_id: UUID4,
     /// UNIX timestamp (nanoseconds) when the event occurred.
@@ -65,15 +72,30 @@ pub struct TimeEvent {
 }
 
 impl TimeEvent {
-    /// Creates a new [`TimeEvent`] instance.
+    /// Creates a new [`TimeEvent`] instance with no timer ID ([`TIMER_ID_NONE`]).
+    ///
+    /// Timers instead use [`TimeEvent::with_timer_id`] with the ID cached at creation.
     ///
     /// # Safety
     ///
     /// - Assumes `name` is a valid string.
     #[must_use]
     pub const fn new(name: Ustr, event_id: UUID4, ts_event: UnixNanos, ts_init: UnixNanos) -> Self {
+        Self::with_timer_id(name, TIMER_ID_NONE, event_id, ts_event, ts_init)
+    }
+
+    /// Creates a new [`TimeEvent`] instance with a known `timer_id` for `name`.
+    #[must_use]
+    pub const fn with_timer_id(
+        name: Ustr,
+        timer_id: u32,
+        event_id: UUID4,
+        ts_event: UnixNanos,
+        ts_init: UnixNanos,
+    ) -> Self {
         Self {
             name,
+            timer_id,
             event_id,
             ts_event,
             ts_init,
@@ -81,6 +103,79 @@ impl TimeEvent {
     }
 }
 
+#[derive(Default)]
+struct TimerIdRegistry {
+    ids: HashMap<Ustr, u32>,
+    names: Vec<Ustr>,
+}
+
+static TIMER_IDS: OnceLock<Mutex<TimerIdRegistry>> = OnceLock::new();
+
+/// The timer ID of events which are not from a recurring timer, which is never assigned.
+pub const TIMER_ID_NONE: u32 = u32::MAX;
+
+/// Returns the numeric timer ID for `name`, assigning the next ID on first use.
+///
+/// IDs are dense (starting from zero) and stable for the life of the process, so handlers can
+/// dispatch on an integer (or index a table) rather than comparing names. IDs are never
+/// released, so are only assigned to recurring timers (see [`recurring_timer_id`]).
+///
+/// # Panics
+///
+/// This function panics:
+/// - If all `u32` IDs (other than [`TIMER_ID_NONE`]) have been assigned.
+pub fn timer_id(name: Ustr) -> u32 {
+    let mut registry = TIMER_IDS.get_or_init(Default::default).lock().unwrap();
+    if let Some(&id) = registry.ids.get(&name) {
+        return id;
+    }
+    let id = u32::try_from(registry.names.len())
+        .ok()
+        .filter(|id| *id != TIMER_ID_NONE)
+        .expect("Exceeded `u32::MAX` timer names");
+    registry.names.push(name);
+    registry.ids.insert(name, id);
+    id
+}
+
+/// Returns the timer ID already assigned to `name`, if any.
+///
+/// Never assigns an ID (nor interns `name`), so is safe to call with arbitrary names.
+#[must_use]
+pub fn registered_timer_id(name: &str) -> Option<u32> {
+    let name = Ustr::from_existing(name)?;
+    let registry = TIMER_IDS.get_or_init(Default::default).lock().unwrap();
+    registry.ids.get(&name).copied()
+}
+
+/// Returns the timer ID to cache for a timer with the given schedule.
+///
+/// Only timers which can fire more than once are assigned an ID from the registry. One-shot
+/// timers (such as time alerts, which are often named per order) get [`TIMER_ID_NONE`], so
+/// the registry stays bounded by the number of distinct recurring timer names.
+fn recurring_timer_id(
+    name: Ustr,
+    interval_ns: NonZeroU64,
+    start_time_ns: UnixNanos,
+    stop_time_ns: Option<UnixNanos>,
+) -> u32 {
+    let second_time_ns = start_time_ns
+        .as_u64()
+        .saturating_add(interval_ns.get().saturating_mul(2));
+    if stop_time_ns.is_some_and(|stop_time_ns| stop_time_ns.as_u64() < second_time_ns) {
+        TIMER_ID_NONE
+    } else {
+        timer_id(name)
+    }
+}
+
+/// Returns the timer name registered for `timer_id`, if any.
+#[must_use]
+pub fn timer_name(timer_id: u32) -> Option<Ustr> {
+    let registry = TIMER_IDS.get_or_init(Default::default).lock().unwrap();
+    registry.names.get(timer_id as usize).copied()
+}
+
 impl Display for TimeEvent {
     fn fmt(&self, f: &mut std::fmt::Formatter<'_>) -> std::fmt::Result {
         write!(
@@ -99,11 +194,15 @@ impl PartialEq for TimeEvent {
 
 pub type RustTimeEventCallback = dyn Fn(TimeEvent);
 
+pub type SyncTimeEventCallback = dyn Fn(TimeEvent) + Send + Sync;
+
 #[derive(Clone)]
 pub enum TimeEventCallback {
     #[cfg(feature = "python")]
     Python(PyObject),
     Rust(Rc<RustTimeEventCallback>),
+    /// A thread-safe Rust callback, which (unlike `Rust`) may be used with live timers.
+    RustSync(Arc<SyncTimeEventCallback>),
 }
 
 impl Debug for TimeEventCallback {
@@ -111,7 +210,7 @@ impl Debug for TimeEventCallback {
         match self {
             #[cfg(feature = "python")]
             Self::Python(_) => f.write_str("Python callback"),
-            Self::Rust(_) => f.write_str("Rust callback"),
+            Self::Rust(_) | Self::RustSync(_) => f.write_str("Rust callback"),
         }
     }
 }
@@ -126,16 +225,54 @@ impl TimeEventCallback {
                 });
             }
             Self::Rust(callback) => callback(event),
+            Self::RustSync(callback) => callback(event),
         }
     }
 }
 
+/// Calls the callback of each handler with its event, in order.
+///
+/// When the batch contains Python callbacks they are all invoked under a single GIL
+/// acquisition, rather than acquiring the GIL per event as [`TimeEventCallback::call`] does.
+pub fn dispatch_time_event_handlers(handlers: Vec<TimeEventHandlerV2>) {
+    #[cfg(feature = "python")]
+    if handlers
+        .iter()
+        .any(|handler| matches!(handler.callback, TimeEventCallback::Python(_)))
+    {
+        Python::with_gil(|py| {
+            for handler in handlers {
+                match handler.callback {
+                    TimeEventCallback::Python(callback) => {
+                        if let Err(e) = callback.call1(py, (handler.event,)) {
+                            tracing::error!("Error on callback: {e:?}");
+                        }
+                    }
+                    TimeEventCallback::Rust(callback) => callback(handler.event),
+                    TimeEventCallback::RustSync(callback) => callback(handler.event),
+                }
+            }
+        });
+        return;
+    }
+
+    for handler in handlers {
+        handler.callback.call(handler.event);
+    }
+}
+
 impl From<Rc<RustTimeEventCallback>> for TimeEventCallback {
     fn from(value: Rc<RustTimeEventCallback>) -> Self {
         Self::Rust(value)
     }
 }
 
+impl From<Arc<SyncTimeEventCallback>> for TimeEventCallback {
+    fn from(value: Arc<SyncTimeEventCallback>) -> Self {
+        Self::RustSync(value)
+    }
+}
+
 #[cfg(feature = "python")]
 impl From<PyObject> for TimeEventCallback {
     fn from(value: PyObject) -> Self {
@@ -202,6 +339,7 @@ pub struct TestTimer {
     pub start_time_ns: UnixNanos,
     /// The optional stop time of the timer in UNIX nanoseconds.
     pub stop_time_ns: Option<UnixNanos>,
+    timer_id: u32,
     next_time_ns: UnixNanos,
     is_expired: bool,
 }
@@ -224,16 +362,26 @@ impl TestTimer {
         // SAFETY: Guaranteed to be non-zero
         let interval_ns = NonZeroU64::new(std::cmp::max(interval_ns, 1)).unwrap();
 
+        let name = Ustr::from(name);
+
         Self {
-            name: Ustr::from(name),
+            name,
             interval_ns,
             start_time_ns,
             stop_time_ns,
+            timer_id: recurring_timer_id(name, interval_ns, start_time_ns, stop_time_ns),
             next_time_ns: start_time_ns + interval_ns.get(),
             is_expired: false,
         }
     }
 
+    /// Returns the numeric ID of the timer name if recurring (see [`timer_id`]), otherwise
+    /// [`TIMER_ID_NONE`].
+    #[must_use]
+    pub const fn timer_id(&self) -> u32 {
+        self.timer_id
+    }
+
     /// Returns the next time in UNIX nanoseconds when the timer will fire.
     #[must_use]
     pub const fn next_time_ns(&self) -> UnixNanos {
@@ -248,12 +396,13 @@ impl TestTimer {
 
     #[must_use]
     pub const fn pop_event(&self, event_id: UUID4, ts_init: UnixNanos) -> TimeEvent {
-        TimeEvent {
-            name: self.name,
+        TimeEvent::with_timer_id(
+            self.name,
+            self.timer_id,
             event_id,
-            ts_event: self.next_time_ns,
+            self.next_time_ns,
             ts_init,
-        }
+        )
     }
 
     /// Advance the test timer forward to the given time, generating a sequence
@@ -284,12 +433,13 @@ impl Iterator for TestTimer {
             None
         } else {
             let item = (
-                TimeEvent {
-                    name: self.name,
-                    event_id: UUID4::new(),
-                    ts_event: self.next_time_ns,
-                    ts_init: self.next_time_ns,
-                },
+                TimeEvent::with_timer_id(
+                    self.name,
+                    self.timer_id,
+                    UUID4::new(),
+                    self.next_time_ns,
+                    self.next_time_ns,
+                ),
                 self.next_time_ns,
             );
 
@@ -320,6 +470,7 @@ pub struct LiveTimer {
     pub start_time_ns: UnixNanos,
     /// The optional stop time of the timer in UNIX nanoseconds.
     pub stop_time_ns: Option<UnixNanos>,
+    timer_id: u32,
     next_time_ns: Arc<AtomicU64>,
     is_expired: Arc<AtomicBool>,
     callback: TimeEventCallback,
@@ -347,11 +498,14 @@ impl LiveTimer {
         let interval_ns = NonZeroU64::new(std::cmp::max(interval_ns, 1)).unwrap();
 
         log::debug!("Creating timer '{name}'");
+        let name = Ustr::from(name);
+
         Self {
-            name: Ustr::from(name),
+            name,
             interval_ns,
             start_time_ns,
             stop_time_ns,
+            timer_id: recurring_timer_id(name, interval_ns, start_time_ns, stop_time_ns),
             next_time_ns: Arc::new(AtomicU64::new(start_time_ns.as_u64() + interval_ns.get())),
             is_expired: Arc::new(AtomicBool::new(false)),
             callback,
@@ -381,6 +535,7 @@ impl LiveTimer {
     /// The generated events are handled by the provided callback function.
     pub fn start(&mut self) {
         let event_name = self.name;
+        let timer_id = self.timer_id;
         let stop_time_ns = self.stop_time_ns;
         let next_time_ns = self.next_time_ns.load(atomic::Ordering::SeqCst);
         let next_time_atomic = self.next_time_ns.clone();
@@ -392,7 +547,7 @@ impl LiveTimer {
         #[cfg(feature = "python")]
         let callback: PyObject = match self.callback.clone() {
             TimeEventCallback::Python(callback) => callback,
-            TimeEventCallback::Rust(_) => {
+            TimeEventCallback::Rust(_) | TimeEventCallback::RustSync(_) => {
                 panic!("Live timer does not support Rust callbacks right now")
             }
         };
@@ -427,7 +582,16 @@ impl LiveTimer {
                     _ = timer.tick() => {
                         let now_ns = clock.get_time_ns();
                         #[cfg(feature = "python")]
-                        call_python_with_time_event(event_name, next_time_ns, now_ns, &callback);
+                        call_python_with_time_event(
+                            TimeEvent::with_timer_id(
+                                event_name,
+                                timer_id,
+                                UUID4::new(),
+                                next_time_ns,
+                                now_ns,
+                            ),
+                            &callback,
+                        );
 
                         // Prepare next time interval
                         next_time_ns += interval_ns;
@@ -466,18 +630,305 @@ impl LiveTimer {
     }
 }
 
-#[cfg(feature = "python")]
-fn call_python_with_time_event(
+/// The tick resolution of the shared live timer wheel in nanoseconds.
+///
+/// Events for all live timers due within the same tick are dispatched as one batch.
+pub const LIVE_TIMER_TICK_NS: u64 = NANOSECONDS_IN_MILLISECOND;
+
+static LIVE_TIMER_WHEEL: OnceLock<LiveTimerWheel> = OnceLock::new();
+
+#[derive(Debug, Default)]
+struct LiveTimerState {
+    next_time_ns: AtomicU64,
+    is_expired: AtomicBool,
+    is_canceled: AtomicBool,
+}
+
+/// The callback of a wheel timer, which is called and dropped on the wheel thread.
+enum LiveTimerCallback {
+    #[cfg(feature = "python")]
+    Python(PyObject),
+    Rust(Arc<SyncTimeEventCallback>),
+}
+
+impl From<TimeEventCallback> for LiveTimerCallback {
+    fn from(value: TimeEventCallback) -> Self {
+        match value {
+            #[cfg(feature = "python")]
+            TimeEventCallback::Python(callback) => Self::Python(callback),
+            TimeEventCallback::RustSync(callback) => Self::Rust(callback),
+            TimeEventCallback::Rust(_) => {
+                panic!("Live timer does not support non thread-safe Rust callbacks")
+            }
+        }
+    }
+}
+
+struct WheelTimer {
     name: Ustr,
-    ts_event: UnixNanos,
-    ts_init: UnixNanos,
-    callback: &PyObject,
-) {
+    timer_id: u32,
+    interval_ns: u64,
+    stop_time_ns: Option<UnixNanos>,
+    next_time_ns: UnixNanos,
+    callback: Arc<LiveTimerCallback>,
+    state: Arc<LiveTimerState>,
+}
+
+struct FiredTimeEvent {
+    event: TimeEvent,
+    callback: Arc<LiveTimerCallback>,
+    state: Arc<LiveTimerState>,
+}
+
+/// The timing wheel shared by all live timers, driven by a single dedicated thread.
+struct LiveTimerWheel {
+    wheel: Mutex<TimingWheel<WheelTimer>>,
+    wakeup: Condvar,
+}
+
+fn get_live_timer_wheel() -> &'static LiveTimerWheel {
+    LIVE_TIMER_WHEEL.get_or_init(|| {
+        std::thread::Builder::new()
+            .name("nautilus-timer-wheel".to_string())
+            .spawn(|| get_live_timer_wheel().run())
+            .expect("Failed to spawn timer wheel thread");
+
+        LiveTimerWheel {
+            wheel: Mutex::new(TimingWheel::new(
+                LIVE_TIMER_TICK_NS,
+                get_atomic_clock_realtime().get_time_ns(),
+            )),
+            wakeup: Condvar::new(),
+        }
+    })
+}
+
+impl LiveTimerWheel {
+    fn insert(&self, deadline_ns: UnixNanos, timer: WheelTimer) -> TimerKey {
+        let key = self.wheel.lock().unwrap().insert(deadline_ns, timer);
+        self.wakeup.notify_one();
+        key
+    }
+
+    fn remove(&self, key: TimerKey) {
+        // Dropping the timer may release a Python callback, so do so outside the lock
+        let timer = self.wheel.lock().unwrap().remove(key);
+        drop(timer);
+    }
+
+    fn run(&self) {
+        let clock = get_atomic_clock_realtime();
+        let mut expired: Vec<TimerKey> = Vec::new();
+        let mut batch: Vec<FiredTimeEvent> = Vec::new();
+        let mut wheel = self.wheel.lock().unwrap();
+
+        loop {
+            let now_ns = clock.get_time_ns();
+            wheel.advance(now_ns, &mut expired);
+
+            for key in expired.drain(..) {
+                let Some(timer) = wheel.get_mut(key) else {
+                    continue;
+                };
+                let ts_event = timer.next_time_ns;
+                batch.push(FiredTimeEvent {
+                    event: TimeEvent::with_timer_id(
+                        timer.name,
+                        timer.timer_id,
+                        UUID4::new(),
+                        ts_event,
+                        now_ns,
+                    ),
+                    callback: timer.callback.clone(),
+                    state: timer.state.clone(),
+                });
+
+                timer.next_time_ns += timer.interval_ns;
+                let next_time_ns = timer.next_time_ns;
+                timer
+                    .state
+                    .next_time_ns
+                    .store(next_time_ns.as_u64(), atomic::Ordering::SeqCst);
+
+                let is_expired = timer.stop_time_ns.is_some_and(|stop_time_ns| {
+                    std::cmp::max(next_time_ns, now_ns) >= stop_time_ns
+                });
+                if is_expired {
+                    timer.state.is_expired.store(true, atomic::Ordering::SeqCst);
+                    wheel.remove(key);
+                } else {
+                    // A deadline already passed is due on the next advance, so catches up
+                    wheel.reschedule(key, next_time_ns);
+                }
+            }
+
+            if !batch.is_empty() {
+                // Handlers may set or cancel timers, so dispatch without holding the lock
+                drop(wheel);
+                dispatch_time_events(&mut batch);
+                wheel = self.wheel.lock().unwrap();
+                continue;
+            }
+
+            wheel = match wheel.next_expiration_ns() {
+                Some(next_ns) => {
+                    let timeout = Duration::from_nanos(next_ns.saturating_sub(now_ns.as_u64()));
+                    self.wakeup.wait_timeout(wheel, timeout).unwrap().0
+                }
+                None => self.wakeup.wait(wheel).unwrap(),
+            };
+        }
+    }
+}
+
+/// Dispatches a batch of events fired within the same tick, in event time then name order.
+fn dispatch_time_events(batch: &mut Vec<FiredTimeEvent>) {
+    batch.sort_unstable_by(|a, b| {
+        (a.event.ts_event, a.event.name).cmp(&(b.event.ts_event, b.event.name))
+    });
+
+    let dispatch = |batch: &mut Vec<FiredTimeEvent>| {
+        for fired in batch.drain(..) {
+            if fired.state.is_canceled.load(atomic::Ordering::SeqCst) {
+                continue;
+            }
+            match fired.callback.as_ref() {
+                #[cfg(feature = "python")]
+                LiveTimerCallback::Python(callback) => {
+                    call_python_with_time_event(fired.event, callback);
+                }
+                LiveTimerCallback::Rust(callback) => callback(fired.event),
+            }
+        }
+    };
+
+    // Acquire the GIL once for the whole batch (nested acquisitions are then free)
+    #[cfg(feature = "python")]
+    if batch
+        .iter()
+        .any(|fired| matches!(fired.callback.as_ref(), LiveTimerCallback::Python(_)))
+    {
+        Python::with_gil(|_| dispatch(batch));
+        return;
+    }
+
+    dispatch(batch);
+}
+
+/// A live timer scheduled on the shared timing wheel, for use with a `LiveClock`.
+///
+/// All wheel timers are driven by a single dedicated thread rather than a task per timer,
+/// and events due within the same [`LIVE_TIMER_TICK_NS`] tick are dispatched together.
+/// Dropping the handle cancels the timer.
+#[derive(Debug)]
+pub struct LiveTimerHandle {
+    /// The name of the timer.
+    pub name: Ustr,
+    /// The interval between timer events in nanoseconds.
+    pub interval_ns: NonZeroU64,
+    /// The start time of the timer in UNIX nanoseconds.
+    pub start_time_ns: UnixNanos,
+    /// The optional stop time of the timer in UNIX nanoseconds.
+    pub stop_time_ns: Option<UnixNanos>,
+    key: TimerKey,
+    state: Arc<LiveTimerState>,
+}
+
+impl LiveTimerHandle {
+    /// Creates a new [`LiveTimerHandle`] instance, scheduling the timer on the shared wheel.
+    ///
+    /// A timer whose event times have already passed fires immediately, once for each
+    /// missed event time, before continuing at `interval_ns`.
+    ///
+    /// # Panics
+    ///
+    /// This function panics:
+    /// - If `name` is not a valid string.
+    /// - If `callback` is a non thread-safe [`TimeEventCallback::Rust`] callback.
+    #[must_use]
+    pub fn schedule(
+        name: &str,
+        interval_ns: u64,
+        start_time_ns: UnixNanos,
+        stop_time_ns: Option<UnixNanos>,
+        callback: TimeEventCallback,
+    ) -> Self {
+        check_valid_string(name, stringify!(name)).expect(FAILED);
+        let callback = LiveTimerCallback::from(callback);
+        // SAFETY: Guaranteed to be non-zero
+        let interval_ns = NonZeroU64::new(std::cmp::max(interval_ns, 1)).unwrap();
+        let name = Ustr::from(name);
+
+        // Floor the next time to the nearest microsecond which is within the timers accuracy
+        let next_time_ns = UnixNanos::from(floor_to_nearest_microsecond(
+            start_time_ns.as_u64() + interval_ns.get(),
+        ));
+        let state = Arc::new(LiveTimerState {
+            next_time_ns: AtomicU64::new(next_time_ns.as_u64()),
+            ..Default::default()
+        });
+
+        let timer = WheelTimer {
+            name,
+            timer_id: recurring_timer_id(name, interval_ns, start_time_ns, stop_time_ns),
+            interval_ns: interval_ns.get(),
+            stop_time_ns,
+            next_time_ns,
+            callback: Arc::new(callback),
+            state: state.clone(),
+        };
+
+        log::debug!("Scheduling timer '{name}'");
+        let key = get_live_timer_wheel().insert(next_time_ns, timer);
+
+        Self {
+            name,
+            interval_ns,
+            start_time_ns,
+            stop_time_ns,
+            key,
+            state,
+        }
+    }
+
+    /// Returns the next time in UNIX nanoseconds when the timer will fire.
+    #[must_use]
+    pub fn next_time_ns(&self) -> UnixNanos {
+        UnixNanos::from(self.state.next_time_ns.load(atomic::Ordering::SeqCst))
+    }
+
+    /// Returns whether the timer is expired.
+    ///
+    /// An expired timer will not trigger any further events.
+    #[must_use]
+    pub fn is_expired(&self) -> bool {
+        self.state.is_expired.load(atomic::Ordering::SeqCst)
+    }
+
+    /// Cancels the timer (the timer will not generate a final event).
+    ///
+    /// This removes the timer from the wheel in constant time.
+    pub fn cancel(&mut self) {
+        if self.state.is_canceled.swap(true, atomic::Ordering::SeqCst) {
+            return; // Already canceled
+        }
+        log::debug!("Cancel timer '{}'", self.name);
+        self.state.is_expired.store(true, atomic::Ordering::SeqCst);
+        get_live_timer_wheel().remove(self.key);
+    }
+}
+
+impl Drop for LiveTimerHandle {
+    fn drop(&mut self) {
+        self.cancel();
+    }
+}
+
+#[cfg(feature = "python")]
+fn call_python_with_time_event(event: TimeEvent, callback: &PyObject) {
     use pyo3::{types::PyCapsule, IntoPy};
 
     Python::with_gil(|py| {
-        // Create new time event
-        let event = TimeEvent::new(name, UUID4::new(), ts_event, ts_init);
         let capsule: PyObject = PyCapsule::new_bound(py, event, None)
             .expect("Error creating `PyCapsule`")
             .into_py(py);
@@ -494,10 +945,67 @@ fn call_python_with_time_event(
 ////////////////////////////////////////////////////////////////////////////////
 #[cfg(test)]
 mod tests {
-    use nautilus_core::nanos::UnixNanos;
+    use std::{cell::RefCell, rc::Rc};
+
+    use nautilus_core::{nanos::UnixNanos, uuid::UUID4};
     use rstest::*;
+    use ustr::Ustr;
 
-    use super::{TestTimer, TimeEvent};
+    use super::{
+        dispatch_time_event_handlers, registered_timer_id, timer_id, timer_name, TestTimer,
+        TimeEvent, TimeEventCallback, TimeEventHandlerV2, TIMER_IDS, TIMER_ID_NONE,
+    };
+
+    #[rstest]
+    fn test_timer_id_is_stable_per_name() {
+        let id1 = timer_id(Ustr::from("timer_id_a"));
+        let id2 = timer_id(Ustr::from("timer_id_b"));
+
+        assert_ne!(id1, id2);
+        assert_eq!(timer_id(Ustr::from("timer_id_a")), id1);
+        assert_eq!(timer_name(id1), Some(Ustr::from("timer_id_a")));
+        assert_eq!(timer_name(id2), Some(Ustr::from("timer_id_b")));
+        assert_eq!(timer_name(u32::MAX), None);
+    }
+
+    #[rstest]
+    fn test_registered_timer_id_does_not_assign() {
+        assert_eq!(registered_timer_id("timer_id_lookup"), None);
+        assert_eq!(registered_timer_id("timer_id_lookup"), None);
+
+        let id = timer_id(Ustr::from("timer_id_lookup"));
+
+        assert_eq!(registered_timer_id("timer_id_lookup"), Some(id));
+    }
+
+    #[rstest]
+    fn test_timer_events_carry_timer_id() {
+        let mut timer = TestTimer::new("timer_id_events", 1, UnixNanos::from(1), None);
+        let expected = timer_id(Ustr::from("timer_id_events"));
+
+        let (event, _) = timer.next().unwrap();
+
+        assert_eq!(timer.timer_id(), expected);
+        assert_eq!(event.timer_id, expected);
+        assert_eq!(
+            TimeEvent::new(event.name, UUID4::new(), 0.into(), 0.into()).timer_id,
+            TIMER_ID_NONE
+        );
+    }
+
+    #[rstest]
+    fn test_one_shot_timer_is_not_assigned_timer_id() {
+        let name = Ustr::from("timer_id_one_shot");
+        let mut timer = TestTimer::new(&name, 5, UnixNanos::from(0), Some(UnixNanos::from(5)));
+
+        let (event, _) = timer.next().unwrap();
+
+        assert_eq!(timer.timer_id(), TIMER_ID_NONE);
+        assert_eq!(event.timer_id, TIMER_ID_NONE);
+        assert_eq!(event.name, name);
+        let registry = TIMER_IDS.get_or_init(Default::default).lock().unwrap();
+        assert!(!registry.ids.contains_key(&name));
+    }
 
     #[rstest]
     fn test_test_timer_pop_event() {
@@ -562,4 +1070,32 @@ mod tests {
         assert_eq!(timer.advance(UnixNanos::from(10)).count(), 5);
         assert!(timer.is_expired);
     }
+
+    #[rstest]
+    fn test_dispatch_time_event_handlers_in_order() {
+        let received = Rc::new(RefCell::new(Vec::new()));
+        let sink = received.clone();
+        let callback = TimeEventCallback::Rust(Rc::new(move |event: TimeEvent| {
+            sink.borrow_mut().push((event.name, event.ts_event));
+        }));
+
+        let handlers: Vec<TimeEventHandlerV2> = [("a", 1), ("b", 1), ("a", 2)]
+            .into_iter()
+            .map(|(name, ts)| {
+                let ts = UnixNanos::from(ts);
+                let event = TimeEvent::new(Ustr::from(name), UUID4::new(), ts, ts);
+                TimeEventHandlerV2::new(event, callback.clone())
+            })
+            .collect();
+        dispatch_time_event_handlers(handlers);
+
+        assert_eq!(
+            *received.borrow(),
+            vec![
+                (Ustr::from("a"), UnixNanos::from(1)),
+                (Ustr::from("b"), UnixNanos::from(1)),
+                (Ustr::from("a"), UnixNanos::from(2)),
+            ]
+        );
+    }
 }
@@ -0,0 +1,528 @@
+// -------------------------------------------------------------------------------------------------
+//  Copyright (C) 2015-2024 Nautech Systems Pty Ltd. All rights reserved.
+//  https://nautechsystems.io
+//
+//  Licensed under the GNU Lesser General Public License Version 3.0 (the "License");
+//  You may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at https://www.gnu.org/licenses/lgpl-3.0.en.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+// -------------------------------------------------------------------------------------------------
+
+//! A hierarchical timing wheel for scheduling large numbers of timers.
+//!
+//! The wheel is a single-threaded data structure with `LEVELS` levels of `SLOTS` slots
+//! each, where every slot on a level spans `SLOTS` times the ticks of a slot on the level
+//! below. Entries are placed on the lowest level able to represent their deadline relative
+//! to the current tick, and cascade down as the wheel advances. Inserting, removing and
+//! rescheduling an entry are all O(1).
+
+use nautilus_core::nanos::UnixNanos;
+
+const SLOT_BITS: u32 = 6;
+const SLOTS: usize = 1 << SLOT_BITS;
+const SLOT_MASK: u64 = (SLOTS as u64) - 1;
+const LEVELS: usize = 6;
+/// The maximum number of ticks representable before far deadlines wrap on the top level.
+const MAX_TICKS: u64 = 1 << (SLOT_BITS as usize * LEVELS);
+/// The list index for entries which were already due when inserted.
+const PENDING_LIST: usize = LEVELS * SLOTS;
+const UNLINKED: u16 = u16::MAX;
+
+/// A key identifying an entry within a [`TimingWheel`].
+///
+/// Keys carry a generation so that a stale key for a removed entry never aliases a
+/// newer entry occupying the same storage.
+#[derive(Clone, Copy, Debug, PartialEq, Eq, Hash)]
+pub struct TimerKey {
+    index: u32,
+    generation: u32,
+}
+
+#[derive(Debug)]
+struct Entry<T> {
+    generation: u32,
+    deadline_ns: UnixNanos,
+    deadline_tick: u64,
+    list: u16,
+    pos: u32,
+    value: Option<T>,
+}
+
+/// A hierarchical timing wheel holding values of type `T` keyed by deadline.
+///
+/// Entries which expire are unlinked from the wheel but remain accessible through their
+/// [`TimerKey`] until removed, so recurring timers can be rescheduled in place.
+#[derive(Debug)]
+pub struct TimingWheel<T> {
+    tick_ns: u64,
+    origin_ns: UnixNanos,
+    elapsed: u64,
+    entries: Vec<Entry<T>>,
+    free: Vec<u32>,
+    lists: Vec<Vec<u32>>,
+    occupied: [u64; LEVELS],
+    linked: usize,
+    len: usize,
+}
+
+impl<T> TimingWheel<T> {
+    /// Creates a new [`TimingWheel`] instance with the given tick resolution, starting at `now_ns`.
+    ///
+    /// # Panics
+    ///
+    /// This function panics:
+    /// - If `tick_ns` is zero.
+    #[must_use]
+    pub fn new(tick_ns: u64, now_ns: UnixNanos) -> Self {
+        assert!(tick_ns > 0, "`tick_ns` was zero");
+        Self {
+            tick_ns,
+            origin_ns: now_ns,
+            elapsed: 0,
+            entries: Vec::new(),
+            free: Vec::new(),
+            lists: (0..=PENDING_LIST).map(|_| Vec::new()).collect(),
+            occupied: [0; LEVELS],
+            linked: 0,
+            len: 0,
+        }
+    }
+
+    /// Returns the tick resolution of the wheel in nanoseconds.
+    #[must_use]
+    pub const fn tick_ns(&self) -> u64 {
+        self.tick_ns
+    }
+
+    /// Returns the number of entries held by the wheel (scheduled or expired).
+    #[must_use]
+    pub const fn len(&self) -> usize {
+        self.len
+    }
+
+    /// Returns whether the wheel holds no entries.
+    #[must_use]
+    pub const fn is_empty(&self) -> bool {
+        self.len == 0
+    }
+
+    /// Returns the number of entries currently scheduled to expire.
+    #[must_use]
+    pub const fn scheduled(&self) -> usize {
+        self.linked
+    }
+
+    /// Inserts `value` to expire at `deadline_ns`, returning its key.
+    pub fn insert(&mut self, deadline_ns: UnixNanos, value: T) -> TimerKey {
+        let index = match self.free.pop() {
+            Some(index) => {
+                let entry = &mut self.entries[index as usize];
+                entry.value = Some(value);
+                index
+            }
+            None => {
+                self.entries.push(Entry {
+                    generation: 0,
+                    deadline_ns,
+                    deadline_tick: 0,
+                    list: UNLINKED,
+                    pos: 0,
+                    value: Some(value),
+                });
+                (self.entries.len() - 1) as u32
+            }
+        };
+        self.len += 1;
+        self.link(index, deadline_ns);
+
+        TimerKey {
+            index,
+            generation: self.entries[index as usize].generation,
+        }
+    }
+
+    /// Reschedules the entry for `key` to expire at `deadline_ns`.
+    ///
+    /// Returns `false` if `key` no longer refers to an entry.
+    pub fn reschedule(&mut self, key: TimerKey, deadline_ns: UnixNanos) -> bool {
+        if self.entry(key).is_none() {
+            return false;
+        }
+        self.unlink(key.index);
+        self.link(key.index, deadline_ns);
+        true
+    }
+
+    /// Removes the entry for `key`, returning its value.
+    pub fn remove(&mut self, key: TimerKey) -> Option<T> {
+        self.entry(key)?;
+        self.unlink(key.index);
+
+        let entry = &mut self.entries[key.index as usize];
+        entry.generation = entry.generation.wrapping_add(1);
+        self.free.push(key.index);
+        self.len -= 1;
+        entry.value.take()
+    }
+
+    /// Returns a reference to the value for `key`.
+    #[must_use]
+    pub fn get(&self, key: TimerKey) -> Option<&T> {
+        self.entry(key)?.value.as_ref()
+    }
+
+    /// Returns a mutable reference to the value for `key`.
+    pub fn get_mut(&mut self, key: TimerKey) -> Option<&mut T> {
+        let entry = self.entries.get_mut(key.index as usize)?;
+        if entry.generation != key.generation {
+            return None;
+        }
+        entry.value.as_mut()
+    }
+
+    /// Returns the deadline of the entry for `key`.
+    #[must_use]
+    pub fn deadline_ns(&self, key: TimerKey) -> Option<UnixNanos> {
+        self.entry(key).map(|entry| entry.deadline_ns)
+    }
+
+    /// Returns the earliest time at which [`TimingWheel::advance`] will expire or cascade
+    /// entries, or `None` if nothing is scheduled.
+    ///
+    /// The time may precede the earliest deadline when entries only need to cascade to a
+    /// lower level, in which case advancing to it expires nothing.
+    #[must_use]
+    pub fn next_expiration_ns(&self) -> Option<UnixNanos> {
+        if !self.lists[PENDING_LIST].is_empty() {
+            return Some(self.tick_to_ns(self.elapsed));
+        }
+        (0..LEVELS)
+            .find_map(|level| self.next_occupied_tick(level))
+            .map(|tick| self.tick_to_ns(tick))
+    }
+
+    /// Advances the wheel to `now_ns`, unlinking every entry with a deadline at or before
+    /// `now_ns` and appending its key to `expired` in deadline tick order.
+    pub fn advance(&mut self, now_ns: UnixNanos, expired: &mut Vec<TimerKey>) {
+        let now_tick = self.floor_tick(now_ns);
+        self.drain_list(PENDING_LIST, expired);
+
+        while let Some((level, tick)) =
+            (0..LEVELS).find_map(|level| self.next_occupied_tick(level).map(|tick| (level, tick)))
+        {
+            if tick > now_tick {
+                break;
+            }
+            self.elapsed = tick;
+            let slot = ((tick >> (level as u32 * SLOT_BITS)) & SLOT_MASK) as usize;
+            self.drain_list(level * SLOTS + slot, expired);
+        }
+
+        self.elapsed = self.elapsed.max(now_tick);
+    }
+
+    fn entry(&self, key: TimerKey) -> Option<&Entry<T>> {
+        self.entries
+            .get(key.index as usize)
+            .filter(|entry| entry.generation == key.generation && entry.value.is_some())
+    }
+
+    fn floor_tick(&self, time_ns: UnixNanos) -> u64 {
+        time_ns.saturating_sub(self.origin_ns.as_u64()) / self.tick_ns
+    }
+
+    fn ceil_tick(&self, time_ns: UnixNanos) -> u64 {
+        time_ns
+            .saturating_sub(self.origin_ns.as_u64())
+            .div_ceil(self.tick_ns)
+    }
+
+    fn tick_to_ns(&self, tick: u64) -> UnixNanos {
+        self.origin_ns + tick.saturating_mul(self.tick_ns)
+    }
+
+    fn next_occupied_tick(&self, level: usize) -> Option<u64> {
+        let occupied = self.occupied[level];
+        if occupied == 0 {
+            return None;
+        }
+
+        let shift = level as u32 * SLOT_BITS;
+        let slot_ticks = 1u64 << shift;
+        let level_ticks = slot_ticks << SLOT_BITS;
+        // Search from the slot after the current one, as the current slot can only hold
+        // far deadlines which wrapped around the top level
+        let from_slot = ((self.elapsed >> shift) + 1) & SLOT_MASK;
+        let slot = (u64::from(occupied.rotate_right(from_slot as u32).trailing_zeros())
+            + from_slot)
+            & SLOT_MASK;
+
+        let level_start = self.elapsed & !(level_ticks - 1);
+        let mut tick = level_start + slot * slot_ticks;
+        if tick <= self.elapsed {
+            tick += level_ticks;
+        }
+        Some(tick)
+    }
+
+    fn link(&mut self, index: u32, deadline_ns: UnixNanos) {
+        let deadline_tick = self.ceil_tick(deadline_ns);
+        let list = if deadline_tick <= self.elapsed {
+            PENDING_LIST
+        } else {
+            let level = level_for(self.elapsed, deadline_tick);
+            let slot = ((deadline_tick >> (level as u32 * SLOT_BITS)) & SLOT_MASK) as usize;
+            self.occupied[level] |= 1 << slot;
+            level * SLOTS + slot
+        };
+
+        let entry = &mut self.entries[index as usize];
+        entry.deadline_ns = deadline_ns;
+        entry.deadline_tick = deadline_tick;
+        entry.list = list as u16;
+        entry.pos = self.lists[list].len() as u32;
+        self.lists[list].push(index);
+        self.linked += 1;
+    }
+
+    fn unlink(&mut self, index: u32) {
+        let entry = &mut self.entries[index as usize];
+        if entry.list == UNLINKED {
+            return;
+        }
+        let list = entry.list as usize;
+        let pos = entry.pos as usize;
+        entry.list = UNLINKED;
+
+        let indices = &mut self.lists[list];
+        indices.swap_remove(pos);
+        if let Some(&moved) = indices.get(pos) {
+            self.entries[moved as usize].pos = pos as u32;
+        }
+        if indices.is_empty() && list != PENDING_LIST {
+            self.occupied[list / SLOTS] &= !(1 << (list % SLOTS));
+        }
+        self.linked -= 1;
+    }
+
+    fn drain_list(&mut self, list: usize, expired: &mut Vec<TimerKey>) {
+        if self.lists[list].is_empty() {
+            return;
+        }
+        let mut indices = std::mem::take(&mut self.lists[list]);
+        if list != PENDING_LIST {
+            self.occupied[list / SLOTS] &= !(1 << (list % SLOTS));
+        }
+        self.linked -= indices.len();
+
+        for &index in &indices {
+            let entry = &mut self.entries[index as usize];
+            entry.list = UNLINKED;
+            if entry.deadline_tick <= self.elapsed {
+                expired.push(TimerKey {
+                    index,
+                    generation: entry.generation,
+                });
+            } else {
+                // Cascade to a lower level (or wrap again on the top level)
+                let deadline_ns = entry.deadline_ns;
+                self.link(index, deadline_ns);
+            }
+        }
+
+        // Hand the allocation back if the list was not refilled by a cascade
+        if self.lists[list].is_empty() {
+            indices.clear();
+            self.lists[list] = indices;
+        }
+    }
+}
+
+/// Returns the level on which a deadline at `when` is placed when the wheel is at `elapsed`.
+fn level_for(elapsed: u64, when: u64) -> usize {
+    let masked = ((elapsed ^ when) | SLOT_MASK).min(MAX_TICKS - 1);
+    let significant = 63 - masked.leading_zeros();
+    (significant / SLOT_BITS) as usize
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Tests
+////////////////////////////////////////////////////////////////////////////////
+#[cfg(test)]
+mod tests {
+    use nautilus_core::nanos::UnixNanos;
+    use rstest::rstest;
+
+    use super::*;
+
+    fn advance(wheel: &mut TimingWheel<u64>, now_ns: u64) -> Vec<u64> {
+        let mut keys = Vec::new();
+        wheel.advance(UnixNanos::from(now_ns), &mut keys);
+        keys.into_iter()
+            .map(|key| wheel.remove(key).unwrap())
+            .collect()
+    }
+
+    #[rstest]
+    fn test_new_wheel_is_empty() {
+        let wheel = TimingWheel::<u64>::new(1, UnixNanos::default());
+        assert!(wheel.is_empty());
+        assert_eq!(wheel.scheduled(), 0);
+        assert_eq!(wheel.next_expiration_ns(), None);
+    }
+
+    #[rstest]
+    fn test_entry_expires_at_deadline() {
+        let mut wheel = TimingWheel::new(1, UnixNanos::default());
+        wheel.insert(UnixNanos::from(10), 10);
+
+        assert_eq!(wheel.next_expiration_ns(), Some(UnixNanos::from(10)));
+        assert!(advance(&mut wheel, 9).is_empty());
+        assert_eq!(advance(&mut wheel, 10), vec![10]);
+        assert!(wheel.is_empty());
+    }
+
+    #[rstest]
+    fn test_entry_never_expires_early_within_tick() {
+        let mut wheel = TimingWheel::new(100, UnixNanos::default());
+        wheel.insert(UnixNanos::from(150), 150);
+
+        assert!(advance(&mut wheel, 199).is_empty());
+        assert_eq!(advance(&mut wheel, 200), vec![150]);
+    }
+
+    #[rstest]
+    fn test_due_entry_expires_on_next_advance() {
+        let mut wheel = TimingWheel::new(1, UnixNanos::from(100));
+        advance(&mut wheel, 200);
+        wheel.insert(UnixNanos::from(50), 50);
+
+        assert_eq!(wheel.next_expiration_ns(), Some(UnixNanos::from(200)));
+        assert_eq!(advance(&mut wheel, 200), vec![50]);
+    }
+
+    #[rstest]
+    fn test_entries_expire_in_deadline_order_across_levels() {
+        let mut wheel = TimingWheel::new(1, UnixNanos::default());
+        let deadlines = [5_000_000, 3, 64, 4_096, 70, 262_144, 1];
+        for deadline in deadlines {
+            wheel.insert(UnixNanos::from(deadline), deadline);
+        }
+
+        let mut fired = Vec::new();
+        while let Some(next) = wheel.next_expiration_ns() {
+            for value in advance(&mut wheel, next.as_u64()) {
+                assert_eq!(value, next.as_u64());
+                fired.push(value);
+            }
+        }
+
+        let mut expected = deadlines.to_vec();
+        expected.sort_unstable();
+        assert_eq!(fired, expected);
+    }
+
+    #[rstest]
+    fn test_large_advance_expires_all_due_entries() {
+        let mut wheel = TimingWheel::new(1, UnixNanos::default());
+        for deadline in (1..=10_000).step_by(7) {
+            wheel.insert(UnixNanos::from(deadline), deadline);
+        }
+        wheel.insert(UnixNanos::from(20_000), 20_000);
+
+        let fired = advance(&mut wheel, 10_000);
+        assert_eq!(fired.len(), 1_429);
+        assert!(fired.windows(2).all(|w| w[0] < w[1]));
+        assert_eq!(wheel.scheduled(), 1);
+        assert_eq!(advance(&mut wheel, 20_000), vec![20_000]);
+    }
+
+    #[rstest]
+    fn test_far_deadline_beyond_wheel_range() {
+        let mut wheel = TimingWheel::new(1, UnixNanos::default());
+        let deadline = MAX_TICKS * 3 + 17;
+        wheel.insert(UnixNanos::from(deadline), deadline);
+
+        let mut fired = Vec::new();
+        let mut steps = 0;
+        while let Some(next) = wheel.next_expiration_ns() {
+            assert!(next.as_u64() <= deadline);
+            fired.extend(advance(&mut wheel, next.as_u64()));
+            steps += 1;
+        }
+
+        assert_eq!(fired, vec![deadline]);
+        assert!(steps < 20);
+    }
+
+    #[rstest]
+    fn test_wrapped_far_deadline_does_not_shadow_later_slots() {
+        let mut wheel = TimingWheel::new(1, UnixNanos::default());
+        let slot_ticks = 1 << (SLOT_BITS as usize * (LEVELS - 1));
+        let far = MAX_TICKS + 4 * slot_ticks;
+        let near = 15 * slot_ticks + 5;
+        wheel.insert(UnixNanos::from(far), far);
+        wheel.insert(UnixNanos::from(near), near);
+
+        let mut fired = Vec::new();
+        while let Some(next) = wheel.next_expiration_ns() {
+            fired.extend(advance(&mut wheel, next.as_u64()));
+        }
+
+        assert_eq!(fired, vec![near, far]);
+    }
+
+    #[rstest]
+    fn test_remove_before_expiry() {
+        let mut wheel = TimingWheel::new(1, UnixNanos::default());
+        let key = wheel.insert(UnixNanos::from(100), 100);
+        wheel.insert(UnixNanos::from(100), 101);
+
+        assert_eq!(wheel.remove(key), Some(100));
+        assert_eq!(wheel.remove(key), None);
+        assert_eq!(advance(&mut wheel, 100), vec![101]);
+    }
+
+    #[rstest]
+    fn test_stale_key_does_not_alias_reused_entry() {
+        let mut wheel = TimingWheel::new(1, UnixNanos::default());
+        let stale = wheel.insert(UnixNanos::from(10), 1);
+        wheel.remove(stale);
+        let key = wheel.insert(UnixNanos::from(20), 2);
+
+        assert_eq!(wheel.get(stale), None);
+        assert!(!wheel.reschedule(stale, UnixNanos::from(5)));
+        assert_eq!(wheel.get(key), Some(&2));
+    }
+
+    #[rstest]
+    fn test_reschedule_expired_entry() {
+        let mut wheel = TimingWheel::new(1, UnixNanos::default());
+        let key = wheel.insert(UnixNanos::from(10), 7);
+
+        let mut expired = Vec::new();
+        wheel.advance(UnixNanos::from(10), &mut expired);
+        assert_eq!(expired, vec![key]);
+        assert_eq!(wheel.scheduled(), 0);
+        assert_eq!(wheel.len(), 1);
+
+        assert!(wheel.reschedule(key, UnixNanos::from(20)));
+        assert_eq!(wheel.deadline_ns(key), Some(UnixNanos::from(20)));
+        assert_eq!(advance(&mut wheel, 20), vec![7]);
+    }
+
+    #[rstest]
+    fn test_reschedule_earlier() {
+        let mut wheel = TimingWheel::new(1, UnixNanos::default());
+        let key = wheel.insert(UnixNanos::from(1_000_000), 1);
+
+        assert!(wheel.reschedule(key, UnixNanos::from(5)));
+        assert_eq!(wheel.next_expiration_ns(), Some(UnixNanos::from(5)));
+        assert_eq!(advance(&mut wheel, 5), vec![1]);
+    }
+}
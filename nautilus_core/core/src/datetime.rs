@@ -15,7 +15,10 @@
 
 //! Common data and time functions.
 
-use std::time::{Duration, UNIX_EPOCH};
+use std::{
+    fmt,
+    time::{Duration, UNIX_EPOCH},
+};
 
 use chrono::{
     prelude::{DateTime, Utc},
@@ -102,6 +105,35 @@ pub fn unix_nanos_to_iso8601(unix_nanos: UnixNanos) -> String {
     dt.to_rfc3339_opts(SecondsFormat::Nanos, true)
 }
 
+/// Writes a UNIX nanoseconds timestamp to `w` in the same ISO 8601 format as
+/// [`unix_nanos_to_iso8601`], without allocating.
+pub fn write_unix_nanos_iso8601<W: fmt::Write>(unix_nanos: UnixNanos, w: &mut W) -> fmt::Result {
+    let nanos = unix_nanos.as_u64();
+    let secs = nanos / NANOSECONDS_IN_SECOND;
+    let days = (secs / 86_400) as i64;
+    let secs_of_day = secs % 86_400;
+
+    // Civil date from days since the UNIX epoch (proleptic Gregorian calendar)
+    let z = days + 719_468;
+    let era = z.div_euclid(146_097);
+    let doe = z.rem_euclid(146_097);
+    let yoe = (doe - doe / 1_460 + doe / 36_524 - doe / 146_096) / 365;
+    let doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    let mp = (5 * doy + 2) / 153;
+    let day = doy - (153 * mp + 2) / 5 + 1;
+    let month = if mp < 10 { mp + 3 } else { mp - 9 };
+    let year = yoe + era * 400 + i64::from(month <= 2);
+
+    write!(
+        w,
+        "{year:04}-{month:02}-{day:02}T{:02}:{:02}:{:02}.{:09}Z",
+        secs_of_day / 3_600,
+        secs_of_day % 3_600 / 60,
+        secs_of_day % 60,
+        nanos % NANOSECONDS_IN_SECOND,
+    )
+}
+
 /// Floor the given UNIX nanoseconds to the nearest microsecond.
 #[must_use]
 pub const fn floor_to_nearest_microsecond(unix_nanos: u64) -> u64 {
@@ -287,4 +319,18 @@ mod tests {
             .unwrap();
         assert!(!is_within_last_24_hours(UnixNanos::from(past_ns as u64)).unwrap());
     }
+
+    #[rstest]
+    #[case(0)]
+    #[case(1)]
+    #[case(951_782_400_000_000_000)] // 2000-02-29 (leap day)
+    #[case(1_704_067_199_999_999_999)] // 2023-12-31 end of day
+    #[case(1_709_251_200_123_456_789)] // 2024-03-01
+    #[case(4_102_444_800_000_000_000)] // 2100-01-01
+    #[case(u64::MAX)]
+    fn test_write_unix_nanos_iso8601_matches_chrono(#[case] nanos: u64) {
+        let mut result = String::new();
+        write_unix_nanos_iso8601(UnixNanos::from(nanos), &mut result).unwrap();
+        assert_eq!(result, unix_nanos_to_iso8601(UnixNanos::from(nanos)));
+    }
 }
@@ -0,0 +1,364 @@
+// -------------------------------------------------------------------------------------------------
+//  Copyright (C) 2015-2024 Nautech Systems Pty Ltd. All rights reserved.
+//  https://nautechsystems.io
+//
+//  Licensed under the GNU Lesser General Public License Version 3.0 (the "License");
+//  You may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at https://www.gnu.org/licenses/lgpl-3.0.en.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+// -------------------------------------------------------------------------------------------------
+
+//! Static string tables with perfect-hash parsing for C-like enums.
+//!
+//! Each table is built once per enum type and leaks its names into static storage, so
+//! conversions to strings never allocate. Parsing (ignoring ASCII case, as for the `strum`
+//! derived `FromStr` implementations) hashes the input once into a collision-free slot table
+//! and performs a single comparison.
+
+use std::ffi::{CStr, CString};
+
+const EMPTY: u8 = u8::MAX;
+const SEEDS_PER_SIZE: u64 = 1_000;
+const FNV_OFFSET: u64 = 0xcbf2_9ce4_8422_2325;
+const FNV_PRIME: u64 = 0x0000_0100_0000_01b3;
+
+/// Provides static string conversions for a C-like enum through an [`EnumStrTable`].
+///
+/// Implement with the [`impl_enum_str_table`](crate::impl_enum_str_table) macro.
+pub trait EnumStrs: Copy + Sized + 'static {
+    /// Returns the string table for the enum.
+    fn str_table() -> &'static EnumStrTable<Self>;
+
+    /// Returns the enum discriminant as a code.
+    fn code(self) -> u8;
+
+    /// Returns the enum name as a static C string.
+    fn as_static_cstr(self) -> &'static CStr {
+        Self::str_table().name(self.code())
+    }
+
+    /// Returns the enum name as a static string slice.
+    fn as_static_str(self) -> &'static str {
+        Self::str_table().as_str(self.code())
+    }
+
+    /// Parses the enum from the given `value` bytes (ignoring ASCII case).
+    fn parse_bytes(value: &[u8]) -> Option<Self> {
+        Self::str_table().parse(value).map(|(variant, _)| variant)
+    }
+}
+
+/// Represents the names of a C-like enum indexed by discriminant, along with a perfect-hash
+/// table over those names (and any aliases) for parsing.
+#[derive(Debug)]
+pub struct EnumStrTable<E: 'static> {
+    names: Box<[Option<&'static CStr>]>,
+    keys: Box<[(&'static [u8], E, u8)]>,
+    slots: Box<[u8]>,
+    seed: u64,
+    shift: u32,
+}
+
+impl<E: Copy + 'static> EnumStrTable<E> {
+    /// Creates a new [`EnumStrTable`] from `(code, variant, name)` entries, with `aliases`
+    /// additionally accepted when parsing.
+    ///
+    /// # Panics
+    ///
+    /// This function panics:
+    /// - If a code is repeated, or an alias is not for one of the variants.
+    /// - If a name or alias is repeated for another variant (ignoring ASCII case).
+    /// - If a name contains a NUL byte.
+    /// - If there are 255 or more names and aliases in total.
+    pub fn new<I>(variants: I, aliases: &[(&'static str, E)]) -> Self
+    where
+        I: IntoIterator<Item = (u8, E, String)>,
+        E: PartialEq,
+    {
+        let mut names: Vec<Option<&'static CStr>> = Vec::new();
+        let mut keys: Vec<(&'static [u8], E, u8)> = Vec::new();
+
+        for (code, variant, name) in variants {
+            let name: &'static CStr = Box::leak(
+                CString::new(name)
+                    .expect("enum name contained a NUL byte")
+                    .into_boxed_c_str(),
+            );
+            let index = code as usize;
+            if names.len() <= index {
+                names.resize(index + 1, None);
+            }
+            assert!(names[index].is_none(), "duplicate enum code {code}");
+            names[index] = Some(name);
+            keys.push((name.to_bytes(), variant, code));
+        }
+
+        for &(alias, variant) in aliases {
+            // An alias matching its own variant name is redundant
+            if keys
+                .iter()
+                .any(|(k, v, _)| *v == variant && k.eq_ignore_ascii_case(alias.as_bytes()))
+            {
+                continue;
+            }
+            let code = keys
+                .iter()
+                .find(|(_, v, _)| *v == variant)
+                .map(|(_, _, code)| *code)
+                .expect("enum alias was not for a known variant");
+            keys.push((alias.as_bytes(), variant, code));
+        }
+
+        assert!(keys.len() < EMPTY as usize, "too many enum names");
+        for (i, (key, _, _)) in keys.iter().enumerate() {
+            assert!(
+                !keys[..i]
+                    .iter()
+                    .any(|(k, _, _)| k.eq_ignore_ascii_case(key)),
+                "duplicate enum name '{}'",
+                String::from_utf8_lossy(key)
+            );
+        }
+
+        // Search for a collision-free seed, growing the slot table if none is found
+        let mut bits = (keys.len() * 2).next_power_of_two().trailing_zeros().max(1);
+        loop {
+            let shift = u64::BITS - bits;
+            for seed in 0..SEEDS_PER_SIZE {
+                if let Some(slots) = build_slots(&keys, seed, shift, 1 << bits) {
+                    return Self {
+                        names: names.into_boxed_slice(),
+                        keys: keys.into_boxed_slice(),
+                        slots,
+                        seed,
+                        shift,
+                    };
+                }
+            }
+            bits += 1;
+        }
+    }
+
+    /// Returns the name for the given enum `code` as a static C string.
+    ///
+    /// # Panics
+    ///
+    /// This function panics:
+    /// - If `code` is not a valid discriminant for the enum.
+    #[must_use]
+    pub fn name(&self, code: u8) -> &'static CStr {
+        self.names
+            .get(code as usize)
+            .copied()
+            .flatten()
+            .unwrap_or_else(|| panic!("invalid enum code {code}"))
+    }
+
+    /// Returns the name for the given enum `code` as a static string slice.
+    ///
+    /// # Panics
+    ///
+    /// This function panics:
+    /// - If `code` is not a valid discriminant for the enum.
+    #[must_use]
+    pub fn as_str(&self, code: u8) -> &'static str {
+        // SAFETY: Names are created from valid UTF-8 strings
+        unsafe { std::str::from_utf8_unchecked(self.name(code).to_bytes()) }
+    }
+
+    /// Parses the given `value` bytes (ignoring ASCII case), returning the variant and its code.
+    #[inline]
+    #[must_use]
+    pub fn parse(&self, value: &[u8]) -> Option<(E, u8)> {
+        let index = self.slots[hash(value, self.seed, self.shift)];
+        if index == EMPTY {
+            return None;
+        }
+        let (key, variant, code) = self.keys[index as usize];
+        key.eq_ignore_ascii_case(value).then_some((variant, code))
+    }
+
+    /// Parses each of the given `values` into the `out` slice as enum codes.
+    ///
+    /// # Errors
+    ///
+    /// Returns an error if any value is not a valid name for the enum.
+    ///
+    /// # Panics
+    ///
+    /// This function panics:
+    /// - If `values` and `out` differ in length.
+    pub fn parse_codes<'a, I>(&self, values: I, out: &mut [u8]) -> anyhow::Result<()>
+    where
+        I: IntoIterator<Item = &'a [u8]>,
+        I::IntoIter: ExactSizeIterator,
+    {
+        let values = values.into_iter();
+        assert_eq!(values.len(), out.len(), "`values` and `out` lengths differ");
+
+        for (i, (value, code)) in values.zip(out.iter_mut()).enumerate() {
+            match self.parse(value) {
+                Some((_, parsed)) => *code = parsed,
+                None => anyhow::bail!(
+                    "invalid enum string value at index {i}, was '{}'",
+                    String::from_utf8_lossy(value)
+                ),
+            }
+        }
+        Ok(())
+    }
+}
+
+#[inline]
+fn hash(bytes: &[u8], seed: u64, shift: u32) -> usize {
+    let mut h = FNV_OFFSET ^ seed;
+    for &b in bytes {
+        h = (h ^ u64::from(b.to_ascii_uppercase())).wrapping_mul(FNV_PRIME);
+    }
+    (h.wrapping_mul(0x9e37_79b9_7f4a_7c15) >> shift) as usize
+}
+
+fn build_slots<E>(
+    keys: &[(&[u8], E, u8)],
+    seed: u64,
+    shift: u32,
+    size: usize,
+) -> Option<Box<[u8]>> {
+    let mut slots = vec![EMPTY; size].into_boxed_slice();
+    for (i, (key, _, _)) in keys.iter().enumerate() {
+        let slot = &mut slots[hash(key, seed, shift)];
+        if *slot != EMPTY {
+            return None;
+        }
+        *slot = i as u8;
+    }
+    Some(slots)
+}
+
+/// Implements [`EnumStrs`](crate::enum_table::EnumStrs) for a C-like enum deriving `Display`
+/// and `strum::EnumIter`, with optional `[(alias, variant), ...]` accepted when parsing.
+#[macro_export]
+macro_rules! impl_enum_str_table {
+    ($type:ty) => {
+        $crate::impl_enum_str_table!($type, []);
+    };
+    ($type:ty, [$(($alias:expr, $variant:expr)),* $(,)?]) => {
+        impl $crate::enum_table::EnumStrs for $type {
+            fn str_table() -> &'static $crate::enum_table::EnumStrTable<Self> {
+                static TABLE: std::sync::OnceLock<$crate::enum_table::EnumStrTable<$type>> =
+                    std::sync::OnceLock::new();
+                TABLE.get_or_init(|| {
+                    $crate::enum_table::EnumStrTable::new(
+                        <$type as strum::IntoEnumIterator>::iter()
+                            .map(|variant| (variant as u8, variant, variant.to_string())),
+                        &[$(($alias, $variant)),*],
+                    )
+                })
+            }
+
+            #[inline]
+            fn code(self) -> u8 {
+                self as u8
+            }
+        }
+    };
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Tests
+////////////////////////////////////////////////////////////////////////////////
+#[cfg(test)]
+mod tests {
+    use rstest::rstest;
+
+    use super::*;
+
+    #[derive(Clone, Copy, Debug, PartialEq, Eq)]
+    enum Side {
+        NoSide = 0,
+        Buy = 1,
+        Sell = 2,
+        Hold = 5,
+    }
+
+    fn table() -> EnumStrTable<Side> {
+        EnumStrTable::new(
+            [
+                (0, Side::NoSide, "NO_SIDE".to_string()),
+                (1, Side::Buy, "BUY".to_string()),
+                (2, Side::Sell, "SELL".to_string()),
+                (5, Side::Hold, "HOLD".to_string()),
+            ],
+            &[("SHORT", Side::Sell)],
+        )
+    }
+
+    #[rstest]
+    fn test_name_and_as_str() {
+        let table = table();
+        assert_eq!(table.name(1), c"BUY");
+        assert_eq!(table.as_str(5), "HOLD");
+        assert_eq!(table.name(2).as_ptr(), table.name(2).as_ptr());
+    }
+
+    #[rstest]
+    #[should_panic(expected = "invalid enum code 3")]
+    fn test_name_with_hole_panics() {
+        let _ = table().name(3);
+    }
+
+    #[rstest]
+    #[case(b"BUY", Some((Side::Buy, 1)))]
+    #[case(b"buy", Some((Side::Buy, 1)))]
+    #[case(b"No_Side", Some((Side::NoSide, 0)))]
+    #[case(b"short", Some((Side::Sell, 2)))]
+    #[case(b"HOLD", Some((Side::Hold, 5)))]
+    #[case(b"", None)]
+    #[case(b"BUYS", None)]
+    #[case(b"LONG", None)]
+    fn test_parse(#[case] value: &[u8], #[case] expected: Option<(Side, u8)>) {
+        assert_eq!(table().parse(value), expected);
+    }
+
+    #[rstest]
+    fn test_parse_codes() {
+        let values: [&[u8]; 4] = [b"SELL", b"buy", b"HOLD", b"no_side"];
+        let mut out = [0; 4];
+        table().parse_codes(values, &mut out).unwrap();
+        assert_eq!(out, [2, 1, 5, 0]);
+    }
+
+    #[rstest]
+    fn test_parse_codes_invalid() {
+        let values: [&[u8]; 2] = [b"SELL", b"FLAT"];
+        let mut out = [0; 2];
+        let err = table().parse_codes(values, &mut out).unwrap_err();
+        assert_eq!(
+            err.to_string(),
+            "invalid enum string value at index 1, was 'FLAT'"
+        );
+    }
+
+    #[rstest]
+    fn test_redundant_alias_is_ignored() {
+        let table = EnumStrTable::new([(1, Side::Buy, "BUY".to_string())], &[("buy", Side::Buy)]);
+        assert_eq!(table.parse(b"Buy"), Some((Side::Buy, 1)));
+    }
+
+    #[rstest]
+    #[should_panic(expected = "duplicate enum name 'buy'")]
+    fn test_conflicting_alias_panics() {
+        let _ = EnumStrTable::new(
+            [
+                (1, Side::Buy, "BUY".to_string()),
+                (2, Side::Sell, "SELL".to_string()),
+            ],
+            &[("buy", Side::Sell)],
+        );
+    }
+}
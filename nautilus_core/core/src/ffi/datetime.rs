@@ -13,9 +13,24 @@
 //  limitations under the License.
 // -------------------------------------------------------------------------------------------------
 
-use std::ffi::c_char;
+use std::{
+    ffi::c_char,
+    fmt::{Display, Formatter},
+};
 
-use crate::{datetime::unix_nanos_to_iso8601, ffi::string::str_to_cstr};
+use crate::{
+    datetime::{unix_nanos_to_iso8601, write_unix_nanos_iso8601},
+    ffi::string::{str_to_cstr, write_to_cstr_buf},
+    nanos::UnixNanos,
+};
+
+struct Iso8601(UnixNanos);
+
+impl Display for Iso8601 {
+    fn fmt(&self, f: &mut Formatter<'_>) -> std::fmt::Result {
+        write_unix_nanos_iso8601(self.0, f)
+    }
+}
 
 /// Converts a UNIX nanoseconds timestamp to an ISO 8601 formatted C string pointer.
 #[cfg(feature = "ffi")]
@@ -23,3 +38,20 @@ use crate::{datetime::unix_nanos_to_iso8601, ffi::string::str_to_cstr};
 pub extern "C" fn unix_nanos_to_iso8601_cstr(timestamp_ns: u64) -> *const c_char {
     str_to_cstr(&unix_nanos_to_iso8601(timestamp_ns.into()))
 }
+
+/// Writes a UNIX nanoseconds timestamp as an ISO 8601 formatted nul-terminated C string into
+/// the caller provided buffer `buf` of capacity `len`, returning the full string length (the
+/// output was truncated if not less than `len`).
+///
+/// # Safety
+///
+/// - Assumes `buf` is a valid pointer to a writable array of length `len`.
+#[cfg(feature = "ffi")]
+#[no_mangle]
+pub unsafe extern "C" fn unix_nanos_to_iso8601_cstr_buf(
+    timestamp_ns: u64,
+    buf: *mut c_char,
+    len: usize,
+) -> usize {
+    write_to_cstr_buf(&Iso8601(timestamp_ns.into()), buf, len)
+}
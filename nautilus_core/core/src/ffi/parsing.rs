@@ -22,6 +22,7 @@ use serde_json::{Result, Value};
 use ustr::Ustr;
 
 use crate::{
+    enum_table::EnumStrs,
     ffi::string::cstr_to_str,
     parsing::{min_increment_precision_from_str, precision_from_str},
 };
@@ -163,6 +164,62 @@ pub unsafe extern "C" fn min_increment_precision_from_cstr(ptr: *const c_char) -
     min_increment_precision_from_str(cstr_to_str(ptr))
 }
 
+/// Return an enum parsed from the given C string using its static string table.
+///
+/// # Safety
+///
+/// - Assumes `ptr` is a valid C string pointer.
+///
+/// # Panics
+///
+/// This function panics:
+/// - If `ptr` is null.
+/// - If the string is not a valid name for the enum.
+pub unsafe fn enum_from_cstr<E: EnumStrs>(ptr: *const c_char) -> E {
+    assert!(!ptr.is_null(), "`ptr` was NULL");
+    let value = CStr::from_ptr(ptr).to_bytes();
+    E::parse_bytes(value).unwrap_or_else(|| {
+        panic!(
+            "invalid `{}` enum string value, was '{}'",
+            enum_type_name::<E>(),
+            String::from_utf8_lossy(value)
+        )
+    })
+}
+
+/// Parse the array of C strings `ptrs` of length `len` into the array `out` as enum codes.
+///
+/// # Safety
+///
+/// - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+/// - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+///
+/// # Panics
+///
+/// This function panics:
+/// - If any string is not a valid name for the enum.
+pub unsafe fn enum_codes_from_cstr_array<E: EnumStrs>(
+    ptrs: *const *const c_char,
+    len: usize,
+    out: *mut u8,
+) {
+    if len == 0 {
+        return;
+    }
+    assert!(!ptrs.is_null(), "`ptrs` was NULL");
+    assert!(!out.is_null(), "`out` was NULL");
+    let ptrs = std::slice::from_raw_parts(ptrs, len);
+    let out = std::slice::from_raw_parts_mut(out, len);
+    E::str_table()
+        .parse_codes(ptrs.iter().map(|&ptr| CStr::from_ptr(ptr).to_bytes()), out)
+        .unwrap_or_else(|e| panic!("`{}`: {e}", enum_type_name::<E>()));
+}
+
+fn enum_type_name<E>() -> &'static str {
+    let name = std::any::type_name::<E>();
+    name.rsplit("::").next().unwrap_or(name)
+}
+
 /// Return a `bool` value from the given `u8`.
 #[must_use]
 pub const fn u8_as_bool(value: u8) -> bool {
@@ -15,6 +15,7 @@
 
 use std::{
     ffi::{c_char, CStr, CString},
+    fmt::{self, Display, Write},
     str,
 };
 
@@ -124,6 +125,59 @@ pub fn str_to_cstr(s: &str) -> *const c_char {
     CString::new(s).expect("CString::new failed").into_raw()
 }
 
+/// Writes the string fragments it is given into a fixed buffer, truncating once full,
+/// while counting the full length.
+struct BufWriter<'a> {
+    buf: &'a mut [u8],
+    len: usize,
+}
+
+impl Write for BufWriter<'_> {
+    fn write_str(&mut self, s: &str) -> fmt::Result {
+        let capacity = self.buf.len().saturating_sub(1); // Reserve the nul terminator
+        if self.len < capacity {
+            let n = s.len().min(capacity - self.len);
+            self.buf[self.len..self.len + n].copy_from_slice(&s.as_bytes()[..n]);
+        }
+        self.len += s.len();
+        Ok(())
+    }
+}
+
+/// Writes `value` into `buf` as a nul-terminated C string without allocating, returning the
+/// length of the full formatted string (excluding the nul terminator).
+///
+/// If the returned length is not less than the length of `buf` then the output was truncated.
+pub fn write_to_buf(value: &impl Display, buf: &mut [u8]) -> usize {
+    let mut writer = BufWriter {
+        buf: &mut *buf,
+        len: 0,
+    };
+    write!(writer, "{value}").expect("Error formatting value");
+    let len = writer.len;
+    if let Some(last) = buf.len().checked_sub(1) {
+        buf[len.min(last)] = 0;
+    }
+    len
+}
+
+/// Writes `value` into the caller provided buffer `buf` of capacity `len` as a nul-terminated
+/// C string without allocating, returning the length of the full formatted string
+/// (excluding the nul terminator).
+///
+/// If the returned length is not less than `len` then the output was truncated.
+///
+/// # Safety
+///
+/// - Assumes `buf` is a valid pointer to a writable array of length `len`.
+pub unsafe fn write_to_cstr_buf(value: &impl Display, buf: *mut c_char, len: usize) -> usize {
+    if len == 0 {
+        return write_to_buf(value, &mut []);
+    }
+    assert!(!buf.is_null(), "`buf` was NULL");
+    write_to_buf(value, std::slice::from_raw_parts_mut(buf.cast::<u8>(), len))
+}
+
 /// Drops the C string memory at the pointer.
 ///
 /// # Safety
@@ -232,4 +286,25 @@ mod tests {
         let ptr = c_string.into_raw(); // <-- pointer _must_ be obtained this way
         unsafe { cstr_drop(ptr) };
     }
+
+    #[rstest]
+    fn test_write_to_buf() {
+        let mut buf = [0xFF_u8; 16];
+        let len = write_to_buf(&"hello", &mut buf);
+        assert_eq!(len, 5);
+        assert_eq!(&buf[..6], b"hello\0");
+    }
+
+    #[rstest]
+    fn test_write_to_buf_truncates() {
+        let mut buf = [0xFF_u8; 4];
+        let len = write_to_buf(&12_345, &mut buf);
+        assert_eq!(len, 5);
+        assert_eq!(&buf, b"123\0");
+    }
+
+    #[rstest]
+    fn test_write_to_buf_empty_buffer() {
+        assert_eq!(write_to_buf(&"hello", &mut []), 5);
+    }
 }
@@ -19,7 +19,10 @@ use std::{
     hash::{Hash, Hasher},
 };
 
-use crate::uuid::UUID4;
+use crate::{
+    ffi::string::{str_to_cstr, write_to_cstr_buf},
+    uuid::UUID4,
+};
 
 #[no_mangle]
 pub extern "C" fn uuid4_new() -> UUID4 {
@@ -46,9 +49,36 @@ pub unsafe extern "C" fn uuid4_from_cstr(ptr: *const c_char) -> UUID4 {
     )
 }
 
+/// Fills the array `out` of length `len` with newly generated [`UUID4`]s.
+///
+/// # Safety
+///
+/// - Assumes `out` is a valid pointer to an array of `UUID4` of length `len`.
+#[no_mangle]
+pub unsafe extern "C" fn uuid4_fill(out: *mut UUID4, len: usize) {
+    if len == 0 {
+        return;
+    }
+    assert!(!out.is_null(), "`out` was NULL");
+    UUID4::fill(std::slice::from_raw_parts_mut(out, len));
+}
+
+/// Returns a [`UUID4`] as a C string pointer.
 #[no_mangle]
 pub extern "C" fn uuid4_to_cstr(uuid: &UUID4) -> *const c_char {
-    uuid.to_cstr().as_ptr()
+    str_to_cstr(&uuid.to_string())
+}
+
+/// Writes a [`UUID4`] as a nul-terminated C string into the caller provided buffer `buf` of
+/// capacity `len`, returning the full string length (the output was truncated if not less
+/// than `len`).
+///
+/// # Safety
+///
+/// - Assumes `buf` is a valid pointer to a writable array of length `len`.
+#[no_mangle]
+pub unsafe extern "C" fn uuid4_to_cstr_buf(uuid: &UUID4, buf: *mut c_char, len: usize) -> usize {
+    write_to_cstr_buf(uuid, buf, len)
 }
 
 #[no_mangle]
@@ -100,6 +130,16 @@ mod tests {
         let uuid_cstr = unsafe { CStr::from_ptr(uuid_ptr) };
         let uuid_result_string = uuid_cstr.to_str().expect("CStr::to_str failed").to_string();
         assert_eq!(uuid_string, uuid_result_string);
+        unsafe { crate::ffi::string::cstr_drop(uuid_ptr) };
+    }
+
+    #[rstest]
+    fn test_fill() {
+        let uuid = UUID4::from("6ba7b810-9dad-11d1-80b4-00c04fd430c8");
+        let mut uuids = [uuid; 3];
+        unsafe { uuid4_fill(uuids.as_mut_ptr(), uuids.len()) };
+        assert!(uuids.iter().all(|u| *u != uuid));
+        assert_ne!(uuids[0], uuids[1]);
     }
 
     #[rstest]
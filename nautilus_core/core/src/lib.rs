@@ -29,6 +29,7 @@
 
 pub mod correctness;
 pub mod datetime;
+pub mod enum_table;
 pub mod message;
 pub mod nanos;
 pub mod parsing;
@@ -26,7 +26,7 @@ use pyo3::{
 };
 
 use super::to_pyvalue_err;
-use crate::uuid::{UUID4, UUID4_LEN};
+use crate::uuid::{UUID4, UUID4_BYTES};
 
 #[pymethods]
 impl UUID4 {
@@ -47,7 +47,7 @@ impl UUID4 {
         let bytes: &PyBytes = state.extract(py)?;
         let slice = bytes.as_bytes();
 
-        if slice.len() != UUID4_LEN {
+        if slice.len() != UUID4_BYTES {
             return Err(to_pyvalue_err(
                 "Invalid state for deserialzing, incorrect bytes length",
             ));
@@ -17,54 +17,71 @@
 //! label (RFC 4122).
 
 use std::{
-    ffi::{CStr, CString},
     fmt::{Debug, Display, Formatter},
-    hash::Hash,
+    hash::{Hash, Hasher},
     str::FromStr,
 };
 
+use rand::RngCore;
 use serde::{Deserialize, Deserializer, Serialize, Serializer};
-use uuid::Uuid;
+use uuid::{Builder, Uuid};
 
-/// The maximum length of ASCII characters for a `UUID4` string value (includes null terminator).
-pub(crate) const UUID4_LEN: usize = 37;
+/// The number of bytes in the binary representation of a `UUID4`.
+pub(crate) const UUID4_BYTES: usize = 16;
+
+/// The number of UUIDs minted per refill of the random bytes buffer in [`UUID4::fill`].
+const UUID4_BATCH: usize = 64;
 
 /// Represents a pseudo-random UUID (universally unique identifier)
 /// version 4 based on a 128-bit label as specified in RFC 4122.
 #[repr(C)]
-#[derive(Copy, Clone, Hash, PartialEq, Eq)]
+#[derive(Copy, Clone, PartialEq, Eq)]
 #[cfg_attr(
     feature = "python",
     pyo3::pyclass(module = "nautilus_trader.core.nautilus_pyo3.core")
 )]
 pub struct UUID4 {
-    /// The UUID v4 value as a fixed-length C string byte array (includes null terminator).
-    pub(crate) value: [u8; 37], // cbindgen issue using the constant in the array
+    /// The UUID v4 value as a 16 byte array in RFC 4122 (big-endian) order.
+    pub(crate) value: [u8; 16], // cbindgen issue using the constant in the array
 }
 
 impl UUID4 {
     /// Creates a new [`UUID4`] instance.
     ///
-    /// Generates a new UUID version 4, which is based on random or pseudo-random numbers.
-    /// The UUID is stored as a fixed-length C string byte array.
+    /// Generates a new UUID version 4 from the thread-local buffered random number generator,
+    /// avoiding a system call per UUID. The string form is only produced when formatted.
     #[must_use]
     pub fn new() -> Self {
-        let uuid = Uuid::new_v4();
-        let c_string =
-            CString::new(uuid.to_string()).expect("Expected UUID to convert to valid `CString`");
-        let bytes = c_string.as_bytes_with_nul();
-        let mut value = [0; UUID4_LEN];
-        value[..bytes.len()].copy_from_slice(bytes);
+        let mut bytes = [0; UUID4_BYTES];
+        rand::thread_rng().fill_bytes(&mut bytes);
+        Self::from_random_bytes(bytes)
+    }
+
+    /// Fills `out` with newly generated [`UUID4`]s, drawing random bytes in batches.
+    pub fn fill(out: &mut [Self]) {
+        let mut rng = rand::thread_rng();
+        let mut bytes = [0; UUID4_BYTES * UUID4_BATCH];
+        for chunk in out.chunks_mut(UUID4_BATCH) {
+            let bytes = &mut bytes[..chunk.len() * UUID4_BYTES];
+            rng.fill_bytes(bytes);
+            for (uuid, random) in chunk.iter_mut().zip(bytes.chunks_exact(UUID4_BYTES)) {
+                *uuid = Self::from_random_bytes(random.try_into().unwrap());
+            }
+        }
+    }
 
-        Self { value }
+    fn from_random_bytes(bytes: [u8; UUID4_BYTES]) -> Self {
+        // Sets the version and variant bits
+        let uuid = Builder::from_random_bytes(bytes).into_uuid();
+        Self {
+            value: *uuid.as_bytes(),
+        }
     }
 
-    /// Converts the `UUID4` to a C string reference.
+    /// Returns the binary representation of the UUID in RFC 4122 (big-endian) order.
     #[must_use]
-    pub fn to_cstr(&self) -> &CStr {
-        // SAFETY: We always store valid C strings
-        CStr::from_bytes_with_nul(&self.value)
-            .expect("Expected UUID byte representation to be a valid `CString`")
+    pub fn as_bytes(&self) -> &[u8; UUID4_BYTES] {
+        &self.value
     }
 }
 
@@ -76,12 +93,9 @@ impl FromStr for UUID4 {
     /// The string should be a valid UUID in the standard format (e.g., "6ba7b810-9dad-11d1-80b4-00c04fd430c8").
     fn from_str(s: &str) -> Result<Self, Self::Err> {
         let uuid = Uuid::try_parse(s)?;
-        let c_string = CString::new(uuid.to_string()).expect("`CString` conversion failed");
-        let bytes = c_string.as_bytes_with_nul();
-        let mut value = [0; UUID4_LEN];
-        value[..bytes.len()].copy_from_slice(bytes);
-
-        Ok(Self { value })
+        Ok(Self {
+            value: *uuid.as_bytes(),
+        })
     }
 }
 
@@ -106,6 +120,12 @@ impl Default for UUID4 {
     }
 }
 
+impl Hash for UUID4 {
+    fn hash<H: Hasher>(&self, state: &mut H) {
+        state.write_u128(u128::from_ne_bytes(self.value));
+    }
+}
+
 impl Debug for UUID4 {
     fn fmt(&self, f: &mut Formatter<'_>) -> std::fmt::Result {
         write!(f, "{}('{}')", stringify!(UUID4), self)
@@ -114,7 +134,7 @@ impl Debug for UUID4 {
 
 impl Display for UUID4 {
     fn fmt(&self, f: &mut Formatter<'_>) -> std::fmt::Result {
-        write!(f, "{}", self.to_cstr().to_string_lossy())
+        write!(f, "{}", Uuid::from_bytes(self.value).hyphenated())
     }
 }
 
@@ -123,7 +143,7 @@ impl Serialize for UUID4 {
     where
         S: Serializer,
     {
-        self.value.serialize(serializer)
+        serializer.collect_str(self)
     }
 }
 
@@ -202,4 +222,37 @@ mod tests {
         let uuid = UUID4::from(uuid_string);
         assert_eq!(format!("{uuid}"), uuid_string);
     }
+
+    #[rstest]
+    fn test_fill() {
+        let mut uuids = [UUID4::from("6ba7b810-9dad-11d1-80b4-00c04fd430c8"); 100];
+        UUID4::fill(&mut uuids);
+
+        for uuid in &uuids {
+            let uuid_parsed = Uuid::parse_str(&uuid.to_string()).expect("Uuid::parse_str failed");
+            assert_eq!(uuid_parsed.get_version().unwrap(), uuid::Version::Random);
+            assert_eq!(uuid_parsed.get_variant(), uuid::Variant::RFC4122);
+        }
+        let unique: std::collections::HashSet<UUID4> = uuids.iter().copied().collect();
+        assert_eq!(unique.len(), uuids.len());
+    }
+
+    #[rstest]
+    fn test_string_round_trip() {
+        let uuid = UUID4::new();
+        assert_eq!(UUID4::from(uuid.to_string().as_str()), uuid);
+    }
+
+    #[rstest]
+    fn test_size() {
+        assert_eq!(std::mem::size_of::<UUID4>(), UUID4_BYTES);
+    }
+
+    #[rstest]
+    fn test_serde_json_round_trip() {
+        let uuid = UUID4::from("6ba7b810-9dad-11d1-80b4-00c04fd430c8");
+        let json = serde_json::to_string(&uuid).unwrap();
+        assert_eq!(json, "\"6ba7b810-9dad-11d1-80b4-00c04fd430c8\"");
+        assert_eq!(serde_json::from_str::<UUID4>(&json).unwrap(), uuid);
+    }
 }
@@ -0,0 +1,36 @@
+use criterion::{black_box, criterion_group, Criterion};
+use nautilus_model::types::{
+    fixed::f64_to_fixed_i64,
+    kernels::{f64_to_fixed_i64_array, fixed_i64_sum, rescale_fixed_i64_array},
+};
+
+const LEN: usize = 4096;
+
+pub fn criterion_kernels_benchmark(c: &mut Criterion) {
+    let values: Vec<f64> = (0..LEN).map(|i| i as f64 * 0.123_456_789 - 250.0).collect();
+    let raws: Vec<i64> = values.iter().map(|&v| f64_to_fixed_i64(v, 9)).collect();
+    let mut out = vec![0_i64; LEN];
+
+    c.bench_function("f64_to_fixed_i64 (element-wise)", |b| {
+        b.iter(|| {
+            for (o, &v) in out.iter_mut().zip(black_box(&values)) {
+                *o = f64_to_fixed_i64(v, 6);
+            }
+        });
+    });
+    c.bench_function("f64_to_fixed_i64_array", |b| {
+        b.iter(|| f64_to_fixed_i64_array(black_box(&values), 6, &mut out));
+    });
+    c.bench_function("rescale_fixed_i64_array", |b| {
+        b.iter(|| {
+            out.copy_from_slice(&raws);
+            rescale_fixed_i64_array(black_box(&mut out), 2);
+        });
+    });
+    c.bench_function("fixed_i64_sum", |b| {
+        b.iter(|| fixed_i64_sum(black_box(&raws)));
+    });
+}
+
+criterion_group!(benches, criterion_kernels_benchmark);
+criterion::criterion_main!(benches);
@@ -0,0 +1,660 @@
+// -------------------------------------------------------------------------------------------------
+//  Copyright (C) 2015-2024 Nautech Systems Pty Ltd. All rights reserved.
+//  https://nautechsystems.io
+//
+//  Licensed under the GNU Lesser General Public License Version 3.0 (the "License");
+//  You may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at https://www.gnu.org/licenses/lgpl-3.0.en.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+// -------------------------------------------------------------------------------------------------
+
+//! Columnar batches of market data, and a merge of many batches by `ts_init`.
+//!
+//! A [`Data`] value is as large as its largest variant, so holding ticks as `Vec<Data>`
+//! costs the size of an [`OrderBookDepth10`](super::depth::OrderBookDepth10) per tick.
+//! The batches here hold each field in its own column instead, with the instrument and
+//! precisions, which are fixed for a catalog record batch, held once per batch.
+
+use std::{cmp::Reverse, collections::BinaryHeap};
+
+use nautilus_core::nanos::UnixNanos;
+
+use super::{
+    bar::{Bar, BarType},
+    delta::OrderBookDelta,
+    order::{BookOrder, OrderId},
+    quote::QuoteTick,
+    trade::TradeTick,
+    Data,
+};
+use crate::{
+    enums::{AggressorSide, BookAction, OrderSide},
+    identifiers::{InstrumentId, TradeId},
+    types::{price::Price, quantity::Quantity},
+};
+
+/// Represents a batch of quote ticks for one instrument held as columns.
+#[derive(Clone, Debug, PartialEq)]
+pub struct QuoteTickBatch {
+    /// The quotes instrument ID.
+    pub instrument_id: InstrumentId,
+    /// The precision of the bid and ask prices.
+    pub price_precision: u8,
+    /// The precision of the bid and ask sizes.
+    pub size_precision: u8,
+    /// The raw top-of-book bid prices.
+    pub bid_price: Vec<i64>,
+    /// The raw top-of-book ask prices.
+    pub ask_price: Vec<i64>,
+    /// The raw top-of-book bid sizes.
+    pub bid_size: Vec<u64>,
+    /// The raw top-of-book ask sizes.
+    pub ask_size: Vec<u64>,
+    /// UNIX timestamps (nanoseconds) when the quote events occurred.
+    pub ts_event: Vec<UnixNanos>,
+    /// UNIX timestamps (nanoseconds) when the structs were initialized.
+    pub ts_init: Vec<UnixNanos>,
+}
+
+impl QuoteTickBatch {
+    /// Creates a new empty [`QuoteTickBatch`] instance.
+    #[must_use]
+    pub fn new(instrument_id: InstrumentId, price_precision: u8, size_precision: u8) -> Self {
+        Self {
+            instrument_id,
+            price_precision,
+            size_precision,
+            bid_price: Vec::new(),
+            ask_price: Vec::new(),
+            bid_size: Vec::new(),
+            ask_size: Vec::new(),
+            ts_event: Vec::new(),
+            ts_init: Vec::new(),
+        }
+    }
+
+    #[must_use]
+    pub fn len(&self) -> usize {
+        self.ts_init.len()
+    }
+
+    #[must_use]
+    pub fn is_empty(&self) -> bool {
+        self.ts_init.is_empty()
+    }
+
+    /// Appends the given `quote`, which is assumed to match the batch instrument and
+    /// precisions.
+    pub fn push(&mut self, quote: &QuoteTick) {
+        debug_assert_eq!(quote.instrument_id, self.instrument_id);
+        self.bid_price.push(quote.bid_price.raw);
+        self.ask_price.push(quote.ask_price.raw);
+        self.bid_size.push(quote.bid_size.raw);
+        self.ask_size.push(quote.ask_size.raw);
+        self.ts_event.push(quote.ts_event);
+        self.ts_init.push(quote.ts_init);
+    }
+
+    /// Returns the quote at the given `index`.
+    ///
+    /// # Panics
+    ///
+    /// This function panics:
+    /// - If `index` is out of bounds.
+    #[must_use]
+    pub fn get(&self, index: usize) -> QuoteTick {
+        QuoteTick {
+            instrument_id: self.instrument_id,
+            bid_price: Price::from_raw(self.bid_price[index], self.price_precision),
+            ask_price: Price::from_raw(self.ask_price[index], self.price_precision),
+            bid_size: Quantity::from_raw(self.bid_size[index], self.size_precision),
+            ask_size: Quantity::from_raw(self.ask_size[index], self.size_precision),
+            ts_event: self.ts_event[index],
+            ts_init: self.ts_init[index],
+        }
+    }
+}
+
+/// Represents a batch of trade ticks for one instrument held as columns.
+#[derive(Clone, Debug, PartialEq)]
+pub struct TradeTickBatch {
+    /// The trade instrument ID.
+    pub instrument_id: InstrumentId,
+    /// The precision of the traded prices.
+    pub price_precision: u8,
+    /// The precision of the traded sizes.
+    pub size_precision: u8,
+    /// The raw traded prices.
+    pub price: Vec<i64>,
+    /// The raw traded sizes.
+    pub size: Vec<u64>,
+    /// The trade aggressor sides.
+    pub aggressor_side: Vec<AggressorSide>,
+    /// The trade match IDs (assigned by the venue).
+    pub trade_id: Vec<TradeId>,
+    /// UNIX timestamps (nanoseconds) when the trade events occurred.
+    pub ts_event: Vec<UnixNanos>,
+    /// UNIX timestamps (nanoseconds) when the structs were initialized.
+    pub ts_init: Vec<UnixNanos>,
+}
+
+impl TradeTickBatch {
+    /// Creates a new empty [`TradeTickBatch`] instance.
+    #[must_use]
+    pub fn new(instrument_id: InstrumentId, price_precision: u8, size_precision: u8) -> Self {
+        Self {
+            instrument_id,
+            price_precision,
+            size_precision,
+            price: Vec::new(),
+            size: Vec::new(),
+            aggressor_side: Vec::new(),
+            trade_id: Vec::new(),
+            ts_event: Vec::new(),
+            ts_init: Vec::new(),
+        }
+    }
+
+    #[must_use]
+    pub fn len(&self) -> usize {
+        self.ts_init.len()
+    }
+
+    #[must_use]
+    pub fn is_empty(&self) -> bool {
+        self.ts_init.is_empty()
+    }
+
+    /// Appends the given `trade`, which is assumed to match the batch instrument and
+    /// precisions.
+    pub fn push(&mut self, trade: &TradeTick) {
+        debug_assert_eq!(trade.instrument_id, self.instrument_id);
+        self.price.push(trade.price.raw);
+        self.size.push(trade.size.raw);
+        self.aggressor_side.push(trade.aggressor_side);
+        self.trade_id.push(trade.trade_id);
+        self.ts_event.push(trade.ts_event);
+        self.ts_init.push(trade.ts_init);
+    }
+
+    /// Returns the trade at the given `index`.
+    ///
+    /// # Panics
+    ///
+    /// This function panics:
+    /// - If `index` is out of bounds.
+    #[must_use]
+    pub fn get(&self, index: usize) -> TradeTick {
+        TradeTick {
+            instrument_id: self.instrument_id,
+            price: Price::from_raw(self.price[index], self.price_precision),
+            size: Quantity::from_raw(self.size[index], self.size_precision),
+            aggressor_side: self.aggressor_side[index],
+            trade_id: self.trade_id[index],
+            ts_event: self.ts_event[index],
+            ts_init: self.ts_init[index],
+        }
+    }
+}
+
+/// Represents a batch of bars for one bar type held as columns.
+#[derive(Clone, Debug, PartialEq)]
+pub struct BarBatch {
+    /// The bar type for the bars.
+    pub bar_type: BarType,
+    /// The precision of the bar prices.
+    pub price_precision: u8,
+    /// The precision of the bar volumes.
+    pub size_precision: u8,
+    /// The raw open prices.
+    pub open: Vec<i64>,
+    /// The raw high prices.
+    pub high: Vec<i64>,
+    /// The raw low prices.
+    pub low: Vec<i64>,
+    /// The raw close prices.
+    pub close: Vec<i64>,
+    /// The raw volumes.
+    pub volume: Vec<u64>,
+    /// UNIX timestamps (nanoseconds) when the data events occurred.
+    pub ts_event: Vec<UnixNanos>,
+    /// UNIX timestamps (nanoseconds) when the structs were initialized.
+    pub ts_init: Vec<UnixNanos>,
+}
+
+impl BarBatch {
+    /// Creates a new empty [`BarBatch`] instance.
+    #[must_use]
+    pub fn new(bar_type: BarType, price_precision: u8, size_precision: u8) -> Self {
+        Self {
+            bar_type,
+            price_precision,
+            size_precision,
+            open: Vec::new(),
+            high: Vec::new(),
+            low: Vec::new(),
+            close: Vec::new(),
+            volume: Vec::new(),
+            ts_event: Vec::new(),
+            ts_init: Vec::new(),
+        }
+    }
+
+    #[must_use]
+    pub fn len(&self) -> usize {
+        self.ts_init.len()
+    }
+
+    #[must_use]
+    pub fn is_empty(&self) -> bool {
+        self.ts_init.is_empty()
+    }
+
+    /// Appends the given `bar`, which is assumed to match the batch bar type and
+    /// precisions.
+    pub fn push(&mut self, bar: &Bar) {
+        debug_assert_eq!(bar.bar_type, self.bar_type);
+        self.open.push(bar.open.raw);
+        self.high.push(bar.high.raw);
+        self.low.push(bar.low.raw);
+        self.close.push(bar.close.raw);
+        self.volume.push(bar.volume.raw);
+        self.ts_event.push(bar.ts_event);
+        self.ts_init.push(bar.ts_init);
+    }
+
+    /// Returns the bar at the given `index`.
+    ///
+    /// # Panics
+    ///
+    /// This function panics:
+    /// - If `index` is out of bounds.
+    #[must_use]
+    pub fn get(&self, index: usize) -> Bar {
+        Bar {
+            bar_type: self.bar_type,
+            open: Price::from_raw(self.open[index], self.price_precision),
+            high: Price::from_raw(self.high[index], self.price_precision),
+            low: Price::from_raw(self.low[index], self.price_precision),
+            close: Price::from_raw(self.close[index], self.price_precision),
+            volume: Quantity::from_raw(self.volume[index], self.size_precision),
+            ts_event: self.ts_event[index],
+            ts_init: self.ts_init[index],
+        }
+    }
+}
+
+/// Represents a batch of order book deltas for one instrument held as columns.
+#[derive(Clone, Debug, PartialEq)]
+pub struct DeltaBatch {
+    /// The instrument ID for the book.
+    pub instrument_id: InstrumentId,
+    /// The precision of the order prices.
+    pub price_precision: u8,
+    /// The precision of the order sizes.
+    pub size_precision: u8,
+    /// The order book delta actions.
+    pub action: Vec<BookAction>,
+    /// The order sides.
+    pub side: Vec<OrderSide>,
+    /// The raw order prices.
+    pub price: Vec<i64>,
+    /// The raw order sizes.
+    pub size: Vec<u64>,
+    /// The order IDs.
+    pub order_id: Vec<OrderId>,
+    /// The record flags bit fields.
+    pub flags: Vec<u8>,
+    /// The message sequence numbers assigned at the venue.
+    pub sequence: Vec<u64>,
+    /// UNIX timestamps (nanoseconds) when the book events occurred.
+    pub ts_event: Vec<UnixNanos>,
+    /// UNIX timestamps (nanoseconds) when the structs were initialized.
+    pub ts_init: Vec<UnixNanos>,
+}
+
+impl DeltaBatch {
+    /// Creates a new empty [`DeltaBatch`] instance.
+    #[must_use]
+    pub fn new(instrument_id: InstrumentId, price_precision: u8, size_precision: u8) -> Self {
+        Self {
+            instrument_id,
+            price_precision,
+            size_precision,
+            action: Vec::new(),
+            side: Vec::new(),
+            price: Vec::new(),
+            size: Vec::new(),
+            order_id: Vec::new(),
+            flags: Vec::new(),
+            sequence: Vec::new(),
+            ts_event: Vec::new(),
+            ts_init: Vec::new(),
+        }
+    }
+
+    #[must_use]
+    pub fn len(&self) -> usize {
+        self.ts_init.len()
+    }
+
+    #[must_use]
+    pub fn is_empty(&self) -> bool {
+        self.ts_init.is_empty()
+    }
+
+    /// Appends the given `delta`, which is assumed to match the batch instrument and
+    /// precisions.
+    pub fn push(&mut self, delta: &OrderBookDelta) {
+        debug_assert_eq!(delta.instrument_id, self.instrument_id);
+        self.action.push(delta.action);
+        self.side.push(delta.order.side);
+        self.price.push(delta.order.price.raw);
+        self.size.push(delta.order.size.raw);
+        self.order_id.push(delta.order.order_id);
+        self.flags.push(delta.flags);
+        self.sequence.push(delta.sequence);
+        self.ts_event.push(delta.ts_event);
+        self.ts_init.push(delta.ts_init);
+    }
+
+    /// Returns the delta at the given `index`.
+    ///
+    /// # Panics
+    ///
+    /// This function panics:
+    /// - If `index` is out of bounds.
+    #[must_use]
+    pub fn get(&self, index: usize) -> OrderBookDelta {
+        OrderBookDelta {
+            instrument_id: self.instrument_id,
+            action: self.action[index],
+            order: BookOrder {
+                side: self.side[index],
+                price: Price::from_raw(self.price[index], self.price_precision),
+                size: Quantity::from_raw(self.size[index], self.size_precision),
+                order_id: self.order_id[index],
+            },
+            flags: self.flags[index],
+            sequence: self.sequence[index],
+            ts_event: self.ts_event[index],
+            ts_init: self.ts_init[index],
+        }
+    }
+}
+
+/// A columnar batch of one built-in Nautilus data type.
+#[derive(Clone, Debug, PartialEq)]
+pub enum DataBatch {
+    Quote(QuoteTickBatch),
+    Trade(TradeTickBatch),
+    Bar(BarBatch),
+    Delta(DeltaBatch),
+}
+
+impl DataBatch {
+    #[must_use]
+    pub fn len(&self) -> usize {
+        self.ts_init().len()
+    }
+
+    #[must_use]
+    pub fn is_empty(&self) -> bool {
+        self.ts_init().is_empty()
+    }
+
+    /// Returns the `ts_init` column of the batch.
+    #[must_use]
+    pub fn ts_init(&self) -> &[UnixNanos] {
+        match self {
+            Self::Quote(batch) => &batch.ts_init,
+            Self::Trade(batch) => &batch.ts_init,
+            Self::Bar(batch) => &batch.ts_init,
+            Self::Delta(batch) => &batch.ts_init,
+        }
+    }
+
+    /// Returns the row at the given `index` as [`Data`].
+    ///
+    /// # Panics
+    ///
+    /// This function panics:
+    /// - If `index` is out of bounds.
+    #[must_use]
+    pub fn get(&self, index: usize) -> Data {
+        match self {
+            Self::Quote(batch) => Data::Quote(batch.get(index)),
+            Self::Trade(batch) => Data::Trade(batch.get(index)),
+            Self::Bar(batch) => Data::Bar(batch.get(index)),
+            Self::Delta(batch) => Data::Delta(batch.get(index)),
+        }
+    }
+}
+
+impl From<QuoteTickBatch> for DataBatch {
+    fn from(value: QuoteTickBatch) -> Self {
+        Self::Quote(value)
+    }
+}
+
+impl From<TradeTickBatch> for DataBatch {
+    fn from(value: TradeTickBatch) -> Self {
+        Self::Trade(value)
+    }
+}
+
+impl From<BarBatch> for DataBatch {
+    fn from(value: BarBatch) -> Self {
+        Self::Bar(value)
+    }
+}
+
+impl From<DeltaBatch> for DataBatch {
+    fn from(value: DeltaBatch) -> Self {
+        Self::Delta(value)
+    }
+}
+
+/// Represents the position of a row within the batches of a [`BatchMerge`].
+#[derive(Clone, Copy, Debug, PartialEq, Eq, PartialOrd, Ord)]
+pub struct BatchRow {
+    /// The index of the batch, in order of being pushed.
+    pub batch: usize,
+    /// The index of the row within the batch.
+    pub row: usize,
+}
+
+/// Provides a merge of many columnar batches in ascending order of `ts_init`.
+///
+/// Each batch must itself be ordered by `ts_init`. Rows with equal `ts_init` are
+/// yielded in the order their batches were pushed. Only one cursor per batch is held,
+/// so no row is copied out of its batch until it is read.
+#[derive(Clone, Debug, Default)]
+pub struct BatchMerge {
+    batches: Vec<DataBatch>,
+    heap: BinaryHeap<Reverse<(UnixNanos, BatchRow)>>,
+}
+
+impl BatchMerge {
+    /// Creates a new empty [`BatchMerge`] instance.
+    #[must_use]
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    /// Adds the given `batch` to the merge.
+    pub fn push(&mut self, batch: impl Into<DataBatch>) {
+        let batch = batch.into();
+        let index = self.batches.len();
+        if let Some(&ts_init) = batch.ts_init().first() {
+            self.heap.push(Reverse((
+                ts_init,
+                BatchRow {
+                    batch: index,
+                    row: 0,
+                },
+            )));
+        }
+        self.batches.push(batch);
+    }
+
+    #[must_use]
+    pub fn batches(&self) -> &[DataBatch] {
+        &self.batches
+    }
+
+    /// Returns the number of rows not yet yielded.
+    #[must_use]
+    pub fn remaining(&self) -> usize {
+        self.heap
+            .iter()
+            .map(|Reverse((_, pos))| self.batches[pos.batch].len() - pos.row)
+            .sum()
+    }
+
+    #[must_use]
+    pub fn is_exhausted(&self) -> bool {
+        self.heap.is_empty()
+    }
+
+    /// Advances the merge, returning the position of the next row without reading it.
+    pub fn next_row(&mut self) -> Option<BatchRow> {
+        let Reverse((_, pos)) = self.heap.pop()?;
+        let next = pos.row + 1;
+        if let Some(&ts_init) = self.batches[pos.batch].ts_init().get(next) {
+            self.heap.push(Reverse((
+                ts_init,
+                BatchRow {
+                    batch: pos.batch,
+                    row: next,
+                },
+            )));
+        }
+        Some(pos)
+    }
+}
+
+impl Iterator for BatchMerge {
+    type Item = Data;
+
+    fn next(&mut self) -> Option<Self::Item> {
+        let pos = self.next_row()?;
+        Some(self.batches[pos.batch].get(pos.row))
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Tests
+////////////////////////////////////////////////////////////////////////////////
+#[cfg(test)]
+mod tests {
+    use rstest::rstest;
+
+    use super::*;
+    use crate::data::{stubs::*, GetTsInit};
+
+    fn quotes(ts_inits: &[u64]) -> QuoteTickBatch {
+        let quote = quote_tick_ethusdt_binance();
+        let mut batch = QuoteTickBatch::new(
+            quote.instrument_id,
+            quote.bid_price.precision,
+            quote.bid_size.precision,
+        );
+        for &ts_init in ts_inits {
+            batch.push(&QuoteTick {
+                ts_init: ts_init.into(),
+                ..quote.clone()
+            });
+        }
+        batch
+    }
+
+    fn trades(ts_inits: &[u64]) -> TradeTickBatch {
+        let trade = stub_trade_tick_ethusdt_buyer();
+        let mut batch = TradeTickBatch::new(
+            trade.instrument_id,
+            trade.price.precision,
+            trade.size.precision,
+        );
+        for &ts_init in ts_inits {
+            batch.push(&TradeTick {
+                ts_init: ts_init.into(),
+                ..trade.clone()
+            });
+        }
+        batch
+    }
+
+    #[rstest]
+    fn test_batches_round_trip(
+        quote_tick_ethusdt_binance: QuoteTick,
+        stub_trade_tick_ethusdt_buyer: TradeTick,
+        stub_bar: Bar,
+        stub_delta: OrderBookDelta,
+    ) {
+        let mut quotes = QuoteTickBatch::new(
+            quote_tick_ethusdt_binance.instrument_id,
+            quote_tick_ethusdt_binance.bid_price.precision,
+            quote_tick_ethusdt_binance.bid_size.precision,
+        );
+        quotes.push(&quote_tick_ethusdt_binance);
+        let mut trades = TradeTickBatch::new(
+            stub_trade_tick_ethusdt_buyer.instrument_id,
+            stub_trade_tick_ethusdt_buyer.price.precision,
+            stub_trade_tick_ethusdt_buyer.size.precision,
+        );
+        trades.push(&stub_trade_tick_ethusdt_buyer);
+        let mut bars = BarBatch::new(
+            stub_bar.bar_type,
+            stub_bar.open.precision,
+            stub_bar.volume.precision,
+        );
+        bars.push(&stub_bar);
+        let mut deltas = DeltaBatch::new(
+            stub_delta.instrument_id,
+            stub_delta.order.price.precision,
+            stub_delta.order.size.precision,
+        );
+        deltas.push(&stub_delta);
+
+        assert_eq!(quotes.get(0), quote_tick_ethusdt_binance);
+        assert_eq!(trades.get(0), stub_trade_tick_ethusdt_buyer);
+        assert_eq!(bars.get(0), stub_bar);
+        assert_eq!(deltas.get(0), stub_delta);
+    }
+
+    #[rstest]
+    fn test_merge_interleaves_by_ts_init() {
+        let mut merge = BatchMerge::new();
+        merge.push(quotes(&[1, 3, 3, 6]));
+        merge.push(QuoteTickBatch::new(InstrumentId::from("EMPTY.SIM"), 2, 0));
+        merge.push(trades(&[2, 3, 7]));
+
+        assert_eq!(merge.remaining(), 7);
+        let rows: Vec<_> = std::iter::from_fn(|| merge.next_row()).collect();
+        let order: Vec<_> = rows.iter().map(|pos| (pos.batch, pos.row)).collect();
+        assert_eq!(
+            order,
+            vec![(0, 0), (2, 0), (0, 1), (0, 2), (2, 1), (0, 3), (2, 2)]
+        );
+        assert!(merge.is_exhausted());
+    }
+
+    #[rstest]
+    fn test_merge_yields_data() {
+        let mut merge = BatchMerge::new();
+        merge.push(trades(&[2, 4]));
+        merge.push(quotes(&[1, 3]));
+
+        let data: Vec<Data> = merge.collect();
+        let ts_inits: Vec<u64> = data.iter().map(|d| d.ts_init().as_u64()).collect();
+        assert_eq!(ts_inits, vec![1, 2, 3, 4]);
+        assert!(matches!(data[0], Data::Quote(_)));
+        assert!(matches!(data[1], Data::Trade(_)));
+    }
+}
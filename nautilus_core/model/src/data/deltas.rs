@@ -19,16 +19,25 @@ use std::{
     fmt::{Display, Formatter},
     hash::{Hash, Hasher},
     ops::{Deref, DerefMut},
+    sync::Arc,
 };
 
 use nautilus_core::{
     correctness::{check_predicate_true, FAILED},
     nanos::UnixNanos,
 };
+use smallvec::SmallVec;
 
 use super::{delta::OrderBookDelta, GetTsInit};
 use crate::identifiers::InstrumentId;
 
+/// The number of deltas stored inline (without a separate heap allocation) in an
+/// [`OrderBookDeltas`], covering the common small batch sizes.
+pub const DELTAS_INLINE_CAPACITY: usize = 4;
+
+/// The storage for the deltas of an [`OrderBookDeltas`].
+pub type DeltasVec = SmallVec<[OrderBookDelta; DELTAS_INLINE_CAPACITY]>;
+
 /// Represents a grouped batch of `OrderBookDelta` updates for an `OrderBook`.
 ///
 /// This type cannot be `repr(C)` due to the `deltas` vec.
@@ -41,7 +50,7 @@ pub struct OrderBookDeltas {
     /// The instrument ID for the book.
     pub instrument_id: InstrumentId,
     /// The order book deltas.
-    pub deltas: Vec<OrderBookDelta>,
+    pub deltas: DeltasVec,
     /// The record flags bit field, indicating event end and data information.
     pub flags: u8,
     /// The message sequence number assigned at the venue.
@@ -79,7 +88,7 @@ impl OrderBookDeltas {
         let ts_init = last.ts_init;
         Ok(Self {
             instrument_id,
-            deltas,
+            deltas: DeltasVec::from_vec(deltas),
             flags,
             sequence,
             ts_event,
@@ -136,16 +145,25 @@ impl GetTsInit for OrderBookDeltas {
 /// It implements the `Deref` trait, allowing instances of `OrderBookDeltas_API` to be
 /// dereferenced to `OrderBookDeltas`, providing access to `OrderBookDeltas`'s methods without
 /// having to manually access the underlying `OrderBookDeltas` instance.
+///
+/// The underlying `OrderBookDeltas` is reference counted and shared between clones, so cloning
+/// is O(1). Mutable access copies the deltas first if they are shared (copy-on-write).
 #[repr(C)]
 #[derive(Debug, Clone, PartialEq)]
 #[allow(non_camel_case_types)]
-pub struct OrderBookDeltas_API(Box<OrderBookDeltas>);
+pub struct OrderBookDeltas_API(Arc<OrderBookDeltas>);
 
 // TODO: This wrapper will go along with Cython
 impl OrderBookDeltas_API {
     #[must_use]
     pub fn new(deltas: OrderBookDeltas) -> Self {
-        Self(Box::new(deltas))
+        Self(Arc::new(deltas))
+    }
+
+    /// Returns whether `self` and `other` share the same underlying deltas.
+    #[must_use]
+    pub fn ptr_eq(&self, other: &Self) -> bool {
+        Arc::ptr_eq(&self.0, &other.0)
     }
 }
 
@@ -159,7 +177,7 @@ impl Deref for OrderBookDeltas_API {
 
 impl DerefMut for OrderBookDeltas_API {
     fn deref_mut(&mut self) -> &mut Self::Target {
-        &mut self.0
+        Arc::make_mut(&mut self.0)
     }
 }
 
@@ -294,4 +312,39 @@ mod tests {
             "AAPL.XNAS,len=7,flags=32,sequence=0,ts_event=1,ts_init=2".to_string()
         );
     }
+
+    #[rstest]
+    fn test_small_batch_is_inline() {
+        let instrument_id = InstrumentId::from("AAPL.XNAS");
+        let delta = OrderBookDelta::clear(instrument_id, 0, 1.into(), 2.into());
+
+        let deltas = OrderBookDeltas::new(instrument_id, vec![delta; DELTAS_INLINE_CAPACITY]);
+
+        assert!(!deltas.deltas.spilled());
+    }
+
+    #[rstest]
+    fn test_large_batch_spills(stub_deltas: OrderBookDeltas) {
+        assert!(stub_deltas.deltas.spilled());
+    }
+
+    #[rstest]
+    fn test_api_clone_shares_deltas(stub_deltas: OrderBookDeltas) {
+        let deltas = OrderBookDeltas_API::new(stub_deltas);
+        let cloned = deltas.clone();
+
+        assert!(cloned.ptr_eq(&deltas));
+    }
+
+    #[rstest]
+    fn test_api_deref_mut_copies_on_write(stub_deltas: OrderBookDeltas) {
+        let deltas = OrderBookDeltas_API::new(stub_deltas);
+        let mut cloned = deltas.clone();
+
+        cloned.sequence = 1;
+
+        assert!(!cloned.ptr_eq(&deltas));
+        assert_eq!(deltas.sequence, 0);
+        assert_eq!(cloned.sequence, 1);
+    }
 }
@@ -15,8 +15,6 @@
 
 //! Enumerations for the trading domain model.
 
-use std::str::FromStr;
-
 use serde::{Deserialize, Deserializer, Serialize, Serializer};
 use strum::{AsRefStr, Display, EnumIter, EnumString, FromRepr};
 
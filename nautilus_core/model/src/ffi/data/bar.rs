@@ -21,7 +21,7 @@ use std::{
 };
 
 use nautilus_core::{
-    ffi::string::{cstr_to_str, str_to_cstr},
+    ffi::string::{cstr_to_str, str_to_cstr, write_to_cstr_buf},
     nanos::UnixNanos,
 };
 
@@ -283,3 +283,15 @@ pub extern "C" fn bar_hash(bar: &Bar) -> u64 {
 pub extern "C" fn bar_to_cstr(bar: &Bar) -> *const c_char {
     str_to_cstr(&bar.to_string())
 }
+
+/// Writes a [`Bar`] as a nul-terminated C string into the caller provided buffer `buf` of
+/// capacity `len`, returning the full string length (the output was truncated if not less
+/// than `len`).
+///
+/// # Safety
+///
+/// - Assumes `buf` is a valid pointer to a writable array of length `len`.
+#[no_mangle]
+pub unsafe extern "C" fn bar_to_cstr_buf(bar: &Bar, buf: *mut c_char, len: usize) -> usize {
+    write_to_cstr_buf(bar, buf, len)
+}
@@ -0,0 +1,375 @@
+// -------------------------------------------------------------------------------------------------
+//  Copyright (C) 2015-2024 Nautech Systems Pty Ltd. All rights reserved.
+//  https://nautechsystems.io
+//
+//  Licensed under the GNU Lesser General Public License Version 3.0 (the "License");
+//  You may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at https://www.gnu.org/licenses/lgpl-3.0.en.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+// -------------------------------------------------------------------------------------------------
+
+use std::ops::{Deref, DerefMut};
+
+use crate::{
+    data::{
+        bar::{Bar, BarType},
+        batch::{BarBatch, BatchMerge, DeltaBatch, QuoteTickBatch, TradeTickBatch},
+        delta::OrderBookDelta,
+        quote::QuoteTick,
+        trade::TradeTick,
+        Data,
+    },
+    identifiers::InstrumentId,
+};
+
+/// C compatible Foreign Function Interface (FFI) for an underlying `QuoteTickBatch`.
+///
+/// This struct wraps `QuoteTickBatch` in a way that makes it compatible with C function
+/// calls, enabling interaction with `QuoteTickBatch` in a C environment.
+///
+/// It implements the `Deref` trait, allowing instances of `QuoteTickBatch_API` to be
+/// dereferenced to `QuoteTickBatch`, providing access to `QuoteTickBatch`'s methods without
+/// having to manually access the underlying `QuoteTickBatch` instance.
+#[repr(C)]
+#[allow(non_camel_case_types)]
+pub struct QuoteTickBatch_API(Box<QuoteTickBatch>);
+
+impl Deref for QuoteTickBatch_API {
+    type Target = QuoteTickBatch;
+
+    fn deref(&self) -> &Self::Target {
+        &self.0
+    }
+}
+
+impl DerefMut for QuoteTickBatch_API {
+    fn deref_mut(&mut self) -> &mut Self::Target {
+        &mut self.0
+    }
+}
+
+/// C compatible Foreign Function Interface (FFI) for an underlying `TradeTickBatch`.
+///
+/// This struct wraps `TradeTickBatch` in a way that makes it compatible with C function
+/// calls, enabling interaction with `TradeTickBatch` in a C environment.
+///
+/// It implements the `Deref` trait, allowing instances of `TradeTickBatch_API` to be
+/// dereferenced to `TradeTickBatch`, providing access to `TradeTickBatch`'s methods without
+/// having to manually access the underlying `TradeTickBatch` instance.
+#[repr(C)]
+#[allow(non_camel_case_types)]
+pub struct TradeTickBatch_API(Box<TradeTickBatch>);
+
+impl Deref for TradeTickBatch_API {
+    type Target = TradeTickBatch;
+
+    fn deref(&self) -> &Self::Target {
+        &self.0
+    }
+}
+
+impl DerefMut for TradeTickBatch_API {
+    fn deref_mut(&mut self) -> &mut Self::Target {
+        &mut self.0
+    }
+}
+
+/// C compatible Foreign Function Interface (FFI) for an underlying `BarBatch`.
+///
+/// This struct wraps `BarBatch` in a way that makes it compatible with C function
+/// calls, enabling interaction with `BarBatch` in a C environment.
+///
+/// It implements the `Deref` trait, allowing instances of `BarBatch_API` to be
+/// dereferenced to `BarBatch`, providing access to `BarBatch`'s methods without
+/// having to manually access the underlying `BarBatch` instance.
+#[repr(C)]
+#[allow(non_camel_case_types)]
+pub struct BarBatch_API(Box<BarBatch>);
+
+impl Deref for BarBatch_API {
+    type Target = BarBatch;
+
+    fn deref(&self) -> &Self::Target {
+        &self.0
+    }
+}
+
+impl DerefMut for BarBatch_API {
+    fn deref_mut(&mut self) -> &mut Self::Target {
+        &mut self.0
+    }
+}
+
+/// C compatible Foreign Function Interface (FFI) for an underlying `DeltaBatch`.
+///
+/// This struct wraps `DeltaBatch` in a way that makes it compatible with C function
+/// calls, enabling interaction with `DeltaBatch` in a C environment.
+///
+/// It implements the `Deref` trait, allowing instances of `DeltaBatch_API` to be
+/// dereferenced to `DeltaBatch`, providing access to `DeltaBatch`'s methods without
+/// having to manually access the underlying `DeltaBatch` instance.
+#[repr(C)]
+#[allow(non_camel_case_types)]
+pub struct DeltaBatch_API(Box<DeltaBatch>);
+
+impl Deref for DeltaBatch_API {
+    type Target = DeltaBatch;
+
+    fn deref(&self) -> &Self::Target {
+        &self.0
+    }
+}
+
+impl DerefMut for DeltaBatch_API {
+    fn deref_mut(&mut self) -> &mut Self::Target {
+        &mut self.0
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn quote_tick_batch_new(
+    instrument_id: InstrumentId,
+    price_precision: u8,
+    size_precision: u8,
+) -> QuoteTickBatch_API {
+    QuoteTickBatch_API(Box::new(QuoteTickBatch::new(
+        instrument_id,
+        price_precision,
+        size_precision,
+    )))
+}
+
+#[no_mangle]
+pub extern "C" fn quote_tick_batch_drop(batch: QuoteTickBatch_API) {
+    drop(batch); // Memory freed here
+}
+
+#[no_mangle]
+pub extern "C" fn quote_tick_batch_push(batch: &mut QuoteTickBatch_API, quote: &QuoteTick) {
+    batch.push(quote);
+}
+
+#[no_mangle]
+pub extern "C" fn quote_tick_batch_len(batch: &QuoteTickBatch_API) -> usize {
+    batch.len()
+}
+
+/// Returns the row of the batch at the given `index`.
+///
+/// # Panics
+///
+/// This function panics:
+/// - If `index` is out of bounds.
+#[no_mangle]
+pub extern "C" fn quote_tick_batch_get(batch: &QuoteTickBatch_API, index: usize) -> QuoteTick {
+    batch.get(index)
+}
+
+#[no_mangle]
+pub extern "C" fn trade_tick_batch_new(
+    instrument_id: InstrumentId,
+    price_precision: u8,
+    size_precision: u8,
+) -> TradeTickBatch_API {
+    TradeTickBatch_API(Box::new(TradeTickBatch::new(
+        instrument_id,
+        price_precision,
+        size_precision,
+    )))
+}
+
+#[no_mangle]
+pub extern "C" fn trade_tick_batch_drop(batch: TradeTickBatch_API) {
+    drop(batch); // Memory freed here
+}
+
+#[no_mangle]
+pub extern "C" fn trade_tick_batch_push(batch: &mut TradeTickBatch_API, trade: &TradeTick) {
+    batch.push(trade);
+}
+
+#[no_mangle]
+pub extern "C" fn trade_tick_batch_len(batch: &TradeTickBatch_API) -> usize {
+    batch.len()
+}
+
+/// Returns the row of the batch at the given `index`.
+///
+/// # Panics
+///
+/// This function panics:
+/// - If `index` is out of bounds.
+#[no_mangle]
+pub extern "C" fn trade_tick_batch_get(batch: &TradeTickBatch_API, index: usize) -> TradeTick {
+    batch.get(index)
+}
+
+#[no_mangle]
+pub extern "C" fn bar_batch_new(
+    bar_type: BarType,
+    price_precision: u8,
+    size_precision: u8,
+) -> BarBatch_API {
+    BarBatch_API(Box::new(BarBatch::new(
+        bar_type,
+        price_precision,
+        size_precision,
+    )))
+}
+
+#[no_mangle]
+pub extern "C" fn bar_batch_drop(batch: BarBatch_API) {
+    drop(batch); // Memory freed here
+}
+
+#[no_mangle]
+pub extern "C" fn bar_batch_push(batch: &mut BarBatch_API, bar: &Bar) {
+    batch.push(bar);
+}
+
+#[no_mangle]
+pub extern "C" fn bar_batch_len(batch: &BarBatch_API) -> usize {
+    batch.len()
+}
+
+/// Returns the row of the batch at the given `index`.
+///
+/// # Panics
+///
+/// This function panics:
+/// - If `index` is out of bounds.
+#[no_mangle]
+pub extern "C" fn bar_batch_get(batch: &BarBatch_API, index: usize) -> Bar {
+    batch.get(index)
+}
+
+#[no_mangle]
+pub extern "C" fn delta_batch_new(
+    instrument_id: InstrumentId,
+    price_precision: u8,
+    size_precision: u8,
+) -> DeltaBatch_API {
+    DeltaBatch_API(Box::new(DeltaBatch::new(
+        instrument_id,
+        price_precision,
+        size_precision,
+    )))
+}
+
+#[no_mangle]
+pub extern "C" fn delta_batch_drop(batch: DeltaBatch_API) {
+    drop(batch); // Memory freed here
+}
+
+#[no_mangle]
+pub extern "C" fn delta_batch_push(batch: &mut DeltaBatch_API, delta: &OrderBookDelta) {
+    batch.push(delta);
+}
+
+#[no_mangle]
+pub extern "C" fn delta_batch_len(batch: &DeltaBatch_API) -> usize {
+    batch.len()
+}
+
+/// Returns the row of the batch at the given `index`.
+///
+/// # Panics
+///
+/// This function panics:
+/// - If `index` is out of bounds.
+#[no_mangle]
+pub extern "C" fn delta_batch_get(batch: &DeltaBatch_API, index: usize) -> OrderBookDelta {
+    batch.get(index)
+}
+
+/// C compatible Foreign Function Interface (FFI) for an underlying `BatchMerge`.
+///
+/// This struct wraps `BatchMerge` in a way that makes it compatible with C function
+/// calls, enabling interaction with `BatchMerge` in a C environment.
+///
+/// It implements the `Deref` trait, allowing instances of `BatchMerge_API` to be
+/// dereferenced to `BatchMerge`, providing access to `BatchMerge`'s methods without
+/// having to manually access the underlying `BatchMerge` instance.
+#[repr(C)]
+#[allow(non_camel_case_types)]
+pub struct BatchMerge_API(Box<BatchMerge>);
+
+impl Deref for BatchMerge_API {
+    type Target = BatchMerge;
+
+    fn deref(&self) -> &Self::Target {
+        &self.0
+    }
+}
+
+impl DerefMut for BatchMerge_API {
+    fn deref_mut(&mut self) -> &mut Self::Target {
+        &mut self.0
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn batch_merge_new() -> BatchMerge_API {
+    BatchMerge_API(Box::new(BatchMerge::new()))
+}
+
+#[no_mangle]
+pub extern "C" fn batch_merge_drop(merge: BatchMerge_API) {
+    drop(merge); // Memory freed here
+}
+
+/// Adds the batch to the merge, taking ownership of it.
+#[no_mangle]
+pub extern "C" fn batch_merge_push_quote_tick_batch(
+    merge: &mut BatchMerge_API,
+    batch: QuoteTickBatch_API,
+) {
+    merge.push(*batch.0);
+}
+
+/// Adds the batch to the merge, taking ownership of it.
+#[no_mangle]
+pub extern "C" fn batch_merge_push_trade_tick_batch(
+    merge: &mut BatchMerge_API,
+    batch: TradeTickBatch_API,
+) {
+    merge.push(*batch.0);
+}
+
+/// Adds the batch to the merge, taking ownership of it.
+#[no_mangle]
+pub extern "C" fn batch_merge_push_bar_batch(merge: &mut BatchMerge_API, batch: BarBatch_API) {
+    merge.push(*batch.0);
+}
+
+/// Adds the batch to the merge, taking ownership of it.
+#[no_mangle]
+pub extern "C" fn batch_merge_push_delta_batch(merge: &mut BatchMerge_API, batch: DeltaBatch_API) {
+    merge.push(*batch.0);
+}
+
+#[no_mangle]
+pub extern "C" fn batch_merge_remaining(merge: &BatchMerge_API) -> usize {
+    merge.remaining()
+}
+
+#[no_mangle]
+pub extern "C" fn batch_merge_is_exhausted(merge: &BatchMerge_API) -> u8 {
+    u8::from(merge.is_exhausted())
+}
+
+/// Returns the next row of the merge in order of `ts_init`.
+///
+/// # Panics
+///
+/// This function panics:
+/// - If the merge is exhausted.
+#[no_mangle]
+pub extern "C" fn batch_merge_next(merge: &mut BatchMerge_API) -> Data {
+    merge.next().expect("Batch merge exhausted")
+}
@@ -60,7 +60,7 @@ pub extern "C" fn orderbook_deltas_instrument_id(deltas: &OrderBookDeltas_API) -
 
 #[no_mangle]
 pub extern "C" fn orderbook_deltas_vec_deltas(deltas: &OrderBookDeltas_API) -> CVec {
-    deltas.deltas.clone().into()
+    deltas.deltas.to_vec().into()
 }
 
 #[no_mangle]
@@ -14,6 +14,7 @@
 // -------------------------------------------------------------------------------------------------
 
 pub mod bar;
+pub mod batch;
 pub mod delta;
 pub mod deltas;
 pub mod depth;
@@ -19,7 +19,10 @@ use std::{
     hash::{Hash, Hasher},
 };
 
-use nautilus_core::{ffi::string::str_to_cstr, nanos::UnixNanos};
+use nautilus_core::{
+    ffi::string::{str_to_cstr, write_to_cstr_buf},
+    nanos::UnixNanos,
+};
 
 use crate::{
     data::quote::QuoteTick,
@@ -77,3 +80,19 @@ pub extern "C" fn quote_tick_hash(delta: &QuoteTick) -> u64 {
 pub extern "C" fn quote_tick_to_cstr(quote: &QuoteTick) -> *const c_char {
     str_to_cstr(&quote.to_string())
 }
+
+/// Writes a [`QuoteTick`] as a nul-terminated C string into the caller provided buffer `buf` of
+/// capacity `len`, returning the full string length (the output was truncated if not less
+/// than `len`).
+///
+/// # Safety
+///
+/// - Assumes `buf` is a valid pointer to a writable array of length `len`.
+#[no_mangle]
+pub unsafe extern "C" fn quote_tick_to_cstr_buf(
+    quote: &QuoteTick,
+    buf: *mut c_char,
+    len: usize,
+) -> usize {
+    write_to_cstr_buf(quote, buf, len)
+}
@@ -19,7 +19,7 @@ use std::{
     hash::{Hash, Hasher},
 };
 
-use nautilus_core::ffi::string::str_to_cstr;
+use nautilus_core::ffi::string::{str_to_cstr, write_to_cstr_buf};
 
 use crate::{
     data::trade::TradeTick,
@@ -68,3 +68,19 @@ pub extern "C" fn trade_tick_hash(delta: &TradeTick) -> u64 {
 pub extern "C" fn trade_tick_to_cstr(trade: &TradeTick) -> *const c_char {
     str_to_cstr(&trade.to_string())
 }
+
+/// Writes a [`TradeTick`] as a nul-terminated C string into the caller provided buffer `buf` of
+/// capacity `len`, returning the full string length (the output was truncated if not less
+/// than `len`).
+///
+/// # Safety
+///
+/// - Assumes `buf` is a valid pointer to a writable array of length `len`.
+#[no_mangle]
+pub unsafe extern "C" fn trade_tick_to_cstr_buf(
+    trade: &TradeTick,
+    buf: *mut c_char,
+    len: usize,
+) -> usize {
+    write_to_cstr_buf(trade, buf, len)
+}
@@ -13,9 +13,12 @@
 //  limitations under the License.
 // -------------------------------------------------------------------------------------------------
 
-use std::{ffi::c_char, str::FromStr};
+use std::ffi::c_char;
 
-use nautilus_core::ffi::string::{cstr_to_str, str_to_cstr};
+use nautilus_core::{
+    enum_table::EnumStrs,
+    ffi::parsing::{enum_codes_from_cstr_array, enum_from_cstr},
+};
 
 use crate::enums::{
     AccountType, AggregationSource, AggressorSide, AssetClass, BarAggregation, BookAction,
@@ -25,9 +28,10 @@ use crate::enums::{
     TriggerType,
 };
 
+/// Returns the enum name as a C string pointer to static storage (must not be freed).
 #[no_mangle]
 pub extern "C" fn account_type_to_cstr(value: AccountType) -> *const c_char {
-    str_to_cstr(value.as_ref())
+    value.as_static_cstr().as_ptr()
 }
 
 /// Returns an enum from a Python string.
@@ -37,14 +41,28 @@ pub extern "C" fn account_type_to_cstr(value: AccountType) -> *const c_char {
 /// - Assumes `ptr` is a valid C string pointer.
 #[no_mangle]
 pub unsafe extern "C" fn account_type_from_cstr(ptr: *const c_char) -> AccountType {
-    let value = cstr_to_str(ptr);
-    AccountType::from_str(value)
-        .unwrap_or_else(|_| panic!("invalid `AccountType` enum string value, was '{value}'"))
+    enum_from_cstr(ptr)
 }
 
+/// Parses the array of C strings `ptrs` of length `len` into `out` as [`AccountType`] codes.
+///
+/// # Safety
+///
+/// - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+/// - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+#[no_mangle]
+pub unsafe extern "C" fn account_type_from_cstr_array(
+    ptrs: *const *const c_char,
+    len: usize,
+    out: *mut u8,
+) {
+    enum_codes_from_cstr_array::<AccountType>(ptrs, len, out);
+}
+
+/// Returns the enum name as a C string pointer to static storage (must not be freed).
 #[no_mangle]
 pub extern "C" fn aggregation_source_to_cstr(value: AggregationSource) -> *const c_char {
-    str_to_cstr(value.as_ref())
+    value.as_static_cstr().as_ptr()
 }
 
 /// Returns an enum from a Python string.
@@ -54,14 +72,28 @@ pub extern "C" fn aggregation_source_to_cstr(value: AggregationSource) -> *const
 /// - Assumes `ptr` is a valid C string pointer.
 #[no_mangle]
 pub unsafe extern "C" fn aggregation_source_from_cstr(ptr: *const c_char) -> AggregationSource {
-    let value = cstr_to_str(ptr);
-    AggregationSource::from_str(value)
-        .unwrap_or_else(|_| panic!("invalid `AggregationSource` enum string value, was '{value}'"))
+    enum_from_cstr(ptr)
+}
+
+/// Parses the array of C strings `ptrs` of length `len` into `out` as [`AggregationSource`] codes.
+///
+/// # Safety
+///
+/// - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+/// - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+#[no_mangle]
+pub unsafe extern "C" fn aggregation_source_from_cstr_array(
+    ptrs: *const *const c_char,
+    len: usize,
+    out: *mut u8,
+) {
+    enum_codes_from_cstr_array::<AggregationSource>(ptrs, len, out);
 }
 
+/// Returns the enum name as a C string pointer to static storage (must not be freed).
 #[no_mangle]
 pub extern "C" fn aggressor_side_to_cstr(value: AggressorSide) -> *const c_char {
-    str_to_cstr(value.as_ref())
+    value.as_static_cstr().as_ptr()
 }
 
 /// Returns an enum from a Python string.
@@ -71,14 +103,28 @@ pub extern "C" fn aggressor_side_to_cstr(value: AggressorSide) -> *const c_char
 /// - Assumes `ptr` is a valid C string pointer.
 #[no_mangle]
 pub unsafe extern "C" fn aggressor_side_from_cstr(ptr: *const c_char) -> AggressorSide {
-    let value = cstr_to_str(ptr);
-    AggressorSide::from_str(value)
-        .unwrap_or_else(|_| panic!("invalid `AggressorSide` enum string value, was '{value}'"))
+    enum_from_cstr(ptr)
 }
 
+/// Parses the array of C strings `ptrs` of length `len` into `out` as [`AggressorSide`] codes.
+///
+/// # Safety
+///
+/// - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+/// - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+#[no_mangle]
+pub unsafe extern "C" fn aggressor_side_from_cstr_array(
+    ptrs: *const *const c_char,
+    len: usize,
+    out: *mut u8,
+) {
+    enum_codes_from_cstr_array::<AggressorSide>(ptrs, len, out);
+}
+
+/// Returns the enum name as a C string pointer to static storage (must not be freed).
 #[no_mangle]
 pub extern "C" fn asset_class_to_cstr(value: AssetClass) -> *const c_char {
-    str_to_cstr(value.as_ref())
+    value.as_static_cstr().as_ptr()
 }
 
 /// Returns an enum from a Python string.
@@ -88,14 +134,28 @@ pub extern "C" fn asset_class_to_cstr(value: AssetClass) -> *const c_char {
 /// - Assumes `ptr` is a valid C string pointer.
 #[no_mangle]
 pub unsafe extern "C" fn asset_class_from_cstr(ptr: *const c_char) -> AssetClass {
-    let value = cstr_to_str(ptr);
-    AssetClass::from_str(value)
-        .unwrap_or_else(|_| panic!("invalid `AssetClass` enum string value, was '{value}'"))
+    enum_from_cstr(ptr)
+}
+
+/// Parses the array of C strings `ptrs` of length `len` into `out` as [`AssetClass`] codes.
+///
+/// # Safety
+///
+/// - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+/// - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+#[no_mangle]
+pub unsafe extern "C" fn asset_class_from_cstr_array(
+    ptrs: *const *const c_char,
+    len: usize,
+    out: *mut u8,
+) {
+    enum_codes_from_cstr_array::<AssetClass>(ptrs, len, out);
 }
 
+/// Returns the enum name as a C string pointer to static storage (must not be freed).
 #[no_mangle]
 pub extern "C" fn instrument_class_to_cstr(value: InstrumentClass) -> *const c_char {
-    str_to_cstr(value.as_ref())
+    value.as_static_cstr().as_ptr()
 }
 
 /// Returns an enum from a Python string.
@@ -105,14 +165,28 @@ pub extern "C" fn instrument_class_to_cstr(value: InstrumentClass) -> *const c_c
 /// - Assumes `ptr` is a valid C string pointer.
 #[no_mangle]
 pub unsafe extern "C" fn instrument_class_from_cstr(ptr: *const c_char) -> InstrumentClass {
-    let value = cstr_to_str(ptr);
-    InstrumentClass::from_str(value)
-        .unwrap_or_else(|_| panic!("invalid `InstrumentClass` enum string value, was '{value}'"))
+    enum_from_cstr(ptr)
 }
 
+/// Parses the array of C strings `ptrs` of length `len` into `out` as [`InstrumentClass`] codes.
+///
+/// # Safety
+///
+/// - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+/// - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+#[no_mangle]
+pub unsafe extern "C" fn instrument_class_from_cstr_array(
+    ptrs: *const *const c_char,
+    len: usize,
+    out: *mut u8,
+) {
+    enum_codes_from_cstr_array::<InstrumentClass>(ptrs, len, out);
+}
+
+/// Returns the enum name as a C string pointer to static storage (must not be freed).
 #[no_mangle]
 pub extern "C" fn bar_aggregation_to_cstr(value: BarAggregation) -> *const c_char {
-    str_to_cstr(value.as_ref())
+    value.as_static_cstr().as_ptr()
 }
 
 /// Returns an enum from a Python string.
@@ -122,14 +196,28 @@ pub extern "C" fn bar_aggregation_to_cstr(value: BarAggregation) -> *const c_cha
 /// - Assumes `ptr` is a valid C string pointer.
 #[no_mangle]
 pub unsafe extern "C" fn bar_aggregation_from_cstr(ptr: *const c_char) -> BarAggregation {
-    let value = cstr_to_str(ptr);
-    BarAggregation::from_str(value)
-        .unwrap_or_else(|_| panic!("invalid `BarAggregation` enum string value, was '{value}'"))
+    enum_from_cstr(ptr)
+}
+
+/// Parses the array of C strings `ptrs` of length `len` into `out` as [`BarAggregation`] codes.
+///
+/// # Safety
+///
+/// - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+/// - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+#[no_mangle]
+pub unsafe extern "C" fn bar_aggregation_from_cstr_array(
+    ptrs: *const *const c_char,
+    len: usize,
+    out: *mut u8,
+) {
+    enum_codes_from_cstr_array::<BarAggregation>(ptrs, len, out);
 }
 
+/// Returns the enum name as a C string pointer to static storage (must not be freed).
 #[no_mangle]
 pub extern "C" fn book_action_to_cstr(value: BookAction) -> *const c_char {
-    str_to_cstr(value.as_ref())
+    value.as_static_cstr().as_ptr()
 }
 
 /// Returns an enum from a Python string.
@@ -139,14 +227,28 @@ pub extern "C" fn book_action_to_cstr(value: BookAction) -> *const c_char {
 /// - Assumes `ptr` is a valid C string pointer.
 #[no_mangle]
 pub unsafe extern "C" fn book_action_from_cstr(ptr: *const c_char) -> BookAction {
-    let value = cstr_to_str(ptr);
-    BookAction::from_str(value)
-        .unwrap_or_else(|_| panic!("invalid `BookAction` enum string value, was '{value}'"))
+    enum_from_cstr(ptr)
 }
 
+/// Parses the array of C strings `ptrs` of length `len` into `out` as [`BookAction`] codes.
+///
+/// # Safety
+///
+/// - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+/// - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+#[no_mangle]
+pub unsafe extern "C" fn book_action_from_cstr_array(
+    ptrs: *const *const c_char,
+    len: usize,
+    out: *mut u8,
+) {
+    enum_codes_from_cstr_array::<BookAction>(ptrs, len, out);
+}
+
+/// Returns the enum name as a C string pointer to static storage (must not be freed).
 #[no_mangle]
 pub extern "C" fn book_type_to_cstr(value: BookType) -> *const c_char {
-    str_to_cstr(value.as_ref())
+    value.as_static_cstr().as_ptr()
 }
 
 /// Returns an enum from a Python string.
@@ -156,14 +258,28 @@ pub extern "C" fn book_type_to_cstr(value: BookType) -> *const c_char {
 /// - Assumes `ptr` is a valid C string pointer.
 #[no_mangle]
 pub unsafe extern "C" fn book_type_from_cstr(ptr: *const c_char) -> BookType {
-    let value = cstr_to_str(ptr);
-    BookType::from_str(value)
-        .unwrap_or_else(|_| panic!("invalid `BookType` enum string value, was '{value}'"))
+    enum_from_cstr(ptr)
 }
 
+/// Parses the array of C strings `ptrs` of length `len` into `out` as [`BookType`] codes.
+///
+/// # Safety
+///
+/// - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+/// - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+#[no_mangle]
+pub unsafe extern "C" fn book_type_from_cstr_array(
+    ptrs: *const *const c_char,
+    len: usize,
+    out: *mut u8,
+) {
+    enum_codes_from_cstr_array::<BookType>(ptrs, len, out);
+}
+
+/// Returns the enum name as a C string pointer to static storage (must not be freed).
 #[no_mangle]
 pub extern "C" fn contingency_type_to_cstr(value: ContingencyType) -> *const c_char {
-    str_to_cstr(value.as_ref())
+    value.as_static_cstr().as_ptr()
 }
 
 /// Returns an enum from a Python string.
@@ -173,14 +289,28 @@ pub extern "C" fn contingency_type_to_cstr(value: ContingencyType) -> *const c_c
 /// - Assumes `ptr` is a valid C string pointer.
 #[no_mangle]
 pub unsafe extern "C" fn contingency_type_from_cstr(ptr: *const c_char) -> ContingencyType {
-    let value = cstr_to_str(ptr);
-    ContingencyType::from_str(value)
-        .unwrap_or_else(|_| panic!("invalid `ContingencyType` enum string value, was '{value}'"))
+    enum_from_cstr(ptr)
+}
+
+/// Parses the array of C strings `ptrs` of length `len` into `out` as [`ContingencyType`] codes.
+///
+/// # Safety
+///
+/// - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+/// - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+#[no_mangle]
+pub unsafe extern "C" fn contingency_type_from_cstr_array(
+    ptrs: *const *const c_char,
+    len: usize,
+    out: *mut u8,
+) {
+    enum_codes_from_cstr_array::<ContingencyType>(ptrs, len, out);
 }
 
+/// Returns the enum name as a C string pointer to static storage (must not be freed).
 #[no_mangle]
 pub extern "C" fn currency_type_to_cstr(value: CurrencyType) -> *const c_char {
-    str_to_cstr(value.as_ref())
+    value.as_static_cstr().as_ptr()
 }
 
 /// Returns an enum from a Python string.
@@ -190,9 +320,28 @@ pub extern "C" fn currency_type_to_cstr(value: CurrencyType) -> *const c_char {
 /// - Assumes `ptr` is a valid C string pointer.
 #[no_mangle]
 pub unsafe extern "C" fn currency_type_from_cstr(ptr: *const c_char) -> CurrencyType {
-    let value = cstr_to_str(ptr);
-    CurrencyType::from_str(value)
-        .unwrap_or_else(|_| panic!("invalid `CurrencyType` enum string value, was '{value}'"))
+    enum_from_cstr(ptr)
+}
+
+/// Parses the array of C strings `ptrs` of length `len` into `out` as [`CurrencyType`] codes.
+///
+/// # Safety
+///
+/// - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+/// - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+#[no_mangle]
+pub unsafe extern "C" fn currency_type_from_cstr_array(
+    ptrs: *const *const c_char,
+    len: usize,
+    out: *mut u8,
+) {
+    enum_codes_from_cstr_array::<CurrencyType>(ptrs, len, out);
+}
+
+/// Returns the enum name as a C string pointer to static storage (must not be freed).
+#[no_mangle]
+pub extern "C" fn instrument_close_type_to_cstr(value: InstrumentCloseType) -> *const c_char {
+    value.as_static_cstr().as_ptr()
 }
 
 /// Returns an enum from a Python string.
@@ -204,20 +353,28 @@ pub unsafe extern "C" fn currency_type_from_cstr(ptr: *const c_char) -> Currency
 pub unsafe extern "C" fn instrument_close_type_from_cstr(
     ptr: *const c_char,
 ) -> InstrumentCloseType {
-    let value = cstr_to_str(ptr);
-    InstrumentCloseType::from_str(value).unwrap_or_else(|_| {
-        panic!("invalid `InstrumentCloseType` enum string value, was '{value}'")
-    })
+    enum_from_cstr(ptr)
 }
 
+/// Parses the array of C strings `ptrs` of length `len` into `out` as [`InstrumentCloseType`] codes.
+///
+/// # Safety
+///
+/// - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+/// - Assumes `out` is a valid pointer to a `u8` array of length `len`.
 #[no_mangle]
-pub extern "C" fn instrument_close_type_to_cstr(value: InstrumentCloseType) -> *const c_char {
-    str_to_cstr(value.as_ref())
+pub unsafe extern "C" fn instrument_close_type_from_cstr_array(
+    ptrs: *const *const c_char,
+    len: usize,
+    out: *mut u8,
+) {
+    enum_codes_from_cstr_array::<InstrumentCloseType>(ptrs, len, out);
 }
 
+/// Returns the enum name as a C string pointer to static storage (must not be freed).
 #[no_mangle]
 pub extern "C" fn liquidity_side_to_cstr(value: LiquiditySide) -> *const c_char {
-    str_to_cstr(value.as_ref())
+    value.as_static_cstr().as_ptr()
 }
 
 /// Returns an enum from a Python string.
@@ -227,14 +384,28 @@ pub extern "C" fn liquidity_side_to_cstr(value: LiquiditySide) -> *const c_char
 /// - Assumes `ptr` is a valid C string pointer.
 #[no_mangle]
 pub unsafe extern "C" fn liquidity_side_from_cstr(ptr: *const c_char) -> LiquiditySide {
-    let value = cstr_to_str(ptr);
-    LiquiditySide::from_str(value)
-        .unwrap_or_else(|_| panic!("invalid `LiquiditySide` enum string value, was '{value}'"))
+    enum_from_cstr(ptr)
 }
 
+/// Parses the array of C strings `ptrs` of length `len` into `out` as [`LiquiditySide`] codes.
+///
+/// # Safety
+///
+/// - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+/// - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+#[no_mangle]
+pub unsafe extern "C" fn liquidity_side_from_cstr_array(
+    ptrs: *const *const c_char,
+    len: usize,
+    out: *mut u8,
+) {
+    enum_codes_from_cstr_array::<LiquiditySide>(ptrs, len, out);
+}
+
+/// Returns the enum name as a C string pointer to static storage (must not be freed).
 #[no_mangle]
 pub extern "C" fn market_status_to_cstr(value: MarketStatus) -> *const c_char {
-    str_to_cstr(value.as_ref())
+    value.as_static_cstr().as_ptr()
 }
 
 /// Returns an enum from a Python string.
@@ -244,14 +415,28 @@ pub extern "C" fn market_status_to_cstr(value: MarketStatus) -> *const c_char {
 /// - Assumes `ptr` is a valid C string pointer.
 #[no_mangle]
 pub unsafe extern "C" fn market_status_from_cstr(ptr: *const c_char) -> MarketStatus {
-    let value = cstr_to_str(ptr);
-    MarketStatus::from_str(value)
-        .unwrap_or_else(|_| panic!("invalid `MarketStatus` enum string value, was '{value}'"))
+    enum_from_cstr(ptr)
 }
 
+/// Parses the array of C strings `ptrs` of length `len` into `out` as [`MarketStatus`] codes.
+///
+/// # Safety
+///
+/// - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+/// - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+#[no_mangle]
+pub unsafe extern "C" fn market_status_from_cstr_array(
+    ptrs: *const *const c_char,
+    len: usize,
+    out: *mut u8,
+) {
+    enum_codes_from_cstr_array::<MarketStatus>(ptrs, len, out);
+}
+
+/// Returns the enum name as a C string pointer to static storage (must not be freed).
 #[no_mangle]
 pub extern "C" fn market_status_action_to_cstr(value: MarketStatusAction) -> *const c_char {
-    str_to_cstr(value.as_ref())
+    value.as_static_cstr().as_ptr()
 }
 
 /// Returns an enum from a Python string.
@@ -261,14 +446,28 @@ pub extern "C" fn market_status_action_to_cstr(value: MarketStatusAction) -> *co
 /// - Assumes `ptr` is a valid C string pointer.
 #[no_mangle]
 pub unsafe extern "C" fn market_status_action_from_cstr(ptr: *const c_char) -> MarketStatusAction {
-    let value = cstr_to_str(ptr);
-    MarketStatusAction::from_str(value)
-        .unwrap_or_else(|_| panic!("invalid `MarketStatusAction` enum string value, was '{value}'"))
+    enum_from_cstr(ptr)
+}
+
+/// Parses the array of C strings `ptrs` of length `len` into `out` as [`MarketStatusAction`] codes.
+///
+/// # Safety
+///
+/// - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+/// - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+#[no_mangle]
+pub unsafe extern "C" fn market_status_action_from_cstr_array(
+    ptrs: *const *const c_char,
+    len: usize,
+    out: *mut u8,
+) {
+    enum_codes_from_cstr_array::<MarketStatusAction>(ptrs, len, out);
 }
 
+/// Returns the enum name as a C string pointer to static storage (must not be freed).
 #[no_mangle]
 pub extern "C" fn oms_type_to_cstr(value: OmsType) -> *const c_char {
-    str_to_cstr(value.as_ref())
+    value.as_static_cstr().as_ptr()
 }
 
 /// Returns an enum from a Python string.
@@ -278,14 +477,28 @@ pub extern "C" fn oms_type_to_cstr(value: OmsType) -> *const c_char {
 /// - Assumes `ptr` is a valid C string pointer.
 #[no_mangle]
 pub unsafe extern "C" fn oms_type_from_cstr(ptr: *const c_char) -> OmsType {
-    let value = cstr_to_str(ptr);
-    OmsType::from_str(value)
-        .unwrap_or_else(|_| panic!("invalid `OmsType` enum string value, was '{value}'"))
+    enum_from_cstr(ptr)
 }
 
+/// Parses the array of C strings `ptrs` of length `len` into `out` as [`OmsType`] codes.
+///
+/// # Safety
+///
+/// - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+/// - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+#[no_mangle]
+pub unsafe extern "C" fn oms_type_from_cstr_array(
+    ptrs: *const *const c_char,
+    len: usize,
+    out: *mut u8,
+) {
+    enum_codes_from_cstr_array::<OmsType>(ptrs, len, out);
+}
+
+/// Returns the enum name as a C string pointer to static storage (must not be freed).
 #[no_mangle]
 pub extern "C" fn option_kind_to_cstr(value: OptionKind) -> *const c_char {
-    str_to_cstr(value.as_ref())
+    value.as_static_cstr().as_ptr()
 }
 
 /// Returns an enum from a Python string.
@@ -295,14 +508,28 @@ pub extern "C" fn option_kind_to_cstr(value: OptionKind) -> *const c_char {
 /// - Assumes `ptr` is a valid C string pointer.
 #[no_mangle]
 pub unsafe extern "C" fn option_kind_from_cstr(ptr: *const c_char) -> OptionKind {
-    let value = cstr_to_str(ptr);
-    OptionKind::from_str(value)
-        .unwrap_or_else(|_| panic!("invalid `OptionKind` enum string value, was '{value}'"))
+    enum_from_cstr(ptr)
+}
+
+/// Parses the array of C strings `ptrs` of length `len` into `out` as [`OptionKind`] codes.
+///
+/// # Safety
+///
+/// - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+/// - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+#[no_mangle]
+pub unsafe extern "C" fn option_kind_from_cstr_array(
+    ptrs: *const *const c_char,
+    len: usize,
+    out: *mut u8,
+) {
+    enum_codes_from_cstr_array::<OptionKind>(ptrs, len, out);
 }
 
+/// Returns the enum name as a C string pointer to static storage (must not be freed).
 #[no_mangle]
 pub extern "C" fn order_side_to_cstr(value: OrderSide) -> *const c_char {
-    str_to_cstr(value.as_ref())
+    value.as_static_cstr().as_ptr()
 }
 
 /// Returns an enum from a Python string.
@@ -312,14 +539,28 @@ pub extern "C" fn order_side_to_cstr(value: OrderSide) -> *const c_char {
 /// - Assumes `ptr` is a valid C string pointer.
 #[no_mangle]
 pub unsafe extern "C" fn order_side_from_cstr(ptr: *const c_char) -> OrderSide {
-    let value = cstr_to_str(ptr);
-    OrderSide::from_str(value)
-        .unwrap_or_else(|_| panic!("invalid `OrderSide` enum string value, was '{value}'"))
+    enum_from_cstr(ptr)
 }
 
+/// Parses the array of C strings `ptrs` of length `len` into `out` as [`OrderSide`] codes.
+///
+/// # Safety
+///
+/// - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+/// - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+#[no_mangle]
+pub unsafe extern "C" fn order_side_from_cstr_array(
+    ptrs: *const *const c_char,
+    len: usize,
+    out: *mut u8,
+) {
+    enum_codes_from_cstr_array::<OrderSide>(ptrs, len, out);
+}
+
+/// Returns the enum name as a C string pointer to static storage (must not be freed).
 #[no_mangle]
 pub extern "C" fn order_status_to_cstr(value: OrderStatus) -> *const c_char {
-    str_to_cstr(value.as_ref())
+    value.as_static_cstr().as_ptr()
 }
 
 /// Returns an enum from a Python string.
@@ -329,14 +570,28 @@ pub extern "C" fn order_status_to_cstr(value: OrderStatus) -> *const c_char {
 /// - Assumes `ptr` is a valid C string pointer.
 #[no_mangle]
 pub unsafe extern "C" fn order_status_from_cstr(ptr: *const c_char) -> OrderStatus {
-    let value = cstr_to_str(ptr);
-    OrderStatus::from_str(value)
-        .unwrap_or_else(|_| panic!("invalid `OrderStatus` enum string value, was '{value}'"))
+    enum_from_cstr(ptr)
+}
+
+/// Parses the array of C strings `ptrs` of length `len` into `out` as [`OrderStatus`] codes.
+///
+/// # Safety
+///
+/// - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+/// - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+#[no_mangle]
+pub unsafe extern "C" fn order_status_from_cstr_array(
+    ptrs: *const *const c_char,
+    len: usize,
+    out: *mut u8,
+) {
+    enum_codes_from_cstr_array::<OrderStatus>(ptrs, len, out);
 }
 
+/// Returns the enum name as a C string pointer to static storage (must not be freed).
 #[no_mangle]
 pub extern "C" fn order_type_to_cstr(value: OrderType) -> *const c_char {
-    str_to_cstr(value.as_ref())
+    value.as_static_cstr().as_ptr()
 }
 
 /// Returns an enum from a Python string.
@@ -346,14 +601,28 @@ pub extern "C" fn order_type_to_cstr(value: OrderType) -> *const c_char {
 /// - Assumes `ptr` is a valid C string pointer.
 #[no_mangle]
 pub unsafe extern "C" fn order_type_from_cstr(ptr: *const c_char) -> OrderType {
-    let value = cstr_to_str(ptr);
-    OrderType::from_str(value)
-        .unwrap_or_else(|_| panic!("invalid `OrderType` enum string value, was '{value}'"))
+    enum_from_cstr(ptr)
 }
 
+/// Parses the array of C strings `ptrs` of length `len` into `out` as [`OrderType`] codes.
+///
+/// # Safety
+///
+/// - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+/// - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+#[no_mangle]
+pub unsafe extern "C" fn order_type_from_cstr_array(
+    ptrs: *const *const c_char,
+    len: usize,
+    out: *mut u8,
+) {
+    enum_codes_from_cstr_array::<OrderType>(ptrs, len, out);
+}
+
+/// Returns the enum name as a C string pointer to static storage (must not be freed).
 #[no_mangle]
 pub extern "C" fn position_side_to_cstr(value: PositionSide) -> *const c_char {
-    str_to_cstr(value.as_ref())
+    value.as_static_cstr().as_ptr()
 }
 
 /// Returns an enum from a Python string.
@@ -363,14 +632,28 @@ pub extern "C" fn position_side_to_cstr(value: PositionSide) -> *const c_char {
 /// - Assumes `ptr` is a valid C string pointer.
 #[no_mangle]
 pub unsafe extern "C" fn position_side_from_cstr(ptr: *const c_char) -> PositionSide {
-    let value = cstr_to_str(ptr);
-    PositionSide::from_str(value)
-        .unwrap_or_else(|_| panic!("invalid `PositionSide` enum string value, was '{value}'"))
+    enum_from_cstr(ptr)
+}
+
+/// Parses the array of C strings `ptrs` of length `len` into `out` as [`PositionSide`] codes.
+///
+/// # Safety
+///
+/// - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+/// - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+#[no_mangle]
+pub unsafe extern "C" fn position_side_from_cstr_array(
+    ptrs: *const *const c_char,
+    len: usize,
+    out: *mut u8,
+) {
+    enum_codes_from_cstr_array::<PositionSide>(ptrs, len, out);
 }
 
+/// Returns the enum name as a C string pointer to static storage (must not be freed).
 #[no_mangle]
 pub extern "C" fn price_type_to_cstr(value: PriceType) -> *const c_char {
-    str_to_cstr(value.as_ref())
+    value.as_static_cstr().as_ptr()
 }
 
 /// Returns an enum from a Python string.
@@ -380,14 +663,28 @@ pub extern "C" fn price_type_to_cstr(value: PriceType) -> *const c_char {
 /// - Assumes `ptr` is a valid C string pointer.
 #[no_mangle]
 pub unsafe extern "C" fn price_type_from_cstr(ptr: *const c_char) -> PriceType {
-    let value = cstr_to_str(ptr);
-    PriceType::from_str(value)
-        .unwrap_or_else(|_| panic!("invalid `PriceType` enum string value, was '{value}'"))
+    enum_from_cstr(ptr)
 }
 
+/// Parses the array of C strings `ptrs` of length `len` into `out` as [`PriceType`] codes.
+///
+/// # Safety
+///
+/// - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+/// - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+#[no_mangle]
+pub unsafe extern "C" fn price_type_from_cstr_array(
+    ptrs: *const *const c_char,
+    len: usize,
+    out: *mut u8,
+) {
+    enum_codes_from_cstr_array::<PriceType>(ptrs, len, out);
+}
+
+/// Returns the enum name as a C string pointer to static storage (must not be freed).
 #[no_mangle]
 pub extern "C" fn record_flag_to_cstr(value: RecordFlag) -> *const c_char {
-    str_to_cstr(value.as_ref())
+    value.as_static_cstr().as_ptr()
 }
 
 /// Returns an enum from a Python string.
@@ -397,14 +694,28 @@ pub extern "C" fn record_flag_to_cstr(value: RecordFlag) -> *const c_char {
 /// - Assumes `ptr` is a valid C string pointer.
 #[no_mangle]
 pub unsafe extern "C" fn record_flag_from_cstr(ptr: *const c_char) -> RecordFlag {
-    let value = cstr_to_str(ptr);
-    RecordFlag::from_str(value)
-        .unwrap_or_else(|_| panic!("invalid `RecordFlag` enum string value, was '{value}'"))
+    enum_from_cstr(ptr)
 }
 
+/// Parses the array of C strings `ptrs` of length `len` into `out` as [`RecordFlag`] codes.
+///
+/// # Safety
+///
+/// - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+/// - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+#[no_mangle]
+pub unsafe extern "C" fn record_flag_from_cstr_array(
+    ptrs: *const *const c_char,
+    len: usize,
+    out: *mut u8,
+) {
+    enum_codes_from_cstr_array::<RecordFlag>(ptrs, len, out);
+}
+
+/// Returns the enum name as a C string pointer to static storage (must not be freed).
 #[no_mangle]
 pub extern "C" fn time_in_force_to_cstr(value: TimeInForce) -> *const c_char {
-    str_to_cstr(value.as_ref())
+    value.as_static_cstr().as_ptr()
 }
 
 /// Returns an enum from a Python string.
@@ -414,14 +725,28 @@ pub extern "C" fn time_in_force_to_cstr(value: TimeInForce) -> *const c_char {
 /// - Assumes `ptr` is a valid C string pointer.
 #[no_mangle]
 pub unsafe extern "C" fn time_in_force_from_cstr(ptr: *const c_char) -> TimeInForce {
-    let value = cstr_to_str(ptr);
-    TimeInForce::from_str(value)
-        .unwrap_or_else(|_| panic!("invalid `TimeInForce` enum string value, was '{value}'"))
+    enum_from_cstr(ptr)
 }
 
+/// Parses the array of C strings `ptrs` of length `len` into `out` as [`TimeInForce`] codes.
+///
+/// # Safety
+///
+/// - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+/// - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+#[no_mangle]
+pub unsafe extern "C" fn time_in_force_from_cstr_array(
+    ptrs: *const *const c_char,
+    len: usize,
+    out: *mut u8,
+) {
+    enum_codes_from_cstr_array::<TimeInForce>(ptrs, len, out);
+}
+
+/// Returns the enum name as a C string pointer to static storage (must not be freed).
 #[no_mangle]
 pub extern "C" fn trading_state_to_cstr(value: TradingState) -> *const c_char {
-    str_to_cstr(value.as_ref())
+    value.as_static_cstr().as_ptr()
 }
 
 /// Returns an enum from a Python string.
@@ -431,14 +756,28 @@ pub extern "C" fn trading_state_to_cstr(value: TradingState) -> *const c_char {
 /// - Assumes `ptr` is a valid C string pointer.
 #[no_mangle]
 pub unsafe extern "C" fn trading_state_from_cstr(ptr: *const c_char) -> TradingState {
-    let value = cstr_to_str(ptr);
-    TradingState::from_str(value)
-        .unwrap_or_else(|_| panic!("invalid `TradingState` enum string value, was '{value}'"))
+    enum_from_cstr(ptr)
+}
+
+/// Parses the array of C strings `ptrs` of length `len` into `out` as [`TradingState`] codes.
+///
+/// # Safety
+///
+/// - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+/// - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+#[no_mangle]
+pub unsafe extern "C" fn trading_state_from_cstr_array(
+    ptrs: *const *const c_char,
+    len: usize,
+    out: *mut u8,
+) {
+    enum_codes_from_cstr_array::<TradingState>(ptrs, len, out);
 }
 
+/// Returns the enum name as a C string pointer to static storage (must not be freed).
 #[no_mangle]
 pub extern "C" fn trailing_offset_type_to_cstr(value: TrailingOffsetType) -> *const c_char {
-    str_to_cstr(value.as_ref())
+    value.as_static_cstr().as_ptr()
 }
 
 /// Returns an enum from a Python string.
@@ -448,14 +787,28 @@ pub extern "C" fn trailing_offset_type_to_cstr(value: TrailingOffsetType) -> *co
 /// - Assumes `ptr` is a valid C string pointer.
 #[no_mangle]
 pub unsafe extern "C" fn trailing_offset_type_from_cstr(ptr: *const c_char) -> TrailingOffsetType {
-    let value = cstr_to_str(ptr);
-    TrailingOffsetType::from_str(value)
-        .unwrap_or_else(|_| panic!("invalid `TrailingOffsetType` enum string value, was '{value}'"))
+    enum_from_cstr(ptr)
+}
+
+/// Parses the array of C strings `ptrs` of length `len` into `out` as [`TrailingOffsetType`] codes.
+///
+/// # Safety
+///
+/// - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+/// - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+#[no_mangle]
+pub unsafe extern "C" fn trailing_offset_type_from_cstr_array(
+    ptrs: *const *const c_char,
+    len: usize,
+    out: *mut u8,
+) {
+    enum_codes_from_cstr_array::<TrailingOffsetType>(ptrs, len, out);
 }
 
+/// Returns the enum name as a C string pointer to static storage (must not be freed).
 #[no_mangle]
 pub extern "C" fn trigger_type_to_cstr(value: TriggerType) -> *const c_char {
-    str_to_cstr(value.as_ref())
+    value.as_static_cstr().as_ptr()
 }
 
 /// Returns an enum from a Python string.
@@ -465,13 +818,28 @@ pub extern "C" fn trigger_type_to_cstr(value: TriggerType) -> *const c_char {
 /// - Assumes `ptr` is a valid C string pointer.
 #[no_mangle]
 pub unsafe extern "C" fn trigger_type_from_cstr(ptr: *const c_char) -> TriggerType {
-    let value = cstr_to_str(ptr);
-    TriggerType::from_str(value)
-        .unwrap_or_else(|_| panic!("invalid `TriggerType` enum string value, was '{value}'"))
+    enum_from_cstr(ptr)
+}
+
+/// Parses the array of C strings `ptrs` of length `len` into `out` as [`TriggerType`] codes.
+///
+/// # Safety
+///
+/// - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+/// - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+#[no_mangle]
+pub unsafe extern "C" fn trigger_type_from_cstr_array(
+    ptrs: *const *const c_char,
+    len: usize,
+    out: *mut u8,
+) {
+    enum_codes_from_cstr_array::<TriggerType>(ptrs, len, out);
 }
 
 #[cfg(test)]
 mod tests {
+    use std::ffi::{CStr, CString};
+
     use rstest::rstest;
 
     use super::*;
@@ -489,4 +857,38 @@ mod tests {
         assert_eq!(OrderSide::Buy.value(), 1);
         assert_eq!(OrderSide::Sell.value(), 2);
     }
+
+    #[rstest]
+    fn test_to_cstr_is_static() {
+        let ptr = order_side_to_cstr(OrderSide::Buy);
+        assert_eq!(ptr, order_side_to_cstr(OrderSide::Buy));
+        assert_eq!(unsafe { CStr::from_ptr(ptr) }, c"BUY");
+    }
+
+    #[rstest]
+    #[case("BUY", OrderSide::Buy)]
+    #[case("sell", OrderSide::Sell)]
+    #[case("No_Order_Side", OrderSide::NoOrderSide)]
+    fn test_from_cstr(#[case] value: &str, #[case] expected: OrderSide) {
+        let value = CString::new(value).unwrap();
+        assert_eq!(unsafe { order_side_from_cstr(value.as_ptr()) }, expected);
+    }
+
+    #[rstest]
+    #[should_panic(expected = "invalid `OrderSide` enum string value, was 'HOLD'")]
+    fn test_from_cstr_invalid() {
+        let value = CString::new("HOLD").unwrap();
+        let _ = unsafe { order_side_from_cstr(value.as_ptr()) };
+    }
+
+    #[rstest]
+    fn test_from_cstr_array() {
+        let values = ["F_LAST", "f_snapshot", "F_TOB"].map(|s| CString::new(s).unwrap());
+        let ptrs: Vec<*const c_char> = values.iter().map(|s| s.as_ptr()).collect();
+        let mut out = [0u8; 3];
+
+        unsafe { record_flag_from_cstr_array(ptrs.as_ptr(), ptrs.len(), out.as_mut_ptr()) };
+
+        assert_eq!(out, [128, 32, 64]);
+    }
 }
@@ -20,7 +20,7 @@ use std::{
     str::FromStr,
 };
 
-use nautilus_core::ffi::string::{cstr_to_str, str_to_cstr};
+use nautilus_core::ffi::string::{cstr_to_str, str_to_cstr, write_to_cstr_buf};
 
 use crate::identifiers::{InstrumentId, Symbol, Venue};
 
@@ -58,6 +58,22 @@ pub extern "C" fn instrument_id_to_cstr(instrument_id: &InstrumentId) -> *const
     str_to_cstr(&instrument_id.to_string())
 }
 
+/// Writes an [`InstrumentId`] as a nul-terminated C string into the caller provided buffer
+/// `buf` of capacity `len`, returning the full string length (the output was truncated if not
+/// less than `len`).
+///
+/// # Safety
+///
+/// - Assumes `buf` is a valid pointer to a writable array of length `len`.
+#[no_mangle]
+pub unsafe extern "C" fn instrument_id_to_cstr_buf(
+    instrument_id: &InstrumentId,
+    buf: *mut c_char,
+    len: usize,
+) -> usize {
+    write_to_cstr_buf(instrument_id, buf, len)
+}
+
 #[no_mangle]
 pub extern "C" fn instrument_id_hash(instrument_id: &InstrumentId) -> u64 {
     let mut h = DefaultHasher::new();
@@ -0,0 +1,84 @@
+// -------------------------------------------------------------------------------------------------
+//  Copyright (C) 2015-2024 Nautech Systems Pty Ltd. All rights reserved.
+//  https://nautechsystems.io
+//
+//  Licensed under the GNU Lesser General Public License Version 3.0 (the "License");
+//  You may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at https://www.gnu.org/licenses/lgpl-3.0.en.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+// -------------------------------------------------------------------------------------------------
+
+use std::ffi::c_char;
+
+use nautilus_core::ffi::string::cstr_to_str;
+
+use crate::identifiers::interner::{
+    intern_bulk, interner_stats, reset_interner_stats, InternerStats,
+};
+
+/// Returns a snapshot of the global string interner statistics.
+#[no_mangle]
+pub extern "C" fn interner_stats_get() -> InternerStats {
+    interner_stats()
+}
+
+/// Resets the global string interner counters to zero.
+#[no_mangle]
+pub extern "C" fn interner_stats_reset() {
+    reset_interner_stats();
+}
+
+/// Interns each C string in the array `ptrs` of length `len` in turn, returning the number of
+/// strings newly added to the cache.
+///
+/// # Safety
+///
+/// - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+#[no_mangle]
+pub unsafe extern "C" fn interner_preload(ptrs: *const *const c_char, len: usize) -> usize {
+    if len == 0 {
+        return 0;
+    }
+    assert!(!ptrs.is_null(), "`ptrs` was NULL");
+    let ptrs = std::slice::from_raw_parts(ptrs, len);
+    intern_bulk(ptrs.iter().map(|&ptr| cstr_to_str(ptr)))
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Tests
+////////////////////////////////////////////////////////////////////////////////
+#[cfg(test)]
+mod tests {
+    use std::ffi::CString;
+
+    use rstest::rstest;
+    use ustr::Ustr;
+
+    use super::*;
+
+    #[rstest]
+    fn test_interner_preload() {
+        let values = [
+            CString::new("FFI-INTERNER-TEST-1").unwrap(),
+            CString::new("FFI-INTERNER-TEST-2").unwrap(),
+            CString::new("FFI-INTERNER-TEST-1").unwrap(),
+        ];
+        let ptrs: Vec<*const c_char> = values.iter().map(|s| s.as_ptr()).collect();
+
+        let inserted = unsafe { interner_preload(ptrs.as_ptr(), ptrs.len()) };
+
+        assert_eq!(inserted, 2);
+        assert!(Ustr::from_existing("FFI-INTERNER-TEST-2").is_some());
+        assert!(interner_stats_get().entries >= 2);
+    }
+
+    #[rstest]
+    fn test_interner_preload_empty() {
+        assert_eq!(unsafe { interner_preload(std::ptr::null(), 0) }, 0);
+    }
+}
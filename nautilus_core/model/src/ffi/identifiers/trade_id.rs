@@ -31,6 +31,11 @@ pub unsafe extern "C" fn trade_id_new(ptr: *const c_char) -> TradeId {
     TradeId::from_cstr(CStr::from_ptr(ptr).to_owned())
 }
 
+#[no_mangle]
+pub extern "C" fn trade_id_eq(lhs: &TradeId, rhs: &TradeId) -> u8 {
+    u8::from(lhs == rhs)
+}
+
 #[no_mangle]
 pub extern "C" fn trade_id_hash(id: &TradeId) -> u64 {
     let mut hasher = DefaultHasher::new();
@@ -38,6 +43,7 @@ pub extern "C" fn trade_id_hash(id: &TradeId) -> u64 {
     hasher.finish()
 }
 
+/// Returns a [`TradeId`] as a C string pointer borrowed from `trade_id` (must not be freed).
 #[no_mangle]
 pub extern "C" fn trade_id_to_cstr(trade_id: &TradeId) -> *const c_char {
     trade_id.to_cstr().as_ptr()
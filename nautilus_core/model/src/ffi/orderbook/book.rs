@@ -28,7 +28,10 @@ use crate::{
     },
     enums::{BookType, OrderSide},
     identifiers::InstrumentId,
-    orderbook::{analysis::book_check_integrity, book::OrderBook},
+    orderbook::{
+        analysis::book_check_integrity, book::OrderBook, sequencer::DeltaSequencer,
+        snapshot::read_snapshots, top::TopOfBook,
+    },
     types::{price::Price, quantity::Quantity},
 };
 
@@ -44,6 +47,13 @@ use crate::{
 #[allow(non_camel_case_types)]
 pub struct OrderBook_API(Box<OrderBook>);
 
+impl OrderBook_API {
+    #[must_use]
+    pub fn new(book: OrderBook) -> Self {
+        Self(Box::new(book))
+    }
+}
+
 impl Deref for OrderBook_API {
     type Target = OrderBook;
 
@@ -63,6 +73,132 @@ pub extern "C" fn orderbook_new(instrument_id: InstrumentId, book_type: BookType
     OrderBook_API(Box::new(OrderBook::new(instrument_id, book_type)))
 }
 
+#[no_mangle]
+pub extern "C" fn orderbook_new_tick_indexed(
+    instrument_id: InstrumentId,
+    book_type: BookType,
+    price_increment: Price,
+    capacity: usize,
+) -> OrderBook_API {
+    OrderBook_API(Box::new(OrderBook::new_tick_indexed(
+        instrument_id,
+        book_type,
+        price_increment,
+        capacity,
+    )))
+}
+
+/// Returns a binary snapshot of the order book as a `CVec` of bytes.
+///
+/// The returned `CVec` must be freed with `cvec_drop`.
+#[no_mangle]
+pub extern "C" fn orderbook_snapshot_to_bytes(book: &OrderBook_API) -> CVec {
+    book.to_snapshot_bytes().into()
+}
+
+/// Restores an order book from a binary snapshot, writing it to `book`.
+///
+/// Returns 1 on success, or 0 if the bytes are not a valid order book snapshot, in
+/// which case nothing is written.
+///
+/// # Safety
+///
+/// - Assumes `data` is a valid pointer to an array of bytes of length `len`.
+/// - Assumes `book` is a valid pointer which the restored book may be written to
+///   without dropping its contents.
+#[no_mangle]
+pub unsafe extern "C" fn orderbook_restore_from_bytes(
+    data: *const u8,
+    len: usize,
+    book: *mut OrderBook_API,
+) -> u8 {
+    if data.is_null() || book.is_null() {
+        return 0;
+    }
+    let bytes = std::slice::from_raw_parts(data, len);
+    match OrderBook::from_snapshot_bytes(bytes) {
+        Ok(restored) => {
+            book.write(OrderBook_API(Box::new(restored)));
+            1
+        }
+        Err(_) => 0,
+    }
+}
+
+/// Restores many order books from binary snapshots in parallel, writing them to `books`.
+///
+/// Returns 1 on success, or 0 if any of the snapshots is not a valid order book
+/// snapshot, in which case all restored books are dropped and nothing is written.
+///
+/// # Safety
+///
+/// - Assumes `data` and `lens` are valid pointers to arrays of length `count`, where
+///   each `data[i]` is a valid pointer to an array of bytes of length `lens[i]`.
+/// - Assumes `books` is a valid pointer to an array of length `count` which the
+///   restored books may be written to without dropping its contents.
+#[no_mangle]
+pub unsafe extern "C" fn orderbook_restore_many_from_bytes(
+    data: *const *const u8,
+    lens: *const usize,
+    count: usize,
+    books: *mut OrderBook_API,
+) -> u8 {
+    if count == 0 {
+        return 1;
+    }
+    if data.is_null() || lens.is_null() || books.is_null() {
+        return 0;
+    }
+
+    let data = std::slice::from_raw_parts(data, count);
+    let lens = std::slice::from_raw_parts(lens, count);
+    if data.iter().any(|ptr| ptr.is_null()) {
+        return 0;
+    }
+    let snapshots: Vec<&[u8]> = data
+        .iter()
+        .zip(lens)
+        .map(|(&ptr, &len)| std::slice::from_raw_parts(ptr, len))
+        .collect();
+
+    let restored: Result<Vec<OrderBook>, _> = read_snapshots(&snapshots).into_iter().collect();
+    match restored {
+        Ok(restored) => {
+            for (i, book) in restored.into_iter().enumerate() {
+                books.add(i).write(OrderBook_API(Box::new(book)));
+            }
+            1
+        }
+        Err(_) => 0,
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn orderbook_new_depth10(instrument_id: InstrumentId) -> OrderBook_API {
+    OrderBook_API(Box::new(OrderBook::new_depth10(instrument_id)))
+}
+
+/// Returns whether the book holds its levels in tick-indexed ladders.
+#[no_mangle]
+pub extern "C" fn orderbook_is_tick_indexed(book: &OrderBook_API) -> u8 {
+    u8::from(book.price_increment().is_some())
+}
+
+/// Returns the price increment of the tick-indexed ladders, or a zero price with zero
+/// precision if the book is not tick-indexed.
+#[no_mangle]
+pub extern "C" fn orderbook_price_increment(book: &OrderBook_API) -> Price {
+    book.price_increment()
+        .unwrap_or_else(|| Price::from_raw(0, 0))
+}
+
+/// Returns whether the book is in fixed depth mode, loading depth snapshots into fixed
+/// MBP-10 arrays.
+#[no_mangle]
+pub extern "C" fn orderbook_is_fixed_depth(book: &OrderBook_API) -> u8 {
+    u8::from(book.is_fixed_depth())
+}
+
 #[no_mangle]
 pub extern "C" fn orderbook_drop(book: OrderBook_API) {
     drop(book); // Memory freed here
@@ -73,6 +209,44 @@ pub extern "C" fn orderbook_reset(book: &mut OrderBook_API) {
     book.reset();
 }
 
+#[no_mangle]
+pub extern "C" fn orderbook_enable_cumulative_depth(book: &mut OrderBook_API) {
+    book.enable_cumulative_depth();
+}
+
+#[no_mangle]
+pub extern "C" fn orderbook_has_cumulative_depth(book: &OrderBook_API) -> u8 {
+    u8::from(book.has_cumulative_depth())
+}
+
+#[no_mangle]
+pub extern "C" fn orderbook_enable_sequencing(book: &mut OrderBook_API, capacity: usize) {
+    book.enable_sequencing(capacity);
+}
+
+#[no_mangle]
+pub extern "C" fn orderbook_is_stale(book: &OrderBook_API) -> u8 {
+    u8::from(book.is_stale())
+}
+
+/// Returns the number of sequence gaps detected, or zero if sequencing is not enabled.
+#[no_mangle]
+pub extern "C" fn orderbook_sequence_gaps(book: &OrderBook_API) -> u64 {
+    book.sequencer().map_or(0, DeltaSequencer::gaps)
+}
+
+/// Returns the number of duplicate or late deltas dropped, or zero if sequencing is not enabled.
+#[no_mangle]
+pub extern "C" fn orderbook_sequence_dropped(book: &OrderBook_API) -> u64 {
+    book.sequencer().map_or(0, DeltaSequencer::dropped)
+}
+
+/// Returns the number of deltas held for reordering, or zero if sequencing is not enabled.
+#[no_mangle]
+pub extern "C" fn orderbook_sequence_pending(book: &OrderBook_API) -> usize {
+    book.sequencer().map_or(0, DeltaSequencer::pending_len)
+}
+
 #[no_mangle]
 pub extern "C" fn orderbook_instrument_id(book: &OrderBook_API) -> InstrumentId {
     book.instrument_id
@@ -157,6 +331,26 @@ pub extern "C" fn orderbook_apply_deltas(book: &mut OrderBook_API, deltas: &Orde
     book.apply_deltas(deltas.deref());
 }
 
+/// Applies a contiguous array of deltas to the order book, borrowed in place.
+///
+/// # Safety
+///
+/// - Assumes `deltas` is a valid pointer to an array of `OrderBookDelta` of length `len`.
+#[no_mangle]
+pub unsafe extern "C" fn orderbook_apply_deltas_raw(
+    book: &mut OrderBook_API,
+    deltas: *const OrderBookDelta,
+    len: usize,
+) {
+    if len == 0 {
+        return;
+    }
+    assert!(!deltas.is_null(), "`deltas` was NULL");
+
+    let deltas = std::slice::from_raw_parts(deltas, len);
+    book.apply_delta_slice(deltas);
+}
+
 #[no_mangle]
 pub extern "C" fn orderbook_apply_depth(book: &mut OrderBook_API, depth: &OrderBookDepth10) {
     book.apply_depth(depth);
@@ -164,9 +358,7 @@ pub extern "C" fn orderbook_apply_depth(book: &mut OrderBook_API, depth: &OrderB
 
 #[no_mangle]
 pub extern "C" fn orderbook_bids(book: &mut OrderBook_API) -> CVec {
-    book.bids
-        .levels
-        .values()
+    book.bids()
         .map(|level| Level_API::new(level.clone()))
         .collect::<Vec<Level_API>>()
         .into()
@@ -174,14 +366,68 @@ pub extern "C" fn orderbook_bids(book: &mut OrderBook_API) -> CVec {
 
 #[no_mangle]
 pub extern "C" fn orderbook_asks(book: &mut OrderBook_API) -> CVec {
-    book.asks
-        .levels
-        .values()
+    book.asks()
         .map(|level| Level_API::new(level.clone()))
         .collect::<Vec<Level_API>>()
         .into()
 }
 
+/// Writes up to `len` of the top bid levels into the caller provided column buffers,
+/// returning the number of levels written.
+///
+/// # Safety
+///
+/// - Assumes `prices`, `sizes` and `counts` are valid pointers to arrays of length `len`.
+#[no_mangle]
+pub unsafe extern "C" fn orderbook_bids_depth(
+    book: &OrderBook_API,
+    prices: *mut i64,
+    sizes: *mut u64,
+    counts: *mut u32,
+    len: usize,
+) -> usize {
+    if len == 0 {
+        return 0;
+    }
+    assert!(
+        !prices.is_null() && !sizes.is_null() && !counts.is_null(),
+        "depth buffer was NULL"
+    );
+    book.bids_depth(
+        std::slice::from_raw_parts_mut(prices, len),
+        std::slice::from_raw_parts_mut(sizes, len),
+        std::slice::from_raw_parts_mut(counts, len),
+    )
+}
+
+/// Writes up to `len` of the top ask levels into the caller provided column buffers,
+/// returning the number of levels written.
+///
+/// # Safety
+///
+/// - Assumes `prices`, `sizes` and `counts` are valid pointers to arrays of length `len`.
+#[no_mangle]
+pub unsafe extern "C" fn orderbook_asks_depth(
+    book: &OrderBook_API,
+    prices: *mut i64,
+    sizes: *mut u64,
+    counts: *mut u32,
+    len: usize,
+) -> usize {
+    if len == 0 {
+        return 0;
+    }
+    assert!(
+        !prices.is_null() && !sizes.is_null() && !counts.is_null(),
+        "depth buffer was NULL"
+    );
+    book.asks_depth(
+        std::slice::from_raw_parts_mut(prices, len),
+        std::slice::from_raw_parts_mut(sizes, len),
+        std::slice::from_raw_parts_mut(counts, len),
+    )
+}
+
 #[no_mangle]
 pub extern "C" fn orderbook_has_bid(book: &mut OrderBook_API) -> u8 {
     u8::from(book.has_bid())
@@ -216,6 +462,11 @@ pub extern "C" fn orderbook_best_ask_size(book: &mut OrderBook_API) -> Quantity
         .expect("Error: No ask orders for best ask size")
 }
 
+#[no_mangle]
+pub extern "C" fn orderbook_top_of_book(book: &OrderBook_API) -> TopOfBook {
+    book.top_of_book()
+}
+
 #[no_mangle]
 pub extern "C" fn orderbook_spread(book: &mut OrderBook_API) -> f64 {
     book.spread()
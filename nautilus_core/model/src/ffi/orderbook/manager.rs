@@ -0,0 +1,156 @@
+// -------------------------------------------------------------------------------------------------
+//  Copyright (C) 2015-2024 Nautech Systems Pty Ltd. All rights reserved.
+//  https://nautechsystems.io
+//
+//  Licensed under the GNU Lesser General Public License Version 3.0 (the "License");
+//  You may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at https://www.gnu.org/licenses/lgpl-3.0.en.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+// -------------------------------------------------------------------------------------------------
+
+use std::ops::Deref;
+
+use super::book::OrderBook_API;
+use crate::{
+    data::Data,
+    enums::BookType,
+    identifiers::InstrumentId,
+    orderbook::{book::OrderBook, manager::BookManager, top::TopOfBook},
+};
+
+/// C compatible Foreign Function Interface (FFI) for an underlying `BookManager`.
+///
+/// This struct wraps `BookManager` in a way that makes it compatible with C function
+/// calls, enabling interaction with `BookManager` in a C environment.
+///
+/// It implements the `Deref` trait, allowing instances of `BookManager_API` to be
+/// dereferenced to `BookManager`, providing access to `BookManager`'s methods without
+/// having to manually access the underlying `BookManager` instance.
+#[repr(C)]
+#[allow(non_camel_case_types)]
+pub struct BookManager_API(Box<BookManager>);
+
+impl Deref for BookManager_API {
+    type Target = BookManager;
+
+    fn deref(&self) -> &Self::Target {
+        &self.0
+    }
+}
+
+/// Creates a new book manager with `num_workers` worker threads, each pinned to a CPU
+/// core if `pin_workers` is non-zero (Linux only).
+#[no_mangle]
+pub extern "C" fn book_manager_new(
+    num_workers: usize,
+    book_type: BookType,
+    pin_workers: u8,
+) -> BookManager_API {
+    BookManager_API(Box::new(BookManager::new(
+        num_workers,
+        book_type,
+        pin_workers != 0,
+    )))
+}
+
+/// Stops the worker threads of the manager and drops its books.
+#[no_mangle]
+pub extern "C" fn book_manager_drop(manager: BookManager_API) {
+    drop(manager); // Memory freed here
+}
+
+/// Adds a copy of the given book to the manager, replacing any book for the same
+/// instrument.
+///
+/// Returns 1 on success, or 0 if the worker owning the instrument has stopped.
+#[no_mangle]
+pub extern "C" fn book_manager_add_book(manager: &BookManager_API, book: &OrderBook_API) -> u8 {
+    u8::from(manager.add_book(OrderBook::clone(book)).is_ok())
+}
+
+/// Routes a batch of interleaved data to the workers of the manager.
+///
+/// Ownership of every element is moved into the manager, so the caller must not use or
+/// drop the elements of the array afterwards (the array itself remains owned by the
+/// caller). Returns 1 on success, or 0 if a worker has stopped.
+///
+/// # Safety
+///
+/// - Assumes `data` is a valid pointer to an array of `Data` of length `len`.
+#[no_mangle]
+pub unsafe extern "C" fn book_manager_apply(
+    manager: &BookManager_API,
+    data: *mut Data,
+    len: usize,
+) -> u8 {
+    if len == 0 {
+        return 1;
+    }
+    if data.is_null() {
+        return 0;
+    }
+    let data = (0..len).map(|i| std::ptr::read(data.add(i)));
+    u8::from(manager.apply(data.collect::<Vec<Data>>()).is_ok())
+}
+
+/// Blocks until all data passed to the manager so far has been applied.
+///
+/// Returns 1 on success, or 0 if a worker has stopped.
+#[no_mangle]
+pub extern "C" fn book_manager_flush(manager: &BookManager_API) -> u8 {
+    u8::from(manager.flush().is_ok())
+}
+
+#[no_mangle]
+pub extern "C" fn book_manager_has_book(
+    manager: &BookManager_API,
+    instrument_id: InstrumentId,
+) -> u8 {
+    u8::from(manager.contains(&instrument_id))
+}
+
+#[no_mangle]
+pub extern "C" fn book_manager_top_of_book(
+    manager: &BookManager_API,
+    instrument_id: InstrumentId,
+) -> TopOfBook {
+    manager.top_of_book(&instrument_id).unwrap_or_default()
+}
+
+/// Writes a copy of the book for the given instrument to `book`, taken after all data
+/// passed to the manager so far has been applied.
+///
+/// Returns 1 if a book was written, or 0 if no book exists for the instrument or its
+/// worker has stopped.
+///
+/// # Safety
+///
+/// - Assumes `book` is a valid pointer which the book may be written to without dropping
+///   its contents.
+#[no_mangle]
+pub unsafe extern "C" fn book_manager_snapshot(
+    manager: &BookManager_API,
+    instrument_id: InstrumentId,
+    book: *mut OrderBook_API,
+) -> u8 {
+    if book.is_null() {
+        return 0;
+    }
+    match manager.snapshot(&instrument_id) {
+        Ok(Some(snapshot)) => {
+            book.write(OrderBook_API::new(snapshot));
+            1
+        }
+        _ => 0,
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn book_manager_count(manager: &BookManager_API) -> usize {
+    manager.len()
+}
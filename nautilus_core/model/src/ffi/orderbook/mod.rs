@@ -15,3 +15,5 @@
 
 pub mod book;
 pub mod level;
+pub mod manager;
+pub mod top;
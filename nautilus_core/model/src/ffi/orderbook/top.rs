@@ -0,0 +1,63 @@
+// -------------------------------------------------------------------------------------------------
+//  Copyright (C) 2015-2024 Nautech Systems Pty Ltd. All rights reserved.
+//  https://nautechsystems.io
+//
+//  Licensed under the GNU Lesser General Public License Version 3.0 (the "License");
+//  You may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at https://www.gnu.org/licenses/lgpl-3.0.en.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+// -------------------------------------------------------------------------------------------------
+
+use std::ops::Deref;
+
+use super::book::OrderBook_API;
+use crate::orderbook::top::{TopOfBook, TopOfBookHandle};
+
+/// C compatible Foreign Function Interface (FFI) for an underlying `TopOfBookHandle`.
+///
+/// This struct wraps `TopOfBookHandle` in a way that makes it compatible with C function
+/// calls, enabling interaction with `TopOfBookHandle` in a C environment.
+///
+/// It implements the `Deref` trait, allowing instances of `TopOfBookHandle_API` to be
+/// dereferenced to `TopOfBookHandle`, providing access to `TopOfBookHandle`'s methods without
+/// having to manually access the underlying `TopOfBookHandle` instance.
+#[repr(C)]
+#[derive(Clone)]
+#[allow(non_camel_case_types)]
+pub struct TopOfBookHandle_API(Box<TopOfBookHandle>);
+
+impl Deref for TopOfBookHandle_API {
+    type Target = TopOfBookHandle;
+
+    fn deref(&self) -> &Self::Target {
+        &self.0
+    }
+}
+
+/// Returns a handle to the top of book published by `book`, starting publishing if needed.
+///
+/// The handle may be read from any thread, and remains valid after the book is dropped.
+#[no_mangle]
+pub extern "C" fn orderbook_top_of_book_handle(book: &mut OrderBook_API) -> TopOfBookHandle_API {
+    TopOfBookHandle_API(Box::new(book.top_of_book_handle()))
+}
+
+#[no_mangle]
+pub extern "C" fn top_of_book_handle_clone(handle: &TopOfBookHandle_API) -> TopOfBookHandle_API {
+    handle.clone()
+}
+
+#[no_mangle]
+pub extern "C" fn top_of_book_handle_drop(handle: TopOfBookHandle_API) {
+    drop(handle); // Memory freed here
+}
+
+#[no_mangle]
+pub extern "C" fn top_of_book_handle_read(handle: &TopOfBookHandle_API) -> TopOfBook {
+    handle.read()
+}
@@ -15,7 +15,13 @@
 
 use std::ops::{AddAssign, SubAssign};
 
-use crate::types::price::Price;
+use crate::types::{
+    kernels::{
+        compare_fixed_i64_arrays, f64_to_fixed_i64_array, fixed_i64_max, fixed_i64_min,
+        fixed_i64_sum, fixed_i64_to_f64_array, parse_fixed_i64_delimited, rescale_fixed_i64_array,
+    },
+    price::Price,
+};
 
 // TODO: Document panic
 #[no_mangle]
@@ -43,3 +49,178 @@ pub extern "C" fn price_add_assign(mut a: Price, b: Price) {
 pub extern "C" fn price_sub_assign(mut a: Price, b: Price) {
     a.sub_assign(b);
 }
+
+/// Converts `len` values to raw `Price` values with the given `precision`.
+///
+/// # Safety
+///
+/// - Assumes `values` and `out` are valid pointers to arrays of length `len`.
+#[no_mangle]
+pub unsafe extern "C" fn price_raw_from_f64_array(
+    values: *const f64,
+    precision: u8,
+    out: *mut i64,
+    len: usize,
+) {
+    if len == 0 {
+        return;
+    }
+    assert!(!values.is_null(), "`values` was NULL");
+    assert!(!out.is_null(), "`out` was NULL");
+    let values = std::slice::from_raw_parts(values, len);
+    let out = std::slice::from_raw_parts_mut(out, len);
+    f64_to_fixed_i64_array(values, precision, out);
+}
+
+/// Converts `len` raw `Price` values to `f64` values.
+///
+/// # Safety
+///
+/// - Assumes `raws` and `out` are valid pointers to arrays of length `len`.
+#[no_mangle]
+pub unsafe extern "C" fn price_raw_to_f64_array(raws: *const i64, out: *mut f64, len: usize) {
+    if len == 0 {
+        return;
+    }
+    assert!(!raws.is_null(), "`raws` was NULL");
+    assert!(!out.is_null(), "`out` was NULL");
+    let raws = std::slice::from_raw_parts(raws, len);
+    let out = std::slice::from_raw_parts_mut(out, len);
+    fixed_i64_to_f64_array(raws, out);
+}
+
+/// Rounds `len` raw `Price` values in place to the given `precision`.
+///
+/// # Safety
+///
+/// - Assumes `raws` is a valid pointer to an array of length `len`.
+#[no_mangle]
+pub unsafe extern "C" fn price_raw_rescale_array(raws: *mut i64, len: usize, precision: u8) {
+    if len == 0 {
+        return;
+    }
+    assert!(!raws.is_null(), "`raws` was NULL");
+    let raws = std::slice::from_raw_parts_mut(raws, len);
+    rescale_fixed_i64_array(raws, precision);
+}
+
+/// Returns the minimum of `len` raw `Price` values (`i64::MAX` if `len` is zero).
+///
+/// # Safety
+///
+/// - Assumes `raws` is a valid pointer to an array of length `len`.
+#[no_mangle]
+pub unsafe extern "C" fn price_raw_min(raws: *const i64, len: usize) -> i64 {
+    if len == 0 {
+        return i64::MAX;
+    }
+    assert!(!raws.is_null(), "`raws` was NULL");
+    fixed_i64_min(std::slice::from_raw_parts(raws, len)).unwrap()
+}
+
+/// Returns the maximum of `len` raw `Price` values (`i64::MIN` if `len` is zero).
+///
+/// # Safety
+///
+/// - Assumes `raws` is a valid pointer to an array of length `len`.
+#[no_mangle]
+pub unsafe extern "C" fn price_raw_max(raws: *const i64, len: usize) -> i64 {
+    if len == 0 {
+        return i64::MIN;
+    }
+    assert!(!raws.is_null(), "`raws` was NULL");
+    fixed_i64_max(std::slice::from_raw_parts(raws, len)).unwrap()
+}
+
+/// Returns the sum of `len` raw `Price` values.
+///
+/// # Safety
+///
+/// - Assumes `raws` is a valid pointer to an array of length `len`.
+///
+/// # Panics
+///
+/// This function panics:
+/// - If the sum overflows `i64`.
+#[no_mangle]
+pub unsafe extern "C" fn price_raw_sum(raws: *const i64, len: usize) -> i64 {
+    if len == 0 {
+        return 0;
+    }
+    assert!(!raws.is_null(), "`raws` was NULL");
+    let sum = fixed_i64_sum(std::slice::from_raw_parts(raws, len));
+    i64::try_from(sum).expect("sum overflowed `i64`")
+}
+
+/// Compares `len` raw `Price` values element-wise, writing -1, 0 or 1 to `out`.
+///
+/// # Safety
+///
+/// - Assumes `lhs`, `rhs` and `out` are valid pointers to arrays of length `len`.
+#[no_mangle]
+pub unsafe extern "C" fn price_raw_compare_arrays(
+    lhs: *const i64,
+    rhs: *const i64,
+    out: *mut i8,
+    len: usize,
+) {
+    if len == 0 {
+        return;
+    }
+    assert!(!lhs.is_null(), "`lhs` was NULL");
+    assert!(!rhs.is_null(), "`rhs` was NULL");
+    assert!(!out.is_null(), "`out` was NULL");
+    let lhs = std::slice::from_raw_parts(lhs, len);
+    let rhs = std::slice::from_raw_parts(rhs, len);
+    let out = std::slice::from_raw_parts_mut(out, len);
+    compare_fixed_i64_arrays(lhs, rhs, out);
+}
+
+/// Parses the `delimiter` separated decimal values in the ASCII buffer `buf` of length `len`
+/// to raw `Price` values written to `out`.
+///
+/// The number of values written is written to `count` and the maximum precision inferred
+/// across them to `precision`.
+///
+/// Returns 1 on success, or 0 if any value fails to parse or there are more than `capacity`
+/// values (values before it remain written to `out`).
+///
+/// # Safety
+///
+/// - Assumes `buf` is a valid pointer to an array of length `len`.
+/// - Assumes `out` is a valid pointer to an array of length `capacity`.
+/// - Assumes `count` and `precision` are valid pointers.
+#[no_mangle]
+pub unsafe extern "C" fn price_raw_parse_delimited(
+    buf: *const u8,
+    len: usize,
+    delimiter: u8,
+    out: *mut i64,
+    capacity: usize,
+    count: *mut usize,
+    precision: *mut u8,
+) -> u8 {
+    assert!(!count.is_null(), "`count` was NULL");
+    assert!(!precision.is_null(), "`precision` was NULL");
+    count.write(0);
+    precision.write(0);
+    if len == 0 {
+        return 1;
+    }
+    assert!(!buf.is_null(), "`buf` was NULL");
+    let buf = std::slice::from_raw_parts(buf, len);
+    let out: &mut [i64] = if capacity == 0 {
+        &mut []
+    } else {
+        assert!(!out.is_null(), "`out` was NULL");
+        std::slice::from_raw_parts_mut(out, capacity)
+    };
+    match parse_fixed_i64_delimited(buf, delimiter, out) {
+        Ok((n, max_precision)) => {
+            count.write(n);
+            precision.write(max_precision);
+            1
+        }
+        Err(_) => 0,
+    }
+}
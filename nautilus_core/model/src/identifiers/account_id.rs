@@ -23,6 +23,8 @@ use std::{
 use nautilus_core::correctness::{check_string_contains, check_valid_string, FAILED};
 use ustr::Ustr;
 
+use crate::identifiers::interner::intern;
+
 use super::Venue;
 
 /// Represents a valid account ID.
@@ -54,7 +56,7 @@ impl AccountId {
     pub fn new_checked(value: &str) -> anyhow::Result<Self> {
         check_valid_string(value, stringify!(value))?;
         check_string_contains(value, "-", stringify!(value))?;
-        Ok(Self(Ustr::from(value)))
+        Ok(Self(intern(value)))
     }
 
     /// Creates a new [`AccountId`] instance.
@@ -69,7 +71,7 @@ impl AccountId {
 
     /// Sets the inner identifier value.
     pub(crate) fn set_inner(&mut self, value: &str) {
-        self.0 = Ustr::from(value);
+        self.0 = intern(value);
     }
 
     /// Returns the inner identifier value.
@@ -23,6 +23,8 @@ use std::{
 use nautilus_core::correctness::{check_valid_string, FAILED};
 use ustr::Ustr;
 
+use crate::identifiers::interner::intern;
+
 /// Represents a valid component ID.
 #[repr(C)]
 #[derive(Clone, Copy, Hash, PartialEq, Eq, PartialOrd, Ord)]
@@ -45,7 +47,7 @@ impl ComponentId {
     /// PyO3 requires a `Result` type for proper error handling and stacktrace printing in Python.
     pub fn new_checked(value: &str) -> anyhow::Result<Self> {
         check_valid_string(value, stringify!(value))?;
-        Ok(Self(Ustr::from(value)))
+        Ok(Self(intern(value)))
     }
 
     /// Creates a new [`ComponentId`] instance.
@@ -60,7 +62,7 @@ impl ComponentId {
 
     /// Sets the inner identifier value.
     pub(crate) fn set_inner(&mut self, value: &str) {
-        self.0 = Ustr::from(value);
+        self.0 = intern(value);
     }
 
     /// Returns the inner identifier value.
@@ -0,0 +1,227 @@
+// -------------------------------------------------------------------------------------------------
+//  Copyright (C) 2015-2024 Nautech Systems Pty Ltd. All rights reserved.
+//  https://nautechsystems.io
+//
+//  Licensed under the GNU Lesser General Public License Version 3.0 (the "License");
+//  You may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at https://www.gnu.org/licenses/lgpl-3.0.en.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+// -------------------------------------------------------------------------------------------------
+
+//! Instrumented access to the global [`Ustr`] string interner.
+//!
+//! Identifier constructors intern through [`intern`], which counts lookups so the cost of
+//! interning (for example when loading a large instrument universe) can be measured.
+//! Lookups are counted per thread so identifier construction never contends on a shared
+//! counter. The [`intern_bulk`] function interns a batch of strings, recording statistics
+//! for the batch as a whole.
+
+use std::{
+    sync::{
+        atomic::{AtomicU64, Ordering},
+        Arc, Mutex,
+    },
+    time::Instant,
+};
+
+use ustr::Ustr;
+
+/// The lookup counters of all live threads which have called [`intern`].
+static LOOKUP_COUNTERS: Mutex<Vec<Arc<AtomicU64>>> = Mutex::new(Vec::new());
+/// The lookups made by threads which have since exited.
+static RETIRED_LOOKUPS: AtomicU64 = AtomicU64::new(0);
+/// The lookup total at the last [`reset_interner_stats`].
+static LOOKUPS_BASELINE: AtomicU64 = AtomicU64::new(0);
+static BULK_CALLS: AtomicU64 = AtomicU64::new(0);
+static BULK_STRINGS: AtomicU64 = AtomicU64::new(0);
+static BULK_INSERTS: AtomicU64 = AtomicU64::new(0);
+static BULK_NANOS: AtomicU64 = AtomicU64::new(0);
+
+/// Counts the lookups made by a single thread.
+struct LookupCounter(Arc<AtomicU64>);
+
+impl LookupCounter {
+    fn new() -> Self {
+        let counter = Arc::new(AtomicU64::new(0));
+        LOOKUP_COUNTERS.lock().unwrap().push(counter.clone());
+        Self(counter)
+    }
+
+    #[inline]
+    fn increment(&self) {
+        // Only the owning thread writes, so a plain load and store suffices
+        self.0
+            .store(self.0.load(Ordering::Relaxed) + 1, Ordering::Relaxed);
+    }
+}
+
+impl Drop for LookupCounter {
+    fn drop(&mut self) {
+        let mut counters = LOOKUP_COUNTERS.lock().unwrap();
+        RETIRED_LOOKUPS.fetch_add(self.0.load(Ordering::Relaxed), Ordering::Relaxed);
+        counters.retain(|counter| !Arc::ptr_eq(counter, &self.0));
+    }
+}
+
+thread_local! {
+    static LOOKUPS: LookupCounter = LookupCounter::new();
+}
+
+fn total_lookups() -> u64 {
+    let counters = LOOKUP_COUNTERS.lock().unwrap();
+    let live: u64 = counters.iter().map(|c| c.load(Ordering::Relaxed)).sum();
+    RETIRED_LOOKUPS.load(Ordering::Relaxed) + live
+}
+
+/// Represents a snapshot of the global string interner statistics.
+///
+/// The `entries` and byte counts describe the shared cache, while the remaining counters
+/// accumulate from process start (or the last [`reset_interner_stats`]).
+#[repr(C)]
+#[derive(Clone, Copy, Debug, Default, PartialEq, Eq)]
+#[cfg_attr(
+    feature = "python",
+    pyo3::pyclass(module = "nautilus_trader.core.nautilus_pyo3.model")
+)]
+pub struct InternerStats {
+    /// The number of distinct strings held by the cache.
+    pub entries: usize,
+    /// The total bytes allocated by the cache.
+    pub allocated_bytes: usize,
+    /// The total bytes of capacity reserved by the cache.
+    pub capacity_bytes: usize,
+    /// The number of single string lookups made through [`intern`].
+    pub lookups: u64,
+    /// The number of calls to [`intern_bulk`].
+    pub bulk_calls: u64,
+    /// The number of strings passed to [`intern_bulk`] (including duplicates).
+    pub bulk_strings: u64,
+    /// The number of strings newly added to the cache by [`intern_bulk`].
+    pub bulk_inserts: u64,
+    /// The total wall time spent in [`intern_bulk`] (nanoseconds).
+    pub bulk_nanos: u64,
+}
+
+/// Interns the given `value`, returning the cached [`Ustr`].
+#[inline]
+pub fn intern(value: &str) -> Ustr {
+    // Not counted if the thread local has already been destroyed during thread exit
+    let _ = LOOKUPS.try_with(LookupCounter::increment);
+    Ustr::from(value)
+}
+
+/// Interns each of the given `values` in turn, returning the number newly added to the cache.
+///
+/// This is a plain loop of [`Ustr::from`], so every value is a separate cache lookup which
+/// takes the cache lock on its own. The returned count is the growth of the cache over the
+/// call, so also includes strings interned concurrently by other threads.
+pub fn intern_bulk<'a, I>(values: I) -> usize
+where
+    I: IntoIterator<Item = &'a str>,
+{
+    let start = Instant::now();
+    let entries = ustr::num_entries();
+    let mut count: u64 = 0;
+
+    for value in values {
+        count += 1;
+        Ustr::from(value);
+    }
+
+    let inserted = ustr::num_entries().saturating_sub(entries);
+
+    BULK_CALLS.fetch_add(1, Ordering::Relaxed);
+    BULK_STRINGS.fetch_add(count, Ordering::Relaxed);
+    BULK_INSERTS.fetch_add(inserted as u64, Ordering::Relaxed);
+    BULK_NANOS.fetch_add(start.elapsed().as_nanos() as u64, Ordering::Relaxed);
+
+    inserted
+}
+
+/// Returns a snapshot of the global string interner statistics.
+#[must_use]
+pub fn interner_stats() -> InternerStats {
+    InternerStats {
+        entries: ustr::num_entries(),
+        allocated_bytes: ustr::total_allocated(),
+        capacity_bytes: ustr::total_capacity(),
+        lookups: total_lookups().saturating_sub(LOOKUPS_BASELINE.load(Ordering::Relaxed)),
+        bulk_calls: BULK_CALLS.load(Ordering::Relaxed),
+        bulk_strings: BULK_STRINGS.load(Ordering::Relaxed),
+        bulk_inserts: BULK_INSERTS.load(Ordering::Relaxed),
+        bulk_nanos: BULK_NANOS.load(Ordering::Relaxed),
+    }
+}
+
+/// Resets the interner counters to zero (the cache itself is never cleared).
+pub fn reset_interner_stats() {
+    LOOKUPS_BASELINE.store(total_lookups(), Ordering::Relaxed);
+    BULK_CALLS.store(0, Ordering::Relaxed);
+    BULK_STRINGS.store(0, Ordering::Relaxed);
+    BULK_INSERTS.store(0, Ordering::Relaxed);
+    BULK_NANOS.store(0, Ordering::Relaxed);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Tests
+////////////////////////////////////////////////////////////////////////////////
+#[cfg(test)]
+mod tests {
+    use rstest::rstest;
+
+    use super::*;
+
+    // Counters are global and tests run in parallel, so assert lower bounds only
+
+    #[rstest]
+    fn test_intern_counts_lookups() {
+        let before = interner_stats().lookups;
+        let a = intern("INTERNER-TEST-LOOKUP");
+        let b = intern("INTERNER-TEST-LOOKUP");
+
+        assert_eq!(a, b);
+        assert!(interner_stats().lookups >= before + 2);
+    }
+
+    #[rstest]
+    fn test_lookups_from_exited_threads_are_kept() {
+        let before = interner_stats().lookups;
+        std::thread::spawn(|| intern("INTERNER-TEST-THREAD"))
+            .join()
+            .unwrap();
+
+        assert!(interner_stats().lookups > before);
+    }
+
+    #[rstest]
+    fn test_intern_bulk_counts_new_entries() {
+        intern("INTERNER-TEST-EXISTING");
+        let before = interner_stats();
+
+        let inserted = intern_bulk([
+            "INTERNER-TEST-BULK-1",
+            "INTERNER-TEST-BULK-2",
+            "INTERNER-TEST-BULK-1",
+            "INTERNER-TEST-EXISTING",
+        ]);
+        let after = interner_stats();
+
+        assert!(inserted >= 2);
+        assert!(Ustr::from_existing("INTERNER-TEST-BULK-1").is_some());
+        assert!(Ustr::from_existing("INTERNER-TEST-BULK-2").is_some());
+        assert!(after.bulk_calls > before.bulk_calls);
+        assert!(after.bulk_strings >= before.bulk_strings + 4);
+        assert!(after.bulk_inserts >= before.bulk_inserts + 2);
+        assert!(after.entries >= before.entries + 2);
+    }
+
+    #[rstest]
+    fn test_intern_bulk_empty() {
+        assert_eq!(intern_bulk(std::iter::empty()), 0);
+    }
+}
@@ -26,6 +26,7 @@ pub mod client_order_id;
 pub mod component_id;
 pub mod exec_algorithm_id;
 pub mod instrument_id;
+pub mod interner;
 pub mod order_list_id;
 pub mod position_id;
 pub mod strategy_id;
@@ -55,8 +55,8 @@ impl TradeId {
     /// - If `value` is not a valid string.
     /// - If `value` length is greater than 36.
     pub fn new_checked(value: &str) -> anyhow::Result<Self> {
-        // check that string is non-empty and within the expected length
-        check_in_range_inclusive_usize(value.len(), 1, TRADE_ID_LEN, stringify!(value))?;
+        // check that string is non-empty and within the expected length (leaving room for '\0')
+        check_in_range_inclusive_usize(value.len(), 1, TRADE_ID_LEN - 1, stringify!(value))?;
         Ok(Self::from_valid_bytes(value.as_bytes()))
     }
 
@@ -133,11 +133,23 @@ impl<'de> Deserialize<'de> for TradeId {
 mod tests {
     use rstest::rstest;
 
-    use crate::identifiers::{stubs::*, trade_id::TradeId};
+    use crate::identifiers::{
+        stubs::*,
+        trade_id::{TradeId, TRADE_ID_LEN},
+    };
 
     #[rstest]
     fn test_string_reprs(trade_id: TradeId) {
         assert_eq!(trade_id.to_string(), "1234567890");
         assert_eq!(format!("{trade_id}"), "1234567890");
     }
+
+    #[rstest]
+    fn test_maximum_length() {
+        let value = "c1d3a9e2-7b64-4f1e-9a5c-0d2f6e8b7a91";
+        let trade_id = TradeId::new(value);
+
+        assert_eq!(trade_id.to_cstr().to_str().unwrap(), value);
+        assert!(TradeId::new_checked(&"A".repeat(TRADE_ID_LEN)).is_err());
+    }
 }
@@ -23,7 +23,7 @@ use std::{
 use nautilus_core::correctness::{check_valid_string, FAILED};
 use ustr::Ustr;
 
-use crate::venues::VENUE_MAP;
+use crate::{identifiers::interner::intern, venues::VENUE_MAP};
 
 pub const SYNTHETIC_VENUE: &str = "SYNTH";
 
@@ -49,7 +49,7 @@ impl Venue {
     /// PyO3 requires a `Result` type for proper error handling and stacktrace printing in Python.
     pub fn new_checked(value: &str) -> anyhow::Result<Self> {
         check_valid_string(value, stringify!(value))?;
-        Ok(Self(Ustr::from(value)))
+        Ok(Self(intern(value)))
     }
 
     /// Creates a new [`Venue`] instance.
@@ -64,7 +64,7 @@ impl Venue {
 
     /// Sets the inner identifier value.
     pub(crate) fn set_inner(&mut self, value: &str) {
-        self.0 = Ustr::from(value);
+        self.0 = intern(value);
     }
 
     /// Returns the inner identifier value.
@@ -81,7 +81,7 @@ impl Venue {
 
     #[must_use]
     pub fn from_str_unchecked(s: &str) -> Self {
-        Self(Ustr::from(s))
+        Self(intern(s))
     }
 
     pub fn from_code(code: &str) -> anyhow::Result<Self> {
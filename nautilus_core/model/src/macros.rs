@@ -18,12 +18,14 @@
 #[macro_export]
 macro_rules! enum_strum_serde {
     ($type:ty) => {
+        nautilus_core::impl_enum_str_table!($type);
+
         impl Serialize for $type {
             fn serialize<S>(&self, serializer: S) -> Result<S::Ok, S::Error>
             where
                 S: Serializer,
             {
-                serializer.serialize_str(&self.to_string())
+                serializer.serialize_str(nautilus_core::enum_table::EnumStrs::as_static_str(*self))
             }
         }
 
@@ -33,7 +35,8 @@ macro_rules! enum_strum_serde {
                 D: Deserializer<'de>,
             {
                 let s = String::deserialize(deserializer)?;
-                <$type>::from_str(&s).map_err(serde::de::Error::custom)
+                <$type as nautilus_core::enum_table::EnumStrs>::parse_bytes(s.as_bytes())
+                    .ok_or_else(|| serde::de::Error::custom(strum::ParseError::VariantNotFound))
             }
         }
     };
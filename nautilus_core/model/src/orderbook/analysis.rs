@@ -15,9 +15,7 @@
 
 //! Functions related to order book analysis.
 
-use std::collections::BTreeMap;
-
-use super::{book::OrderBook, ladder::BookPrice, level::Level};
+use super::{book::OrderBook, ladder::Ladder};
 use crate::{
     enums::{BookType, OrderSide},
     orderbook::error::BookIntegrityError,
@@ -26,23 +24,25 @@ use crate::{
 
 /// Calculates the estimated fill quantity for a specified price from a set of
 /// order book levels and order side.
+///
+/// Uses a binary search over the ladders cumulative depth index when enabled.
 #[must_use]
-pub fn get_quantity_for_price(
-    price: Price,
-    order_side: OrderSide,
-    levels: &BTreeMap<BookPrice, Level>,
-) -> f64 {
+pub fn get_quantity_for_price(price: Price, order_side: OrderSide, ladder: &Ladder) -> f64 {
+    if let Some(depth) = ladder.cumulative_depth() {
+        return depth.quantity_for_price(price, ladder.side);
+    }
+
     let mut matched_size: f64 = 0.0;
 
-    for (book_price, level) in levels {
+    for level in ladder.levels() {
         match order_side {
             OrderSide::Buy => {
-                if book_price.value > price {
+                if level.price.value > price {
                     break;
                 }
             }
             OrderSide::Sell => {
-                if book_price.value < price {
+                if level.price.value < price {
                     break;
                 }
             }
@@ -56,15 +56,21 @@ pub fn get_quantity_for_price(
 
 /// Calculates the estimated average price for a specified quantity from a set of
 /// order book levels.
+///
+/// Uses a binary search over the ladders cumulative depth index when enabled.
 #[must_use]
-pub fn get_avg_px_for_quantity(qty: Quantity, levels: &BTreeMap<BookPrice, Level>) -> f64 {
+pub fn get_avg_px_for_quantity(qty: Quantity, ladder: &Ladder) -> f64 {
+    if let Some(depth) = ladder.cumulative_depth() {
+        return depth.avg_px_for_quantity(qty);
+    }
+
     let mut cumulative_size_raw = 0u64;
     let mut cumulative_value = 0.0;
 
-    for (book_price, level) in levels {
+    for level in ladder.levels() {
         let size_this_level = level.size_raw().min(qty.raw - cumulative_size_raw);
         cumulative_size_raw += size_this_level;
-        cumulative_value += book_price.value.as_f64() * size_this_level as f64;
+        cumulative_value += level.price.value.as_f64() * size_this_level as f64;
 
         if cumulative_size_raw >= qty.raw {
             break;
@@ -79,23 +85,25 @@ pub fn get_avg_px_for_quantity(qty: Quantity, levels: &BTreeMap<BookPrice, Level
 }
 
 pub fn book_check_integrity(book: &OrderBook) -> Result<(), BookIntegrityError> {
+    let (bids, asks) = (book.bid_ladder(), book.ask_ladder());
+
     match book.book_type {
         BookType::L1_MBP => {
-            if book.bids.len() > 1 {
+            if bids.len() > 1 {
                 return Err(BookIntegrityError::TooManyLevels(
                     OrderSide::Buy,
-                    book.bids.len(),
+                    bids.len(),
                 ));
             }
-            if book.asks.len() > 1 {
+            if asks.len() > 1 {
                 return Err(BookIntegrityError::TooManyLevels(
                     OrderSide::Sell,
-                    book.asks.len(),
+                    asks.len(),
                 ));
             }
         }
         BookType::L2_MBP => {
-            for bid_level in book.bids.levels.values() {
+            for bid_level in bids.levels() {
                 let num_orders = bid_level.orders.len();
                 if num_orders > 1 {
                     return Err(BookIntegrityError::TooManyOrders(
@@ -105,7 +113,7 @@ pub fn book_check_integrity(book: &OrderBook) -> Result<(), BookIntegrityError>
                 }
             }
 
-            for ask_level in book.asks.levels.values() {
+            for ask_level in asks.levels() {
                 let num_orders = ask_level.orders.len();
                 if num_orders > 1 {
                     return Err(BookIntegrityError::TooManyOrders(
@@ -118,7 +126,7 @@ pub fn book_check_integrity(book: &OrderBook) -> Result<(), BookIntegrityError>
         BookType::L3_MBO => {}
     };
 
-    if let (Some(top_bid_level), Some(top_ask_level)) = (book.bids.top(), book.asks.top()) {
+    if let (Some(top_bid_level), Some(top_ask_level)) = (bids.top(), asks.top()) {
         let best_bid = top_bid_level.price;
         let best_ask = top_ask_level.price;
 
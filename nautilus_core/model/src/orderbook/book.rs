@@ -19,7 +19,15 @@ use std::fmt::Display;
 
 use nautilus_core::nanos::UnixNanos;
 
-use super::{aggregation::pre_process_order, analysis, display::pprint_book, level::Level};
+use super::{
+    aggregation::pre_process_order,
+    analysis,
+    display::pprint_book,
+    fixed_depth::{self, FixedDepth},
+    level::Level,
+    sequencer::DeltaSequencer,
+    snapshot,
+};
 use crate::{
     data::{
         delta::OrderBookDelta, deltas::OrderBookDeltas, depth::OrderBookDepth10, order::BookOrder,
@@ -27,7 +35,11 @@ use crate::{
     },
     enums::{BookAction, BookType, OrderSide, OrderSideSpecified},
     identifiers::InstrumentId,
-    orderbook::{error::InvalidBookOperation, ladder::Ladder},
+    orderbook::{
+        error::{BookSnapshotError, InvalidBookOperation},
+        ladder::Ladder,
+        top::{TopOfBook, TopOfBookHandle, TopOfBookPublisher},
+    },
     types::{price::Price, quantity::Quantity},
 };
 
@@ -55,6 +67,12 @@ pub struct OrderBook {
     pub count: u64,
     pub(crate) bids: Ladder,
     pub(crate) asks: Ladder,
+    /// Whether the book is in fixed depth mode, where depth snapshots load `fixed`.
+    fixed_depth: bool,
+    /// The fixed arrays holding the levels, until an incremental change spills them.
+    fixed: Option<Box<FixedDepth>>,
+    sequencer: Option<Box<DeltaSequencer>>,
+    top_publisher: Option<TopOfBookPublisher>,
 }
 
 impl PartialEq for OrderBook {
@@ -89,18 +107,166 @@ impl OrderBook {
             count: 0,
             bids: Ladder::new(OrderSide::Buy),
             asks: Ladder::new(OrderSide::Sell),
+            fixed_depth: false,
+            fixed: None,
+            sequencer: None,
+            top_publisher: None,
         }
     }
 
+    /// Creates a new [`OrderBook`] instance with tick-indexed ladders.
+    ///
+    /// Each side holds its levels in a contiguous array of `capacity` ticks of
+    /// `price_increment`, which recenters as the market moves, rather than in a B-tree.
+    ///
+    /// # Panics
+    ///
+    /// This function panics:
+    /// - If `price_increment` is not positive.
+    /// - If `capacity` is zero.
+    #[must_use]
+    pub fn new_tick_indexed(
+        instrument_id: InstrumentId,
+        book_type: BookType,
+        price_increment: Price,
+        capacity: usize,
+    ) -> Self {
+        Self {
+            bids: Ladder::new_tick_indexed(OrderSide::Buy, price_increment, capacity),
+            asks: Ladder::new_tick_indexed(OrderSide::Sell, price_increment, capacity),
+            ..Self::new(instrument_id, book_type)
+        }
+    }
+
+    /// Creates a new L2 [`OrderBook`] instance which holds the top ten levels of each side
+    /// in fixed arrays, for feeds which only send full MBP-10 depth snapshots.
+    ///
+    /// Applying an [`OrderBookDepth10`] then copies its arrays rather than rebuilding
+    /// the ladders. Any add, update or delete moves the levels into ladder storage first,
+    /// and the next depth snapshot moves the book back into its fixed arrays.
+    #[must_use]
+    pub fn new_depth10(instrument_id: InstrumentId) -> Self {
+        Self {
+            fixed_depth: true,
+            fixed: Some(Box::default()),
+            ..Self::new(instrument_id, BookType::L2_MBP)
+        }
+    }
+
+    /// Returns the price increment of the tick-indexed ladders (if any).
+    #[must_use]
+    pub fn price_increment(&self) -> Option<Price> {
+        self.bids
+            .tick_config()
+            .map(|(price_increment, _)| price_increment)
+    }
+
+    /// Returns whether the book is in fixed depth mode, loading depth snapshots into
+    /// fixed MBP-10 arrays.
+    ///
+    /// The mode is kept while incremental changes hold the levels in ladders.
+    #[must_use]
+    pub const fn is_fixed_depth(&self) -> bool {
+        self.fixed_depth
+    }
+
+    /// Returns the fixed arrays currently holding the levels (if any).
+    pub(crate) fn fixed_levels(&self) -> Option<&FixedDepth> {
+        self.fixed.as_deref()
+    }
+
+    pub(crate) fn fixed_levels_mut(&mut self) -> Option<&mut FixedDepth> {
+        self.fixed.as_deref_mut()
+    }
+
+    /// Enables sequenced ingestion, so that deltas are applied in order of their sequence
+    /// number with up to `capacity` deltas held for reordering.
+    ///
+    /// See [`DeltaSequencer`] for how gaps and duplicates are handled. A book which has
+    /// detected a gap is marked stale until a `Clear` delta resynchronizes it.
+    pub fn enable_sequencing(&mut self, capacity: usize) {
+        self.sequencer = Some(Box::new(DeltaSequencer::new(capacity)));
+    }
+
+    /// Returns the delta sequencer, if sequenced ingestion is enabled.
+    #[must_use]
+    pub fn sequencer(&self) -> Option<&DeltaSequencer> {
+        self.sequencer.as_deref()
+    }
+
+    /// Returns the delta sequencer mutably, if sequenced ingestion is enabled.
+    pub fn sequencer_mut(&mut self) -> Option<&mut DeltaSequencer> {
+        self.sequencer.as_deref_mut()
+    }
+
+    /// Returns whether sequenced ingestion has detected a gap the book has not yet
+    /// been resynchronized from.
+    #[must_use]
+    pub fn is_stale(&self) -> bool {
+        self.sequencer.as_ref().map_or(false, |s| s.is_stale())
+    }
+
+    /// Enables the cumulative depth index on both sides of the book.
+    ///
+    /// Fill quantity and average price queries then binary search integer prefix sums
+    /// of size and notional, which each change to the book patches incrementally.
+    ///
+    /// While a fixed depth book holds its levels in fixed arrays, those queries walk
+    /// the ten levels directly, and the index serves them once the levels move into
+    /// the ladders.
+    pub fn enable_cumulative_depth(&mut self) {
+        self.bids.enable_cumulative_depth();
+        self.asks.enable_cumulative_depth();
+    }
+
+    #[must_use]
+    pub fn has_cumulative_depth(&self) -> bool {
+        self.bids.has_cumulative_depth()
+    }
+
+    /// Restores an [`OrderBook`] from a binary snapshot.
+    ///
+    /// # Errors
+    ///
+    /// This function returns an error:
+    /// - If `bytes` is not a valid snapshot of a supported version.
+    pub fn from_snapshot_bytes(bytes: &[u8]) -> Result<Self, BookSnapshotError> {
+        snapshot::read_snapshot(bytes)
+    }
+
+    /// Returns a compact, versioned binary snapshot of the book.
+    ///
+    /// The snapshot holds both ladders with their orders in time priority, along with
+    /// the `sequence`, `ts_last` and `count`.
+    #[must_use]
+    pub fn to_snapshot_bytes(&self) -> Vec<u8> {
+        let mut buf = Vec::new();
+        self.write_snapshot(&mut buf);
+        buf
+    }
+
+    /// Appends a binary snapshot of the book to `buf`.
+    pub fn write_snapshot(&self, buf: &mut Vec<u8>) {
+        snapshot::write_snapshot(self, buf);
+    }
+
     pub fn reset(&mut self) {
         self.bids.clear();
         self.asks.clear();
+        if self.fixed_depth {
+            self.fixed = Some(Box::default());
+        }
         self.sequence = 0;
         self.ts_last = UnixNanos::default();
         self.count = 0;
+        if let Some(sequencer) = &mut self.sequencer {
+            sequencer.reset();
+        }
+        self.publish_top();
     }
 
     pub fn add(&mut self, order: BookOrder, flags: u8, sequence: u64, ts_event: UnixNanos) {
+        self.spill_fixed_depth();
         let order = pre_process_order(self.book_type, order, flags);
         match order.side.as_specified() {
             OrderSideSpecified::Buy => self.bids.add(order),
@@ -111,6 +277,7 @@ impl OrderBook {
     }
 
     pub fn update(&mut self, order: BookOrder, flags: u8, sequence: u64, ts_event: UnixNanos) {
+        self.spill_fixed_depth();
         let order = pre_process_order(self.book_type, order, flags);
         match order.side.as_specified() {
             OrderSideSpecified::Buy => self.bids.update(order),
@@ -121,6 +288,7 @@ impl OrderBook {
     }
 
     pub fn delete(&mut self, order: BookOrder, flags: u8, sequence: u64, ts_event: UnixNanos) {
+        self.spill_fixed_depth();
         let order = pre_process_order(self.book_type, order, flags);
         match order.side.as_specified() {
             OrderSideSpecified::Buy => self.bids.delete(order, sequence, ts_event),
@@ -133,20 +301,42 @@ impl OrderBook {
     pub fn clear(&mut self, sequence: u64, ts_event: UnixNanos) {
         self.bids.clear();
         self.asks.clear();
+        if let Some(fixed) = &mut self.fixed {
+            fixed.clear_bids();
+            fixed.clear_asks();
+        }
         self.increment(sequence, ts_event);
     }
 
     pub fn clear_bids(&mut self, sequence: u64, ts_event: UnixNanos) {
         self.bids.clear();
+        if let Some(fixed) = &mut self.fixed {
+            fixed.clear_bids();
+        }
         self.increment(sequence, ts_event);
     }
 
     pub fn clear_asks(&mut self, sequence: u64, ts_event: UnixNanos) {
         self.asks.clear();
+        if let Some(fixed) = &mut self.fixed {
+            fixed.clear_asks();
+        }
         self.increment(sequence, ts_event);
     }
 
+    /// Applies the given `delta`, or passes it through the sequencer if sequenced ingestion
+    /// is enabled.
     pub fn apply_delta(&mut self, delta: &OrderBookDelta) {
+        match self.sequencer.take() {
+            Some(mut sequencer) => {
+                sequencer.push(*delta, |delta| self.apply_delta_unsequenced(delta));
+                self.sequencer = Some(sequencer);
+            }
+            None => self.apply_delta_unsequenced(delta),
+        }
+    }
+
+    fn apply_delta_unsequenced(&mut self, delta: &OrderBookDelta) {
         let order = delta.order;
         let flags = delta.flags;
         let sequence = delta.sequence;
@@ -160,12 +350,41 @@ impl OrderBook {
     }
 
     pub fn apply_deltas(&mut self, deltas: &OrderBookDeltas) {
-        for delta in &deltas.deltas {
+        self.apply_delta_slice(&deltas.deltas);
+    }
+
+    /// Applies a contiguous batch of deltas in order, without first collecting them
+    /// into an [`OrderBookDeltas`].
+    ///
+    /// The top of book is published once for the whole batch.
+    pub fn apply_delta_slice(&mut self, deltas: &[OrderBookDelta]) {
+        let top_publisher = self.top_publisher.take();
+        for delta in deltas {
             self.apply_delta(delta);
         }
+        self.top_publisher = top_publisher;
+        self.publish_top();
     }
 
+    /// Applies a depth snapshot, replacing all levels of both sides.
+    ///
+    /// A fixed depth book copies the snapshot arrays, moving its levels back out of the
+    /// ladders if needed. Either way each order of the snapshot counts as one event.
     pub fn apply_depth(&mut self, depth: &OrderBookDepth10) {
+        if self.fixed_depth {
+            if self.fixed.is_none() {
+                self.bids.clear();
+                self.asks.clear();
+            }
+            self.fixed.get_or_insert_with(Box::default).load(depth);
+            self.sequence = depth.sequence;
+            self.ts_last = depth.ts_event;
+            self.count += (depth.bids.len() + depth.asks.len()) as u64;
+            self.publish_top();
+            return;
+        }
+
+        let top_publisher = self.top_publisher.take();
         self.bids.clear();
         self.asks.clear();
 
@@ -176,38 +395,103 @@ impl OrderBook {
         for order in depth.asks {
             self.add(order, depth.flags, depth.sequence, depth.ts_event);
         }
+
+        self.top_publisher = top_publisher;
+        self.publish_top();
     }
 
     pub fn bids(&self) -> impl Iterator<Item = &Level> {
-        self.bids.levels.values()
+        self.bid_ladder().levels()
     }
 
     pub fn asks(&self) -> impl Iterator<Item = &Level> {
-        self.asks.levels.values()
+        self.ask_ladder().levels()
+    }
+
+    /// Returns the bid ladder, which a fixed depth book builds on first use after a change.
+    pub(crate) fn bid_ladder(&self) -> &Ladder {
+        match &self.fixed {
+            Some(fixed) => &fixed.ladders().0,
+            None => &self.bids,
+        }
+    }
+
+    /// Returns the ask ladder, which a fixed depth book builds on first use after a change.
+    pub(crate) fn ask_ladder(&self) -> &Ladder {
+        match &self.fixed {
+            Some(fixed) => &fixed.ladders().1,
+            None => &self.asks,
+        }
+    }
+
+    /// Moves the levels of a fixed depth book into its ladders, which then hold the book
+    /// until the next depth snapshot.
+    pub(crate) fn spill_fixed_depth(&mut self) {
+        if let Some(fixed) = self.fixed.take() {
+            for order in fixed.bids() {
+                self.bids.add(pre_process_order(self.book_type, *order, 0));
+            }
+            for order in fixed.asks() {
+                self.asks.add(pre_process_order(self.book_type, *order, 0));
+            }
+        }
+    }
+
+    /// Writes the top bid levels as raw `(price, size, order count)` columns into the
+    /// given buffers, returning the number of levels written.
+    pub fn bids_depth(&self, prices: &mut [i64], sizes: &mut [u64], counts: &mut [u32]) -> usize {
+        if let Some(fixed) = &self.fixed {
+            return fixed.write_depth(OrderSide::Buy, prices, sizes, counts);
+        }
+        self.bids.write_depth(prices, sizes, counts)
+    }
+
+    /// Writes the top ask levels as raw `(price, size, order count)` columns into the
+    /// given buffers, returning the number of levels written.
+    pub fn asks_depth(&self, prices: &mut [i64], sizes: &mut [u64], counts: &mut [u32]) -> usize {
+        if let Some(fixed) = &self.fixed {
+            return fixed.write_depth(OrderSide::Sell, prices, sizes, counts);
+        }
+        self.asks.write_depth(prices, sizes, counts)
     }
 
     #[must_use]
     pub fn has_bid(&self) -> bool {
+        if let Some(fixed) = &self.fixed {
+            return !fixed.bids().is_empty();
+        }
         self.bids.top().map_or(false, |top| !top.orders.is_empty())
     }
 
     #[must_use]
     pub fn has_ask(&self) -> bool {
+        if let Some(fixed) = &self.fixed {
+            return !fixed.asks().is_empty();
+        }
         self.asks.top().map_or(false, |top| !top.orders.is_empty())
     }
 
     #[must_use]
     pub fn best_bid_price(&self) -> Option<Price> {
+        if let Some(fixed) = &self.fixed {
+            return fixed.bids().first().map(|order| order.price);
+        }
         self.bids.top().map(|top| top.price.value)
     }
 
     #[must_use]
     pub fn best_ask_price(&self) -> Option<Price> {
+        if let Some(fixed) = &self.fixed {
+            return fixed.asks().first().map(|order| order.price);
+        }
         self.asks.top().map(|top| top.price.value)
     }
 
     #[must_use]
     pub fn best_bid_size(&self) -> Option<Quantity> {
+        if let Some(fixed) = &self.fixed {
+            return fixed.bids().first().map(|order| order.size);
+        }
         self.bids
             .top()
             .and_then(|top| top.first().map(|order| order.size))
@@ -215,11 +499,38 @@ impl OrderBook {
 
     #[must_use]
     pub fn best_ask_size(&self) -> Option<Quantity> {
+        if let Some(fixed) = &self.fixed {
+            return fixed.asks().first().map(|order| order.size);
+        }
         self.asks
             .top()
             .and_then(|top| top.first().map(|order| order.size))
     }
 
+    /// Returns the best bid and ask with their sizes as a single record.
+    #[must_use]
+    pub fn top_of_book(&self) -> TopOfBook {
+        TopOfBook::from_book(self)
+    }
+
+    /// Returns a handle through which other threads can read the top of book without locking.
+    ///
+    /// The first call starts publishing, after which the book publishes a new record
+    /// whenever its best prices or sizes change.
+    pub fn top_of_book_handle(&mut self) -> TopOfBookHandle {
+        let top = self.top_of_book();
+        self.top_publisher
+            .get_or_insert_with(|| TopOfBookPublisher::new(top))
+            .handle()
+    }
+
+    fn publish_top(&mut self) {
+        if let Some(mut top_publisher) = self.top_publisher.take() {
+            top_publisher.publish(self.top_of_book());
+            self.top_publisher = Some(top_publisher);
+        }
+    }
+
     #[must_use]
     pub fn spread(&self) -> Option<f64> {
         match (self.best_ask_price(), self.best_bid_price()) {
@@ -238,26 +549,53 @@ impl OrderBook {
 
     #[must_use]
     pub fn get_avg_px_for_quantity(&self, qty: Quantity, order_side: OrderSide) -> f64 {
-        let levels = match order_side.as_specified() {
-            OrderSideSpecified::Buy => &self.asks.levels,
-            OrderSideSpecified::Sell => &self.bids.levels,
+        if let Some(fixed) = &self.fixed {
+            let levels = match order_side.as_specified() {
+                OrderSideSpecified::Buy => fixed.asks(),
+                OrderSideSpecified::Sell => fixed.bids(),
+            };
+            return fixed_depth::get_avg_px_for_quantity(qty, levels);
+        }
+
+        let ladder = match order_side.as_specified() {
+            OrderSideSpecified::Buy => &self.asks,
+            OrderSideSpecified::Sell => &self.bids,
         };
 
-        analysis::get_avg_px_for_quantity(qty, levels)
+        analysis::get_avg_px_for_quantity(qty, ladder)
     }
 
     #[must_use]
     pub fn get_quantity_for_price(&self, price: Price, order_side: OrderSide) -> f64 {
-        let levels = match order_side.as_specified() {
-            OrderSideSpecified::Buy => &self.asks.levels,
-            OrderSideSpecified::Sell => &self.bids.levels,
+        if let Some(fixed) = &self.fixed {
+            let levels = match order_side.as_specified() {
+                OrderSideSpecified::Buy => fixed.asks(),
+                OrderSideSpecified::Sell => fixed.bids(),
+            };
+            return fixed_depth::get_quantity_for_price(price, order_side, levels);
+        }
+
+        let ladder = match order_side.as_specified() {
+            OrderSideSpecified::Buy => &self.asks,
+            OrderSideSpecified::Sell => &self.bids,
         };
 
-        analysis::get_quantity_for_price(price, order_side, levels)
+        analysis::get_quantity_for_price(price, order_side, ladder)
     }
 
     #[must_use]
     pub fn simulate_fills(&self, order: &BookOrder) -> Vec<(Price, Quantity)> {
+        if let Some(fixed) = &self.fixed {
+            return match order.side.as_specified() {
+                OrderSideSpecified::Buy => {
+                    fixed_depth::simulate_fills(order, fixed.asks(), OrderSide::Sell)
+                }
+                OrderSideSpecified::Sell => {
+                    fixed_depth::simulate_fills(order, fixed.bids(), OrderSide::Buy)
+                }
+            };
+        }
+
         match order.side.as_specified() {
             OrderSideSpecified::Buy => self.asks.simulate_fills(order),
             OrderSideSpecified::Sell => self.bids.simulate_fills(order),
@@ -267,13 +605,14 @@ impl OrderBook {
     /// Return a [`String`] representation of the order book in a human-readable table format.
     #[must_use]
     pub fn pprint(&self, num_levels: usize) -> String {
-        pprint_book(&self.bids, &self.asks, num_levels)
+        pprint_book(self.bid_ladder(), self.ask_ladder(), num_levels)
     }
 
     fn increment(&mut self, sequence: u64, ts_event: UnixNanos) {
         self.sequence = sequence;
         self.ts_last = ts_event;
         self.count += 1;
+        self.publish_top();
     }
 
     pub fn update_quote_tick(&mut self, quote: &QuoteTick) -> Result<(), InvalidBookOperation> {
@@ -297,6 +636,7 @@ impl OrderBook {
 
         self.update_book_bid(bid, quote.ts_event);
         self.update_book_ask(ask, quote.ts_event);
+        self.publish_top();
 
         Ok(())
     }
@@ -322,6 +662,7 @@ impl OrderBook {
 
         self.update_book_bid(bid, trade.ts_event);
         self.update_book_ask(ask, trade.ts_event);
+        self.publish_top();
 
         Ok(())
     }
@@ -354,11 +695,17 @@ mod tests {
 
     use crate::{
         data::{
-            depth::OrderBookDepth10, order::BookOrder, quote::QuoteTick, stubs::*, trade::TradeTick,
+            delta::OrderBookDelta,
+            deltas::OrderBookDeltas,
+            depth::{OrderBookDepth10, DEPTH10_LEN},
+            order::{BookOrder, NULL_ORDER},
+            quote::QuoteTick,
+            stubs::*,
+            trade::TradeTick,
         },
-        enums::{AggressorSide, BookType, OrderSide},
+        enums::{AggressorSide, BookAction, BookType, OrderSide},
         identifiers::{InstrumentId, TradeId},
-        orderbook::{analysis::book_check_integrity, book::OrderBook},
+        orderbook::{analysis::book_check_integrity, book::OrderBook, top::TopOfBook},
         types::{price::Price, quantity::Quantity},
     };
 
@@ -604,6 +951,215 @@ mod tests {
         );
     }
 
+    #[rstest]
+    fn test_cumulative_depth_matches_ladder_walk(stub_depth10: OrderBookDepth10) {
+        let instrument_id = InstrumentId::from("AAPL.XNAS");
+        let mut book = OrderBook::new(instrument_id, BookType::L2_MBP);
+        let mut indexed = OrderBook::new(instrument_id, BookType::L2_MBP);
+        indexed.enable_cumulative_depth();
+        assert!(indexed.has_cumulative_depth());
+
+        book.apply_depth(&stub_depth10);
+        indexed.apply_depth(&stub_depth10);
+
+        for (price, qty) in [("99.50", "150"), ("97.00", "1000"), ("102.00", "100000")] {
+            let price = Price::from(price);
+            let qty = Quantity::from(qty);
+            for side in [OrderSide::Buy, OrderSide::Sell] {
+                assert_eq!(
+                    indexed.get_quantity_for_price(price, side),
+                    book.get_quantity_for_price(price, side)
+                );
+                let expected = book.get_avg_px_for_quantity(qty, side);
+                let avg_px = indexed.get_avg_px_for_quantity(qty, side);
+                assert!((avg_px - expected).abs() < 1e-9);
+            }
+        }
+
+        // Index is patched as the book changes
+        let bid = BookOrder::new(OrderSide::Buy, Price::from("99.50"), Quantity::from(75), 99);
+        indexed.add(bid, 0, 1, 1.into());
+        assert_eq!(
+            indexed.get_quantity_for_price(Price::from("99.50"), OrderSide::Sell),
+            75.0
+        );
+        indexed.clear_bids(2, 2.into());
+        assert_eq!(
+            indexed.get_avg_px_for_quantity(Quantity::from(1), OrderSide::Sell),
+            0.0
+        );
+    }
+
+    #[rstest]
+    fn test_top_of_book_handle(stub_depth10: OrderBookDepth10) {
+        let instrument_id = InstrumentId::from("AAPL.XNAS");
+        let mut book = OrderBook::new(instrument_id, BookType::L2_MBP);
+        let handle = book.top_of_book_handle();
+        assert_eq!(handle.read(), TopOfBook::default());
+
+        book.apply_depth(&stub_depth10);
+        let top = handle.read();
+        assert_eq!(top, book.top_of_book());
+        assert_eq!(top.bid_price, Price::from("99.00"));
+        assert_eq!(top.ask_price, Price::from("100.00"));
+
+        // A change below the top of book is not published
+        let bid = BookOrder::new(OrderSide::Buy, Price::from("95.00"), Quantity::from(1), 0);
+        book.update(bid, 0, 7, 7.into());
+        assert_eq!(handle.read(), top);
+
+        let bid = BookOrder::new(OrderSide::Buy, Price::from("99.50"), Quantity::from(75), 0);
+        book.add(bid, 0, 8, 8.into());
+        let reader = handle.clone();
+        let top = std::thread::spawn(move || reader.read()).join().unwrap();
+        assert_eq!(top.bid_price, Price::from("99.50"));
+        assert_eq!(top.bid_size, Quantity::from(75));
+        assert_eq!(top.sequence, 8);
+
+        // A cloned book publishes to its own record
+        let mut cloned = book.clone();
+        cloned.clear(9, 9.into());
+        assert_eq!(handle.read(), top);
+        assert_eq!(
+            cloned.top_of_book_handle().read().bid_size,
+            Quantity::default()
+        );
+    }
+
+    #[rstest]
+    fn test_depth10_book_matches_ladder_book(stub_depth10: OrderBookDepth10) {
+        let instrument_id = InstrumentId::from("AAPL.XNAS");
+        let mut expected = OrderBook::new(instrument_id, BookType::L2_MBP);
+        let mut book = OrderBook::new_depth10(instrument_id);
+        assert!(book.is_fixed_depth());
+
+        expected.apply_depth(&stub_depth10);
+        book.apply_depth(&stub_depth10);
+
+        assert_eq!(book.count, expected.count);
+        assert_eq!(
+            book.top_of_book().bid_price,
+            expected.top_of_book().bid_price
+        );
+        assert_eq!(book.spread(), expected.spread());
+        assert_eq!(book.midpoint(), expected.midpoint());
+        for (price, qty) in [("99.50", "150"), ("97.00", "1000"), ("102.00", "100000")] {
+            let price = Price::from(price);
+            let qty = Quantity::from(qty);
+            for side in [OrderSide::Buy, OrderSide::Sell] {
+                assert_eq!(
+                    book.get_quantity_for_price(price, side),
+                    expected.get_quantity_for_price(price, side)
+                );
+                assert_eq!(
+                    book.get_avg_px_for_quantity(qty, side),
+                    expected.get_avg_px_for_quantity(qty, side)
+                );
+                let order = BookOrder::new(side, price, qty, 0);
+                assert_eq!(book.simulate_fills(&order), expected.simulate_fills(&order));
+            }
+        }
+
+        let mut prices = [0i64; 4];
+        let mut sizes = [0u64; 4];
+        let mut counts = [0u32; 4];
+        let mut expected_prices = [0i64; 4];
+        let mut expected_sizes = [0u64; 4];
+        assert_eq!(book.asks_depth(&mut prices, &mut sizes, &mut counts), 4);
+        expected.asks_depth(&mut expected_prices, &mut expected_sizes, &mut counts);
+        assert_eq!(prices, expected_prices);
+        assert_eq!(sizes, expected_sizes);
+
+        // Level queries build ladders on demand
+        assert_eq!(book.bids().count(), 10);
+        assert!(book.bids().eq(expected.bids()));
+        assert_eq!(book.pprint(3), expected.pprint(3));
+        assert!(book_check_integrity(&book).is_ok());
+
+        // An incremental update moves the levels into ladder storage
+        let bid = BookOrder::new(OrderSide::Buy, Price::from("99.50"), Quantity::from(75), 0);
+        book.add(bid, 0, 1, 1.into());
+        expected.add(bid, 0, 1, 1.into());
+        assert!(book.is_fixed_depth());
+        assert!(book.fixed_levels().is_none());
+        assert_eq!(book.best_bid_price(), Some(Price::from("99.50")));
+        assert!(book.bids().eq(expected.bids()));
+
+        // The next depth snapshot moves the levels back into the fixed arrays
+        book.apply_depth(&stub_depth10);
+        expected.apply_depth(&stub_depth10);
+        assert!(book.fixed_levels().is_some());
+        assert_eq!(book.bids.len(), 0);
+        assert_eq!(book.count, expected.count);
+        assert!(book.bids().eq(expected.bids()));
+
+        book.reset();
+        assert!(book.fixed_levels().is_some());
+        assert!(!book.has_bid());
+    }
+
+    #[rstest]
+    fn test_depth10_book_with_partial_depth(stub_depth10: OrderBookDepth10) {
+        let mut depth = stub_depth10;
+        depth.bids[3..].fill(NULL_ORDER);
+        depth.asks = [NULL_ORDER; DEPTH10_LEN];
+        let mut book = OrderBook::new_depth10(depth.instrument_id);
+
+        book.apply_depth(&depth);
+
+        assert_eq!(book.bids().count(), 3);
+        assert!(book.has_bid());
+        assert!(!book.has_ask());
+        assert_eq!(book.spread(), None);
+
+        book.clear_bids(1, 1.into());
+        assert!(!book.has_bid());
+        assert!(book.is_fixed_depth());
+    }
+
+    #[rstest]
+    fn test_sequenced_ingestion_reorders_and_detects_gaps() {
+        let instrument_id = InstrumentId::from("AAPL.XNAS");
+        let delta = |price: &str, sequence: u64| {
+            OrderBookDelta::new(
+                instrument_id,
+                BookAction::Add,
+                BookOrder::new(
+                    OrderSide::Buy,
+                    Price::from(price),
+                    Quantity::from(1),
+                    sequence,
+                ),
+                0,
+                sequence,
+                sequence.into(),
+                sequence.into(),
+            )
+        };
+        let mut book = OrderBook::new(instrument_id, BookType::L3_MBO);
+        book.enable_sequencing(1);
+
+        book.apply_delta(&delta("100.00", 1));
+        book.apply_delta(&delta("102.00", 3));
+        assert_eq!(book.best_bid_price(), Some(Price::from("100.00")));
+
+        book.apply_delta(&delta("101.00", 2));
+        assert_eq!(book.best_bid_price(), Some(Price::from("102.00")));
+        assert_eq!(book.sequence, 3);
+        assert!(!book.is_stale());
+
+        // Overflowing the reorder buffer skips the missing sequence
+        book.apply_delta(&delta("104.00", 5));
+        book.apply_delta(&delta("105.00", 6));
+        assert!(book.is_stale());
+        assert_eq!(book.sequencer().unwrap().gaps(), 1);
+        assert_eq!(book.best_bid_price(), Some(Price::from("105.00")));
+
+        book.apply_delta(&OrderBookDelta::clear(instrument_id, 7, 7.into(), 7.into()));
+        assert!(!book.is_stale());
+        assert!(!book.has_bid());
+    }
+
     #[rstest]
     fn test_apply_depth(stub_depth10: OrderBookDepth10) {
         let depth = stub_depth10;
@@ -618,6 +1174,46 @@ mod tests {
         assert_eq!(book.best_ask_size().unwrap().as_f64(), 100.0);
     }
 
+    #[rstest]
+    fn test_apply_delta_slice(stub_deltas: OrderBookDeltas) {
+        let deltas = stub_deltas;
+        let mut book = OrderBook::new(deltas.instrument_id, BookType::L3_MBO);
+        let mut expected = OrderBook::new(deltas.instrument_id, BookType::L3_MBO);
+
+        book.apply_delta_slice(&deltas.deltas);
+        expected.apply_deltas(&deltas);
+
+        assert_eq!(book.count, deltas.deltas.len() as u64);
+        assert_eq!(book.sequence, expected.sequence);
+        assert_eq!(book.best_bid_price(), expected.best_bid_price());
+        assert_eq!(book.best_ask_price(), expected.best_ask_price());
+        assert_eq!(book.bids().count(), expected.bids().count());
+        assert_eq!(book.asks().count(), expected.asks().count());
+    }
+
+    #[rstest]
+    fn test_apply_depth_tick_indexed(stub_depth10: OrderBookDepth10) {
+        let depth = stub_depth10;
+        let instrument_id = InstrumentId::from("AAPL.XNAS");
+        let mut book =
+            OrderBook::new_tick_indexed(instrument_id, BookType::L2_MBP, Price::from("0.01"), 64);
+
+        book.apply_depth(&depth);
+
+        assert_eq!(book.best_bid_price().unwrap().as_f64(), 99.00);
+        assert_eq!(book.best_ask_price().unwrap().as_f64(), 100.00);
+        assert_eq!(book.bids().count(), 10);
+        assert_eq!(book.asks().count(), 10);
+        assert!(book
+            .bids()
+            .zip(book.bids().skip(1))
+            .all(|(a, b)| a.price.value > b.price.value));
+        assert!(book
+            .asks()
+            .zip(book.asks().skip(1))
+            .all(|(a, b)| a.price.value < b.price.value));
+    }
+
     #[rstest]
     fn test_orderbook_creation() {
         let instrument_id = InstrumentId::from("AAPL.XNAS");
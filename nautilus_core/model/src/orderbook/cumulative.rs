@@ -0,0 +1,301 @@
+// -------------------------------------------------------------------------------------------------
+//  Copyright (C) 2015-2024 Nautech Systems Pty Ltd. All rights reserved.
+//  https://nautechsystems.io
+//
+//  Licensed under the GNU Lesser General Public License Version 3.0 (the "License");
+//  You may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at https://www.gnu.org/licenses/lgpl-3.0.en.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+// -------------------------------------------------------------------------------------------------
+
+//! A cumulative depth index over the levels of one side of an order book.
+
+use super::level::Level;
+use crate::{
+    enums::OrderSide,
+    types::{fixed::FIXED_SCALAR, price::Price, quantity::Quantity},
+};
+
+/// Provides integer prefix sums of size and notional over the levels of a ladder.
+///
+/// Level `i` holds the totals for all levels from the best price through `i`, so fill
+/// quantity and average price queries reduce to a binary search. Notional is held as
+/// `price.raw * size.raw` in 128 bits so the sums are exact.
+///
+/// The owning ladder keeps the index current with [`CumulativeDepth::update_level`],
+/// which only patches the sums from the changed level onwards.
+#[derive(Clone, Debug, Default)]
+pub struct CumulativeDepth {
+    prices: Vec<i64>,
+    sizes: Vec<u64>,
+    notionals: Vec<i128>,
+}
+
+impl CumulativeDepth {
+    #[must_use]
+    pub fn len(&self) -> usize {
+        self.prices.len()
+    }
+
+    #[must_use]
+    pub fn is_empty(&self) -> bool {
+        self.prices.is_empty()
+    }
+
+    /// Rebuilds the prefix sums from the given levels, ordered from best to worst price.
+    ///
+    /// The existing buffers are reused, so a warmed up index does not allocate.
+    pub fn rebuild<'a>(&mut self, levels: impl Iterator<Item = &'a Level>) {
+        self.prices.clear();
+        self.sizes.clear();
+        self.notionals.clear();
+
+        let mut size = 0u64;
+        let mut notional = 0i128;
+        for level in levels {
+            let price_raw = level.price.value.raw;
+            let size_raw = level.size_raw();
+            size += size_raw;
+            notional += i128::from(price_raw) * i128::from(size_raw);
+            self.prices.push(price_raw);
+            self.sizes.push(size);
+            self.notionals.push(notional);
+        }
+    }
+
+    pub fn clear(&mut self) {
+        self.prices.clear();
+        self.sizes.clear();
+        self.notionals.clear();
+    }
+
+    /// Applies a change in the size of the level at `price_raw` from `old_size` to
+    /// `new_size`, where `side` is the side of the indexed ladder.
+    ///
+    /// Only the sums from the changed level onwards are patched. A level is inserted when
+    /// `old_size` is zero (it is not yet indexed) and removed when `new_size` is zero.
+    pub fn update_level(&mut self, side: OrderSide, price_raw: i64, old_size: u64, new_size: u64) {
+        if old_size == new_size {
+            return;
+        }
+
+        let index = match side {
+            OrderSide::Buy => self.prices.partition_point(|&p| p > price_raw),
+            OrderSide::Sell => self.prices.partition_point(|&p| p < price_raw),
+            _ => panic!("Invalid `OrderSide` {side}"),
+        };
+        let exists = self.prices.get(index) == Some(&price_raw);
+
+        if !exists {
+            if new_size == 0 {
+                return;
+            }
+            let (size_before, notional_before) = match index {
+                0 => (0, 0),
+                _ => (self.sizes[index - 1], self.notionals[index - 1]),
+            };
+            self.prices.insert(index, price_raw);
+            self.sizes.insert(index, size_before);
+            self.notionals.insert(index, notional_before);
+        } else if new_size == 0 {
+            self.prices.remove(index);
+            self.sizes.remove(index);
+            self.notionals.remove(index);
+            self.shift_from(index, price_raw, -i128::from(old_size));
+            return;
+        }
+
+        let size_delta = i128::from(new_size) - i128::from(old_size);
+        self.shift_from(index, price_raw, size_delta);
+    }
+
+    /// Adds `size_delta` at `price_raw` to the sums of every level from `index` onwards.
+    fn shift_from(&mut self, index: usize, price_raw: i64, size_delta: i128) {
+        let notional_delta = i128::from(price_raw) * size_delta;
+        for size in &mut self.sizes[index..] {
+            *size = (i128::from(*size) + size_delta) as u64;
+        }
+        for notional in &mut self.notionals[index..] {
+            *notional += notional_delta;
+        }
+    }
+
+    /// Returns the total quantity available at prices at or better than `price`, where
+    /// `side` is the side of the indexed ladder.
+    #[must_use]
+    pub fn quantity_for_price(&self, price: Price, side: OrderSide) -> f64 {
+        let count = match side {
+            OrderSide::Buy => self.prices.partition_point(|&p| p >= price.raw),
+            OrderSide::Sell => self.prices.partition_point(|&p| p <= price.raw),
+            _ => panic!("Invalid `OrderSide` {side}"),
+        };
+
+        match count {
+            0 => 0.0,
+            n => self.sizes[n - 1] as f64 / FIXED_SCALAR,
+        }
+    }
+
+    /// Returns the average price to fill `qty` by walking the indexed levels, or the
+    /// average price of all levels if there is insufficient quantity.
+    #[must_use]
+    pub fn avg_px_for_quantity(&self, qty: Quantity) -> f64 {
+        if self.is_empty() || qty.raw == 0 {
+            return 0.0;
+        }
+
+        // Index of the first level at which the cumulative size reaches `qty`
+        let i = self.sizes.partition_point(|&s| s < qty.raw);
+        let (size, notional) = if i == self.len() {
+            (self.sizes[i - 1], self.notionals[i - 1])
+        } else {
+            let (size_before, notional_before) = match i {
+                0 => (0, 0),
+                _ => (self.sizes[i - 1], self.notionals[i - 1]),
+            };
+            let remainder = qty.raw - size_before;
+            let notional = notional_before + i128::from(self.prices[i]) * i128::from(remainder);
+            (qty.raw, notional)
+        };
+
+        notional as f64 / (size as f64 * FIXED_SCALAR)
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Tests
+////////////////////////////////////////////////////////////////////////////////
+#[cfg(test)]
+mod tests {
+    use rstest::rstest;
+
+    use crate::{
+        data::order::BookOrder,
+        enums::OrderSide,
+        orderbook::{cumulative::CumulativeDepth, level::Level},
+        types::{price::Price, quantity::Quantity},
+    };
+
+    fn level(side: OrderSide, price: &str, size: &str) -> Level {
+        Level::from_order(BookOrder::new(
+            side,
+            Price::from(price),
+            Quantity::from(size),
+            0,
+        ))
+    }
+
+    #[rstest]
+    fn test_empty_index() {
+        let depth = CumulativeDepth::default();
+        assert!(depth.is_empty());
+        assert_eq!(
+            depth.quantity_for_price(Price::from("1.00"), OrderSide::Sell),
+            0.0
+        );
+        assert_eq!(depth.avg_px_for_quantity(Quantity::from(1)), 0.0);
+    }
+
+    #[rstest]
+    fn test_ask_side_queries() {
+        let levels = vec![
+            level(OrderSide::Sell, "2.000", "1.0"),
+            level(OrderSide::Sell, "2.010", "2.0"),
+            level(OrderSide::Sell, "2.011", "3.0"),
+        ];
+        let mut depth = CumulativeDepth::default();
+        depth.rebuild(levels.iter());
+
+        assert_eq!(depth.len(), 3);
+        assert_eq!(
+            depth.quantity_for_price(Price::from("1.999"), OrderSide::Sell),
+            0.0
+        );
+        assert_eq!(
+            depth.quantity_for_price(Price::from("2.010"), OrderSide::Sell),
+            3.0
+        );
+        assert_eq!(
+            depth.quantity_for_price(Price::from("9.000"), OrderSide::Sell),
+            6.0
+        );
+        assert_eq!(depth.avg_px_for_quantity(Quantity::from("0.5")), 2.0);
+        assert_eq!(
+            depth.avg_px_for_quantity(Quantity::from("1.5")),
+            2.003_333_333_333_333_4
+        );
+        assert_eq!(
+            depth.avg_px_for_quantity(Quantity::from("100.0")),
+            (2.0 + 2.010 * 2.0 + 2.011 * 3.0) / 6.0
+        );
+    }
+
+    #[rstest]
+    fn test_update_level_matches_rebuild() {
+        let mut levels = vec![
+            level(OrderSide::Sell, "2.000", "1.0"),
+            level(OrderSide::Sell, "2.010", "2.0"),
+            level(OrderSide::Sell, "2.011", "3.0"),
+        ];
+        let mut depth = CumulativeDepth::default();
+        for level in &levels {
+            depth.update_level(OrderSide::Sell, level.price.value.raw, 0, level.size_raw());
+        }
+
+        let mut expected = CumulativeDepth::default();
+        expected.rebuild(levels.iter());
+        assert_eq!(depth.sizes, expected.sizes);
+        assert_eq!(depth.notionals, expected.notionals);
+
+        // Resize the middle level, insert a new best and remove the worst
+        let middle = Quantity::from("2.0").raw;
+        let price = Price::from("2.010").raw;
+        depth.update_level(OrderSide::Sell, price, middle, Quantity::from("5.0").raw);
+        let best = level(OrderSide::Sell, "1.990", "4.0");
+        depth.update_level(OrderSide::Sell, best.price.value.raw, 0, best.size_raw());
+        let worst = Price::from("2.011").raw;
+        depth.update_level(OrderSide::Sell, worst, Quantity::from("3.0").raw, 0);
+
+        levels[1] = level(OrderSide::Sell, "2.010", "5.0");
+        levels.pop();
+        levels.insert(0, best);
+        expected.rebuild(levels.iter());
+        assert_eq!(depth.prices, expected.prices);
+        assert_eq!(depth.sizes, expected.sizes);
+        assert_eq!(depth.notionals, expected.notionals);
+    }
+
+    #[rstest]
+    fn test_bid_side_queries() {
+        let levels = vec![
+            level(OrderSide::Buy, "1.000", "1.0"),
+            level(OrderSide::Buy, "0.990", "2.0"),
+        ];
+        let mut depth = CumulativeDepth::default();
+        depth.rebuild(levels.iter());
+
+        assert_eq!(
+            depth.quantity_for_price(Price::from("0.990"), OrderSide::Buy),
+            3.0
+        );
+        assert_eq!(
+            depth.quantity_for_price(Price::from("1.001"), OrderSide::Buy),
+            0.0
+        );
+        assert_eq!(
+            depth.avg_px_for_quantity(Quantity::from("1.5")),
+            0.996_666_666_666_666_7
+        );
+
+        depth.rebuild(levels[1..].iter());
+        assert_eq!(
+            depth.quantity_for_price(Price::from("0.990"), OrderSide::Buy),
+            2.0
+        );
+    }
+}
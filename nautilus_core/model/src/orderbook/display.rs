@@ -17,7 +17,7 @@
 
 use tabled::{settings::Style, Table, Tabled};
 
-use super::{ladder::BookPrice, level::Level};
+use super::level::Level;
 use crate::orderbook::ladder::Ladder;
 
 #[derive(Tabled)]
@@ -30,28 +30,29 @@ struct OrderLevelDisplay {
 /// Return a [`String`] representation of the order book in a human-readable table format.
 #[must_use]
 pub fn pprint_book(bids: &Ladder, asks: &Ladder, num_levels: usize) -> String {
-    let ask_levels: Vec<(&BookPrice, &Level)> = asks.levels.iter().take(num_levels).rev().collect();
-    let bid_levels: Vec<(&BookPrice, &Level)> = bids.levels.iter().take(num_levels).collect();
-    let levels: Vec<(&BookPrice, &Level)> = ask_levels.into_iter().chain(bid_levels).collect();
+    let mut ask_levels: Vec<&Level> = asks.levels().take(num_levels).collect();
+    ask_levels.reverse();
+    let bid_levels: Vec<&Level> = bids.levels().take(num_levels).collect();
+    let levels: Vec<&Level> = ask_levels.into_iter().chain(bid_levels).collect();
 
     let data: Vec<OrderLevelDisplay> = levels
         .iter()
-        .map(|(book_price, level)| {
-            let is_bid_level = bids.levels.contains_key(book_price);
-            let is_ask_level = asks.levels.contains_key(book_price);
+        .map(|level| {
+            let is_bid_level = bids.get(&level.price).is_some();
+            let is_ask_level = asks.get(&level.price).is_some();
 
             let bid_sizes: Vec<String> = level
                 .orders
-                .iter()
+                .values()
                 .filter(|_| is_bid_level)
-                .map(|order| format!("{}", order.1.size))
+                .map(|order| format!("{}", order.size))
                 .collect();
 
             let ask_sizes: Vec<String> = level
                 .orders
-                .iter()
+                .values()
                 .filter(|_| is_ask_level)
-                .map(|order| format!("{}", order.1.size))
+                .map(|order| format!("{}", order.size))
                 .collect();
 
             OrderLevelDisplay {
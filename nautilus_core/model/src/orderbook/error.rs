@@ -43,3 +43,23 @@ pub enum BookIntegrityError {
     #[error("Integrity error: number of {0} levels > 1 for L1_MBP book, was {1}")]
     TooManyLevels(OrderSide, usize),
 }
+
+#[derive(thiserror::Error, Debug)]
+pub enum BookSnapshotError {
+    #[error("Invalid book snapshot: magic bytes not found")]
+    InvalidMagic,
+    #[error("Invalid book snapshot: unsupported version {0}")]
+    UnsupportedVersion(u8),
+    #[error("Invalid book snapshot: truncated at byte {0}")]
+    Truncated(usize),
+    #[error("Invalid book snapshot: invalid {0} value {1}")]
+    InvalidValue(&'static str, i64),
+    #[error("Invalid book snapshot: invalid instrument ID: {0}")]
+    InvalidInstrumentId(String),
+}
+
+#[derive(thiserror::Error, Debug, Clone, Copy, PartialEq, Eq)]
+pub enum BookManagerError {
+    #[error("Book manager worker {0} has stopped")]
+    WorkerStopped(usize),
+}
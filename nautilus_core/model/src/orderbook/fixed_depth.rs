@@ -0,0 +1,258 @@
+// -------------------------------------------------------------------------------------------------
+//  Copyright (C) 2015-2024 Nautech Systems Pty Ltd. All rights reserved.
+//  https://nautechsystems.io
+//
+//  Licensed under the GNU Lesser General Public License Version 3.0 (the "License");
+//  You may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at https://www.gnu.org/licenses/lgpl-3.0.en.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+// -------------------------------------------------------------------------------------------------
+
+//! Fixed-size storage for an order book which is only ever updated from full MBP-10
+//! depth snapshots.
+
+use std::sync::OnceLock;
+
+use super::{aggregation::pre_process_order, ladder::Ladder};
+use crate::{
+    data::{
+        depth::{OrderBookDepth10, DEPTH10_LEN},
+        order::{BookOrder, NULL_ORDER},
+    },
+    enums::{BookType, OrderSide},
+    types::{price::Price, quantity::Quantity},
+};
+
+/// Provides the top ten levels of each side of an order book, held in the same fixed
+/// arrays as an [`OrderBookDepth10`].
+///
+/// Applying a depth snapshot is a plain copy of its arrays. Each array holds one
+/// aggregated order per level from best to worst price, and ends at the first entry
+/// without a side or size. Ladders of [`super::level::Level`] are only built on demand,
+/// for callers which need to iterate levels.
+#[derive(Clone, Debug)]
+pub struct FixedDepth {
+    bids: [BookOrder; DEPTH10_LEN],
+    asks: [BookOrder; DEPTH10_LEN],
+    bid_counts: [u32; DEPTH10_LEN],
+    ask_counts: [u32; DEPTH10_LEN],
+    bid_len: usize,
+    ask_len: usize,
+    ladders: OnceLock<(Ladder, Ladder)>,
+}
+
+impl Default for FixedDepth {
+    fn default() -> Self {
+        Self {
+            bids: [NULL_ORDER; DEPTH10_LEN],
+            asks: [NULL_ORDER; DEPTH10_LEN],
+            bid_counts: [0; DEPTH10_LEN],
+            ask_counts: [0; DEPTH10_LEN],
+            bid_len: 0,
+            ask_len: 0,
+            ladders: OnceLock::new(),
+        }
+    }
+}
+
+impl FixedDepth {
+    /// Replaces both sides with the levels of the given `depth`.
+    pub fn load(&mut self, depth: &OrderBookDepth10) {
+        self.bids = depth.bids;
+        self.asks = depth.asks;
+        self.bid_counts = depth.bid_counts;
+        self.ask_counts = depth.ask_counts;
+        self.bid_len = filled_len(&self.bids);
+        self.ask_len = filled_len(&self.asks);
+        self.ladders.take();
+    }
+
+    /// Replaces the levels of the given `side` with `orders` and their order `counts`,
+    /// keeping at most the first ten.
+    pub fn load_side(&mut self, side: OrderSide, orders: &[BookOrder], counts: &[u32]) {
+        let (dst_orders, dst_counts, len) = match side {
+            OrderSide::Buy => (&mut self.bids, &mut self.bid_counts, &mut self.bid_len),
+            OrderSide::Sell => (&mut self.asks, &mut self.ask_counts, &mut self.ask_len),
+            _ => panic!("Invalid `OrderSide` {side}"),
+        };
+        let n = orders.len().min(counts.len()).min(DEPTH10_LEN);
+        dst_orders[..n].copy_from_slice(&orders[..n]);
+        dst_orders[n..].fill(NULL_ORDER);
+        dst_counts[..n].copy_from_slice(&counts[..n]);
+        dst_counts[n..].fill(0);
+        *len = filled_len(dst_orders);
+        self.ladders.take();
+    }
+
+    pub fn clear_bids(&mut self) {
+        self.bid_len = 0;
+        self.ladders.take();
+    }
+
+    pub fn clear_asks(&mut self) {
+        self.ask_len = 0;
+        self.ladders.take();
+    }
+
+    /// Returns the bid levels from best to worst price.
+    #[must_use]
+    pub fn bids(&self) -> &[BookOrder] {
+        &self.bids[..self.bid_len]
+    }
+
+    /// Returns the ask levels from best to worst price.
+    #[must_use]
+    pub fn asks(&self) -> &[BookOrder] {
+        &self.asks[..self.ask_len]
+    }
+
+    /// Returns the order counts of the levels of the given `side` from best to worst price.
+    #[must_use]
+    pub fn counts(&self, side: OrderSide) -> &[u32] {
+        match side {
+            OrderSide::Buy => &self.bid_counts[..self.bid_len],
+            OrderSide::Sell => &self.ask_counts[..self.ask_len],
+            _ => panic!("Invalid `OrderSide` {side}"),
+        }
+    }
+
+    /// Writes the raw price, raw size and order count of the levels of the given `side`
+    /// into the given buffers, returning the number of levels written.
+    pub fn write_depth(
+        &self,
+        side: OrderSide,
+        prices: &mut [i64],
+        sizes: &mut [u64],
+        counts: &mut [u32],
+    ) -> usize {
+        let (orders, level_counts) = match side {
+            OrderSide::Buy => (self.bids(), &self.bid_counts),
+            OrderSide::Sell => (self.asks(), &self.ask_counts),
+            _ => panic!("Invalid `OrderSide` {side}"),
+        };
+        let n = orders
+            .len()
+            .min(prices.len())
+            .min(sizes.len())
+            .min(counts.len());
+        for i in 0..n {
+            prices[i] = orders[i].price.raw;
+            sizes[i] = orders[i].size.raw;
+            counts[i] = level_counts[i];
+        }
+        n
+    }
+
+    /// Returns the ladders of both sides, building them on first use after a change.
+    pub fn ladders(&self) -> &(Ladder, Ladder) {
+        self.ladders.get_or_init(|| {
+            let mut bids = Ladder::new(OrderSide::Buy);
+            let mut asks = Ladder::new(OrderSide::Sell);
+            for order in self.bids() {
+                bids.add(pre_process_order(BookType::L2_MBP, *order, 0));
+            }
+            for order in self.asks() {
+                asks.add(pre_process_order(BookType::L2_MBP, *order, 0));
+            }
+            (bids, asks)
+        })
+    }
+}
+
+fn filled_len(orders: &[BookOrder; DEPTH10_LEN]) -> usize {
+    orders
+        .iter()
+        .position(|order| order.side == OrderSide::NoOrderSide || order.size.raw == 0)
+        .unwrap_or(DEPTH10_LEN)
+}
+
+/// Calculates the estimated fill quantity for a specified price from fixed levels of
+/// the opposite side to `order_side`.
+#[must_use]
+pub fn get_quantity_for_price(price: Price, order_side: OrderSide, levels: &[BookOrder]) -> f64 {
+    let mut matched_size: f64 = 0.0;
+
+    for level in levels {
+        match order_side {
+            OrderSide::Buy => {
+                if level.price > price {
+                    break;
+                }
+            }
+            OrderSide::Sell => {
+                if level.price < price {
+                    break;
+                }
+            }
+            _ => panic!("Invalid `OrderSide` {order_side}"),
+        }
+        matched_size += level.size.as_f64();
+    }
+
+    matched_size
+}
+
+/// Calculates the estimated average price for a specified quantity from fixed levels.
+#[must_use]
+pub fn get_avg_px_for_quantity(qty: Quantity, levels: &[BookOrder]) -> f64 {
+    let mut cumulative_size_raw = 0u64;
+    let mut cumulative_value = 0.0;
+
+    for level in levels {
+        let size_this_level = level.size.raw.min(qty.raw - cumulative_size_raw);
+        cumulative_size_raw += size_this_level;
+        cumulative_value += level.price.as_f64() * size_this_level as f64;
+
+        if cumulative_size_raw >= qty.raw {
+            break;
+        }
+    }
+
+    if cumulative_size_raw == 0 {
+        0.0
+    } else {
+        cumulative_value / cumulative_size_raw as f64
+    }
+}
+
+/// Simulates fills for the given `order` against fixed levels of the side it would
+/// trade with, where `levels_side` is the side of those levels.
+#[must_use]
+pub fn simulate_fills(
+    order: &BookOrder,
+    levels: &[BookOrder],
+    levels_side: OrderSide,
+) -> Vec<(Price, Quantity)> {
+    let is_reversed = levels_side == OrderSide::Buy;
+    let mut fills = Vec::new();
+    let mut cumulative_denominator = Quantity::zero(order.size.precision);
+    let target = order.size;
+
+    for level in levels {
+        if (is_reversed && level.price < order.price) || (!is_reversed && level.price > order.price)
+        {
+            break;
+        }
+
+        let current = level.size;
+        if cumulative_denominator + current >= target {
+            // This level has filled us, add fill and return
+            let remainder = target - cumulative_denominator;
+            if remainder.is_positive() {
+                fills.push((level.price, remainder));
+            }
+            return fills;
+        }
+
+        // Add this fill and continue
+        fills.push((level.price, current));
+        cumulative_denominator += current;
+    }
+
+    fills
+}
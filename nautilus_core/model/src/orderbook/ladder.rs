@@ -17,7 +17,7 @@
 
 use std::{
     cmp::Ordering,
-    collections::{BTreeMap, HashMap},
+    collections::{btree_map, BTreeMap, HashMap},
     fmt::{Display, Formatter},
 };
 
@@ -26,7 +26,11 @@ use nautilus_core::nanos::UnixNanos;
 use crate::{
     data::order::{BookOrder, OrderId},
     enums::{OrderSide, OrderSideSpecified},
-    orderbook::level::Level,
+    orderbook::{
+        cumulative::CumulativeDepth,
+        level::Level,
+        tick_ladder::{TickLadder, TickLadderIter},
+    },
     types::{price::Price, quantity::Quantity},
 };
 
@@ -75,12 +79,106 @@ impl Display for BookPrice {
     }
 }
 
+/// The storage backing the price levels of a [`Ladder`].
+#[derive(Clone, Debug)]
+enum LadderLevels {
+    /// Levels keyed by price in a B-tree, suitable for any price grid.
+    Tree(BTreeMap<BookPrice, Level>),
+    /// Levels held in a contiguous array indexed by tick.
+    Tick(TickLadder),
+}
+
+impl LadderLevels {
+    fn len(&self) -> usize {
+        match self {
+            Self::Tree(levels) => levels.len(),
+            Self::Tick(levels) => levels.len(),
+        }
+    }
+
+    fn is_empty(&self) -> bool {
+        match self {
+            Self::Tree(levels) => levels.is_empty(),
+            Self::Tick(levels) => levels.is_empty(),
+        }
+    }
+
+    fn clear(&mut self) {
+        match self {
+            Self::Tree(levels) => levels.clear(),
+            Self::Tick(levels) => levels.clear(),
+        }
+    }
+
+    fn get(&self, price: &BookPrice) -> Option<&Level> {
+        match self {
+            Self::Tree(levels) => levels.get(price),
+            Self::Tick(levels) => levels.get(price),
+        }
+    }
+
+    fn get_mut(&mut self, price: &BookPrice) -> Option<&mut Level> {
+        match self {
+            Self::Tree(levels) => levels.get_mut(price),
+            Self::Tick(levels) => levels.get_mut(price),
+        }
+    }
+
+    fn insert(&mut self, price: BookPrice, level: Level) {
+        match self {
+            Self::Tree(levels) => {
+                levels.insert(price, level);
+            }
+            Self::Tick(levels) => levels.insert(price, level),
+        }
+    }
+
+    fn remove(&mut self, price: &BookPrice) -> Option<Level> {
+        match self {
+            Self::Tree(levels) => levels.remove(price),
+            Self::Tick(levels) => levels.remove(price),
+        }
+    }
+
+    fn first(&self) -> Option<&Level> {
+        match self {
+            Self::Tree(levels) => levels.values().next(),
+            Self::Tick(levels) => levels.first(),
+        }
+    }
+
+    fn iter(&self) -> LevelsIter<'_> {
+        match self {
+            Self::Tree(levels) => LevelsIter::Tree(levels.values()),
+            Self::Tick(levels) => LevelsIter::Tick(levels.iter()),
+        }
+    }
+}
+
+/// Iterates the levels of a [`Ladder`] from best to worst price.
+pub enum LevelsIter<'a> {
+    Tree(btree_map::Values<'a, BookPrice, Level>),
+    Tick(TickLadderIter<'a>),
+}
+
+impl<'a> Iterator for LevelsIter<'a> {
+    type Item = &'a Level;
+
+    fn next(&mut self) -> Option<Self::Item> {
+        match self {
+            Self::Tree(iter) => iter.next(),
+            Self::Tick(iter) => iter.next(),
+        }
+    }
+}
+
 /// Represents a ladder of price levels for one side of an order book.
 #[derive(Clone, Debug)]
 pub struct Ladder {
     pub side: OrderSide,
-    pub levels: BTreeMap<BookPrice, Level>,
     pub cache: HashMap<u64, BookPrice>,
+    levels: LadderLevels,
+    depth: Option<CumulativeDepth>,
 }
 
 impl Ladder {
@@ -88,8 +186,84 @@ impl Ladder {
     pub fn new(side: OrderSide) -> Self {
         Self {
             side,
-            levels: BTreeMap::new(),
             cache: HashMap::new(),
+            levels: LadderLevels::Tree(BTreeMap::new()),
+            depth: None,
+        }
+    }
+
+    /// Creates a new [`Ladder`] instance with its levels held in a tick-indexed array.
+    ///
+    /// Intended for instruments which trade on a fixed `price_increment`, where
+    /// `capacity` is the number of ticks held in the array window.
+    ///
+    /// # Panics
+    ///
+    /// This function panics:
+    /// - If `price_increment` is not positive.
+    /// - If `capacity` is zero.
+    #[must_use]
+    pub fn new_tick_indexed(side: OrderSide, price_increment: Price, capacity: usize) -> Self {
+        Self {
+            side,
+            cache: HashMap::new(),
+            levels: LadderLevels::Tick(TickLadder::new(side, price_increment, capacity)),
+            depth: None,
+        }
+    }
+
+    /// Returns whether the levels are held in a tick-indexed array.
+    #[must_use]
+    pub fn is_tick_indexed(&self) -> bool {
+        matches!(self.levels, LadderLevels::Tick(_))
+    }
+
+    /// Returns the price increment and capacity of the tick-indexed array (if any).
+    #[must_use]
+    pub fn tick_config(&self) -> Option<(Price, usize)> {
+        match &self.levels {
+            LadderLevels::Tree(_) => None,
+            LadderLevels::Tick(levels) => Some((levels.price_increment(), levels.capacity())),
+        }
+    }
+
+    /// Enables the cumulative depth index for the ladder.
+    ///
+    /// The index is built once from the current levels, then each change to the ladder
+    /// patches it from the changed level onwards.
+    pub fn enable_cumulative_depth(&mut self) {
+        if self.depth.is_none() {
+            let mut depth = CumulativeDepth::default();
+            depth.rebuild(self.levels.iter());
+            self.depth = Some(depth);
+        }
+    }
+
+    /// Returns whether the cumulative depth index is enabled.
+    #[must_use]
+    pub fn has_cumulative_depth(&self) -> bool {
+        self.depth.is_some()
+    }
+
+    /// Returns the cumulative depth index (if enabled).
+    #[must_use]
+    pub fn cumulative_depth(&self) -> Option<&CumulativeDepth> {
+        self.depth.as_ref()
+    }
+
+    /// Returns the raw size of the level at `price` when the depth index is enabled.
+    fn indexed_size(&self, price: &BookPrice) -> u64 {
+        match self.depth {
+            Some(_) => self.levels.get(price).map_or(0, Level::size_raw),
+            None => 0,
+        }
+    }
+
+    /// Patches the depth index (if enabled) for a change to the level at `price`.
+    fn sync_depth(&mut self, price: &BookPrice, old_size: u64) {
+        let new_size = self.indexed_size(price);
+        if let Some(depth) = &mut self.depth {
+            depth.update_level(self.side, price.value.raw, old_size, new_size);
         }
     }
 
@@ -103,6 +277,17 @@ impl Ladder {
         self.levels.is_empty()
     }
 
+    /// Returns an iterator over the levels from best to worst price.
+    #[must_use]
+    pub fn levels(&self) -> LevelsIter<'_> {
+        self.levels.iter()
+    }
+
+    #[must_use]
+    pub fn get(&self, price: &BookPrice) -> Option<&Level> {
+        self.levels.get(price)
+    }
+
     pub fn add_bulk(&mut self, orders: Vec<BookOrder>) {
         for order in orders {
             self.add(order);
@@ -112,10 +297,14 @@ impl Ladder {
     pub fn clear(&mut self) {
         self.levels.clear();
         self.cache.clear();
+        if let Some(depth) = &mut self.depth {
+            depth.clear();
+        }
     }
 
     pub fn add(&mut self, order: BookOrder) {
         let book_price = order.to_book_price();
+        let old_size = self.indexed_size(&book_price);
         self.cache.insert(order.order_id, book_price);
 
         match self.levels.get_mut(&book_price) {
@@ -127,15 +316,18 @@ impl Ladder {
                 self.levels.insert(book_price, level);
             }
         }
+        self.sync_depth(&book_price, old_size);
     }
 
     pub fn update(&mut self, order: BookOrder) {
         let price = self.cache.get(&order.order_id).copied();
         if let Some(price) = price {
+            let old_size = self.indexed_size(&price);
             if let Some(level) = self.levels.get_mut(&price) {
                 if order.price == level.price.value {
                     // Update at current price level
                     level.update(order);
+                    self.sync_depth(&price, old_size);
                     return;
                 }
 
@@ -145,6 +337,7 @@ impl Ladder {
                 if level.is_empty() {
                     self.levels.remove(&price);
                 }
+                self.sync_depth(&price, old_size);
             }
         }
 
@@ -157,34 +350,46 @@ impl Ladder {
 
     pub fn remove(&mut self, order_id: OrderId, sequence: u64, ts_event: UnixNanos) {
         if let Some(price) = self.cache.remove(&order_id) {
+            let old_size = self.indexed_size(&price);
             if let Some(level) = self.levels.get_mut(&price) {
                 level.remove_by_id(order_id, sequence, ts_event);
                 if level.is_empty() {
                     self.levels.remove(&price);
                 }
+                self.sync_depth(&price, old_size);
             }
         }
     }
 
     #[must_use]
     pub fn sizes(&self) -> f64 {
-        self.levels.values().map(super::level::Level::size).sum()
+        self.levels.iter().map(super::level::Level::size).sum()
     }
 
     #[must_use]
     pub fn exposures(&self) -> f64 {
-        self.levels
-            .values()
-            .map(super::level::Level::exposure)
-            .sum()
+        self.levels.iter().map(super::level::Level::exposure).sum()
     }
 
     #[must_use]
     pub fn top(&self) -> Option<&Level> {
-        match self.levels.iter().next() {
-            Some((_, l)) => Option::Some(l),
-            None => Option::None,
+        self.levels.first()
+    }
+
+    /// Writes the raw price, raw size and order count of the levels from best to worst
+    /// price into the given buffers, returning the number of levels written.
+    ///
+    /// At most the length of the shortest buffer is written, with no allocation.
+    pub fn write_depth(&self, prices: &mut [i64], sizes: &mut [u64], counts: &mut [u32]) -> usize {
+        let n = prices.len().min(sizes.len()).min(counts.len());
+        let mut written = 0;
+        for (i, level) in self.levels.iter().take(n).enumerate() {
+            prices[i] = level.price.value.raw;
+            sizes[i] = level.size_raw();
+            counts[i] = level.len() as u32;
+            written += 1;
         }
+        written
     }
 
     #[must_use]
@@ -194,7 +399,7 @@ impl Ladder {
         let mut cumulative_denominator = Quantity::zero(order.size.precision);
         let target = order.size;
 
-        for level in self.levels.values() {
+        for level in self.levels.iter() {
             if (is_reversed && level.price.value < order.price)
                 || (!is_reversed && level.price.value > order.price)
             {
@@ -232,7 +437,10 @@ mod tests {
     use crate::{
         data::order::BookOrder,
         enums::OrderSide,
-        orderbook::ladder::{BookPrice, Ladder},
+        orderbook::{
+            cumulative::CumulativeDepth,
+            ladder::{BookPrice, Ladder},
+        },
         types::{price::Price, quantity::Quantity},
     };
 
@@ -681,6 +889,111 @@ mod tests {
         assert_eq!(size3, Quantity::from("399.999999999"));
     }
 
+    #[rstest]
+    fn test_tick_indexed_matches_tree_ladder() {
+        let mut tree = Ladder::new(OrderSide::Sell);
+        let mut tick = Ladder::new_tick_indexed(OrderSide::Sell, Price::from("0.01"), 64);
+        assert!(tick.is_tick_indexed());
+
+        let orders = vec![
+            BookOrder::new(OrderSide::Sell, Price::from("10.05"), Quantity::from(20), 1),
+            BookOrder::new(OrderSide::Sell, Price::from("10.01"), Quantity::from(30), 2),
+            BookOrder::new(OrderSide::Sell, Price::from("10.01"), Quantity::from(50), 3),
+            BookOrder::new(OrderSide::Sell, Price::from("12.00"), Quantity::from(10), 4),
+        ];
+        tree.add_bulk(orders.clone());
+        tick.add_bulk(orders);
+
+        let update = BookOrder::new(OrderSide::Sell, Price::from("9.99"), Quantity::from(30), 2);
+        tree.update(update);
+        tick.update(update);
+        tree.remove(4, 0, 0.into());
+        tick.remove(4, 0, 0.into());
+
+        let tree_levels: Vec<Price> = tree.levels().map(|l| l.price.value).collect();
+        let tick_levels: Vec<Price> = tick.levels().map(|l| l.price.value).collect();
+        assert_eq!(tick_levels, tree_levels);
+        assert_eq!(tick.len(), 3);
+        assert_eq!(tick.sizes(), tree.sizes());
+        assert_eq!(tick.top().unwrap().price.value, Price::from("9.99"));
+    }
+
+    #[rstest]
+    fn test_write_depth() {
+        let mut ladder = Ladder::new(OrderSide::Buy);
+        ladder.add_bulk(vec![
+            BookOrder::new(OrderSide::Buy, Price::from("10.00"), Quantity::from(20), 1),
+            BookOrder::new(OrderSide::Buy, Price::from("11.00"), Quantity::from(30), 2),
+            BookOrder::new(OrderSide::Buy, Price::from("11.00"), Quantity::from(50), 3),
+            BookOrder::new(OrderSide::Buy, Price::from("9.00"), Quantity::from(10), 4),
+        ]);
+
+        let mut prices = [0i64; 2];
+        let mut sizes = [0u64; 2];
+        let mut counts = [0u32; 2];
+        let written = ladder.write_depth(&mut prices, &mut sizes, &mut counts);
+
+        assert_eq!(written, 2);
+        assert_eq!(prices, [Price::from("11.00").raw, Price::from("10.00").raw]);
+        assert_eq!(sizes, [Quantity::from(80).raw, Quantity::from(20).raw]);
+        assert_eq!(counts, [2, 1]);
+
+        let mut prices = [0i64; 8];
+        let mut sizes = [0u64; 8];
+        let mut counts = [0u32; 8];
+        assert_eq!(ladder.write_depth(&mut prices, &mut sizes, &mut counts), 3);
+        assert_eq!(prices[2], Price::from("9.00").raw);
+    }
+
+    #[rstest]
+    fn test_cumulative_depth_patched_on_changes() {
+        let mut ladder = Ladder::new(OrderSide::Sell);
+        ladder.add(BookOrder::new(
+            OrderSide::Sell,
+            Price::from("10.00"),
+            Quantity::from(20),
+            1,
+        ));
+        ladder.enable_cumulative_depth();
+
+        ladder.add_bulk(vec![
+            BookOrder::new(OrderSide::Sell, Price::from("11.00"), Quantity::from(30), 2),
+            BookOrder::new(OrderSide::Sell, Price::from("11.00"), Quantity::from(50), 3),
+            BookOrder::new(OrderSide::Sell, Price::from("9.00"), Quantity::from(10), 4),
+        ]);
+        // Move order 1 to a new level, resize order 3 in place, then remove order 4
+        ladder.update(BookOrder::new(
+            OrderSide::Sell,
+            Price::from("12.00"),
+            Quantity::from(20),
+            1,
+        ));
+        ladder.update(BookOrder::new(
+            OrderSide::Sell,
+            Price::from("11.00"),
+            Quantity::from(5),
+            3,
+        ));
+        ladder.remove(4, 0, 0.into());
+
+        let mut expected = CumulativeDepth::default();
+        expected.rebuild(ladder.levels());
+        let depth = ladder.cumulative_depth().unwrap();
+
+        assert_eq!(depth.len(), 2);
+        for price in ["9.00", "11.00", "12.00"] {
+            let price = Price::from(price);
+            assert_eq!(
+                depth.quantity_for_price(price, OrderSide::Sell),
+                expected.quantity_for_price(price, OrderSide::Sell)
+            );
+        }
+        assert_eq!(
+            depth.avg_px_for_quantity(Quantity::from(50)),
+            expected.avg_px_for_quantity(Quantity::from(50))
+        );
+    }
+
     #[rstest]
     fn test_boundary_prices() {
         let max_price = Price::max(1);
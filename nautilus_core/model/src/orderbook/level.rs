@@ -15,20 +15,19 @@
 
 //! Represents a discrete price level in an order book.
 
-use std::{cmp::Ordering, collections::BTreeMap};
+use std::cmp::Ordering;
 
 use nautilus_core::nanos::UnixNanos;
 
 use crate::{
     data::order::{BookOrder, OrderId},
-    orderbook::{error::BookIntegrityError, ladder::BookPrice},
+    orderbook::{error::BookIntegrityError, ladder::BookPrice, queue::OrderQueue},
     types::fixed::FIXED_SCALAR,
 };
 
 /// Represents a discrete price level in an order book.
 ///
-/// The level maintains a collection of orders as well as tracking insertion order
-/// to preserve FIFO queue dynamics.
+/// The level maintains its orders in a FIFO queue to preserve time priority.
 #[derive(Clone, Debug, Eq)]
 #[cfg_attr(
     feature = "python",
@@ -36,8 +35,7 @@ use crate::{
 )]
 pub struct Level {
     pub price: BookPrice,
-    pub orders: BTreeMap<OrderId, BookOrder>,
-    insertion_order: Vec<OrderId>,
+    pub orders: OrderQueue,
 }
 
 impl Level {
@@ -45,18 +43,13 @@ impl Level {
     pub fn new(price: BookPrice) -> Self {
         Self {
             price,
-            orders: BTreeMap::new(),
-            insertion_order: Vec::new(),
+            orders: OrderQueue::new(),
         }
     }
 
     #[must_use]
     pub fn from_order(order: BookOrder) -> Self {
-        let mut level = Self {
-            price: order.to_book_price(),
-            orders: BTreeMap::new(),
-            insertion_order: Vec::new(),
-        };
+        let mut level = Self::new(order.to_book_price());
         level.add(order);
         level
     }
@@ -73,19 +66,13 @@ impl Level {
 
     #[must_use]
     pub fn first(&self) -> Option<&BookOrder> {
-        self.insertion_order
-            .first()
-            .and_then(|&id| self.orders.get(&id))
+        self.orders.first()
     }
 
     /// Returns the orders in the insertion order.
     #[must_use]
     pub fn get_orders(&self) -> Vec<BookOrder> {
-        self.insertion_order
-            .iter()
-            .filter_map(|id| self.orders.get(id))
-            .copied()
-            .collect()
+        self.orders.values().copied().collect()
     }
 
     #[must_use]
@@ -115,20 +102,15 @@ impl Level {
     }
 
     pub fn add_bulk(&mut self, orders: Vec<BookOrder>) {
-        self.insertion_order
-            .extend(orders.iter().map(|o| o.order_id));
-
         for order in orders {
-            self.check_order_for_this_level(&order);
-            self.orders.insert(order.order_id, order);
+            self.add(order);
         }
     }
 
     pub fn add(&mut self, order: BookOrder) {
         self.check_order_for_this_level(&order);
 
-        self.orders.insert(order.order_id, order);
-        self.insertion_order.push(order.order_id);
+        self.orders.push_back(order);
     }
 
     pub fn update(&mut self, order: BookOrder) {
@@ -136,15 +118,13 @@ impl Level {
 
         if order.size.raw == 0 {
             self.orders.remove(&order.order_id);
-            self.update_insertion_order();
         } else {
-            self.orders.insert(order.order_id, order);
+            self.orders.update(order);
         }
     }
 
     pub fn delete(&mut self, order: &BookOrder) {
         self.orders.remove(&order.order_id);
-        self.update_insertion_order();
     }
 
     pub fn remove_by_id(&mut self, order_id: OrderId, sequence: u64, ts_event: UnixNanos) {
@@ -153,17 +133,11 @@ impl Level {
             "{}",
             &BookIntegrityError::OrderNotFound(order_id, sequence, ts_event)
         );
-        self.update_insertion_order();
     }
 
     fn check_order_for_this_level(&self, order: &BookOrder) {
         assert_eq!(order.price, self.price.value);
     }
-
-    fn update_insertion_order(&mut self) {
-        self.insertion_order
-            .retain(|&id| self.orders.contains_key(&id));
-    }
 }
 
 impl PartialEq for Level {
@@ -342,6 +316,29 @@ mod tests {
         assert_eq!(level.exposure(), 10.0);
     }
 
+    #[rstest]
+    fn test_remove_order_from_middle_preserves_time_priority() {
+        let mut level = Level::new(BookPrice::new(Price::from("1.00"), OrderSide::Buy));
+        for order_id in [5, 3, 9, 1] {
+            let order = BookOrder::new(
+                OrderSide::Buy,
+                Price::from("1.00"),
+                Quantity::from(10),
+                order_id,
+            );
+            level.add(order);
+        }
+
+        level.remove_by_id(9, 0, 0.into());
+        let update = BookOrder::new(OrderSide::Buy, Price::from("1.00"), Quantity::from(5), 5);
+        level.update(update);
+
+        let order_ids: Vec<u64> = level.get_orders().iter().map(|o| o.order_id).collect();
+        assert_eq!(order_ids, vec![5, 3, 1]);
+        assert_eq!(level.first().unwrap().size, Quantity::from(5));
+        assert_eq!(level.size(), 25.0);
+    }
+
     #[rstest]
     fn test_add_bulk_orders() {
         let mut level = Level::new(BookPrice::new(Price::from("2.00"), OrderSide::Buy));
@@ -0,0 +1,480 @@
+// -------------------------------------------------------------------------------------------------
+//  Copyright (C) 2015-2024 Nautech Systems Pty Ltd. All rights reserved.
+//  https://nautechsystems.io
+//
+//  Licensed under the GNU Lesser General Public License Version 3.0 (the "License");
+//  You may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at https://www.gnu.org/licenses/lgpl-3.0.en.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+// -------------------------------------------------------------------------------------------------
+
+//! A manager which owns many order books, sharded by instrument across worker threads.
+
+use std::{
+    collections::{
+        hash_map::{DefaultHasher, Entry},
+        HashMap,
+    },
+    hash::{Hash, Hasher},
+    sync::{
+        mpsc::{channel, sync_channel, Receiver, Sender, SyncSender},
+        Arc, PoisonError, RwLock,
+    },
+    thread::{self, JoinHandle},
+};
+
+use super::{
+    book::OrderBook,
+    error::BookManagerError,
+    top::{TopOfBook, TopOfBookHandle},
+};
+use crate::{data::Data, enums::BookType, identifiers::InstrumentId};
+
+/// The number of batches which may be queued for each worker before
+/// [`BookManager::apply`] blocks, so that a stalled worker applies backpressure rather
+/// than growing memory without limit.
+pub const BOOK_MANAGER_QUEUE_CAPACITY: usize = 1024;
+
+/// The top of book handles of the books held by one worker, keyed by instrument.
+///
+/// The worker only takes the write lock when it creates or replaces a book.
+type TopHandles = Arc<RwLock<HashMap<InstrumentId, TopOfBookHandle>>>;
+
+enum ShardCommand {
+    AddBook(Box<OrderBook>),
+    Apply(Vec<Data>),
+    Snapshot(InstrumentId, Sender<Option<OrderBook>>),
+    Flush(Sender<()>),
+}
+
+struct Shard {
+    tops: TopHandles,
+    tx: Option<SyncSender<ShardCommand>>,
+    handle: Option<JoinHandle<()>>,
+}
+
+/// The state owned by a single worker thread.
+struct Worker {
+    book_type: BookType,
+    books: HashMap<InstrumentId, OrderBook>,
+    tops: TopHandles,
+}
+
+impl Worker {
+    fn run(mut self, rx: Receiver<ShardCommand>) {
+        for cmd in rx {
+            match cmd {
+                ShardCommand::AddBook(book) => self.install(*book),
+                ShardCommand::Apply(batch) => self.apply(batch),
+                ShardCommand::Snapshot(instrument_id, reply) => {
+                    let _ = reply.send(self.books.get(&instrument_id).cloned());
+                }
+                ShardCommand::Flush(done) => {
+                    let _ = done.send(());
+                }
+            }
+        }
+    }
+
+    fn apply(&mut self, batch: Vec<Data>) {
+        for data in batch {
+            let book = self.book_mut(data.instrument_id());
+            match data {
+                Data::Delta(delta) => book.apply_delta(&delta),
+                Data::Deltas(deltas) => book.apply_deltas(&deltas),
+                Data::Depth10(depth) => book.apply_depth(&depth),
+                _ => unreachable!("Only order book data is sent to workers"),
+            }
+        }
+    }
+
+    fn book_mut(&mut self, instrument_id: InstrumentId) -> &mut OrderBook {
+        match self.books.entry(instrument_id) {
+            Entry::Occupied(entry) => entry.into_mut(),
+            Entry::Vacant(entry) => {
+                let mut book = OrderBook::new(instrument_id, self.book_type);
+                publish_handle(&self.tops, instrument_id, book.top_of_book_handle());
+                entry.insert(book)
+            }
+        }
+    }
+
+    fn install(&mut self, mut book: OrderBook) {
+        publish_handle(&self.tops, book.instrument_id, book.top_of_book_handle());
+        self.books.insert(book.instrument_id, book);
+    }
+}
+
+fn publish_handle(tops: &TopHandles, instrument_id: InstrumentId, handle: TopOfBookHandle) {
+    tops.write()
+        .unwrap_or_else(PoisonError::into_inner)
+        .insert(instrument_id, handle);
+}
+
+/// Pins the current thread to the given CPU core, on a best effort basis.
+#[cfg(target_os = "linux")]
+fn pin_to_core(core: usize) {
+    // SAFETY: `set` is a plain bitmask, and a pid of zero targets the calling thread
+    unsafe {
+        let mut set: libc::cpu_set_t = std::mem::zeroed();
+        libc::CPU_SET(core, &mut set);
+        libc::sched_setaffinity(0, std::mem::size_of::<libc::cpu_set_t>(), &set);
+    }
+}
+
+#[cfg(not(target_os = "linux"))]
+fn pin_to_core(_core: usize) {}
+
+/// Provides a manager for many order books, which applies their data in parallel.
+///
+/// Each instrument is assigned to one of a fixed pool of worker threads by the hash of
+/// its ID, and every worker applies the data for its instruments in the order received.
+/// Updates for the same instrument are therefore never reordered, while updates for
+/// instruments on different workers proceed concurrently.
+///
+/// Each worker owns its books outright, so applying data takes no lock. Readers see the
+/// top of book through the seqlock handle each book publishes, which never waits on a
+/// worker, or take a full [`BookManager::snapshot`] ordered after the data sent so far.
+pub struct BookManager {
+    book_type: BookType,
+    shards: Vec<Shard>,
+}
+
+impl BookManager {
+    /// Creates a new [`BookManager`] instance with `num_workers` worker threads.
+    ///
+    /// Books are created on first use with the given `book_type`, unless added beforehand
+    /// with [`BookManager::add_book`]. If `pin_workers` is set, worker `i` is pinned to
+    /// CPU core `i` modulo the available parallelism (Linux only).
+    ///
+    /// # Panics
+    ///
+    /// This function panics:
+    /// - If `num_workers` is zero.
+    /// - If a worker thread cannot be spawned.
+    #[must_use]
+    pub fn new(num_workers: usize, book_type: BookType, pin_workers: bool) -> Self {
+        assert!(num_workers > 0, "`num_workers` must be positive");
+        let num_cores = thread::available_parallelism().map_or(1, std::num::NonZeroUsize::get);
+
+        let shards = (0..num_workers)
+            .map(|i| {
+                let tops = TopHandles::default();
+                let (tx, rx) = sync_channel::<ShardCommand>(BOOK_MANAGER_QUEUE_CAPACITY);
+                let worker = Worker {
+                    book_type,
+                    books: HashMap::new(),
+                    tops: tops.clone(),
+                };
+                let handle = thread::Builder::new()
+                    .name(format!("book-manager-{i}"))
+                    .spawn(move || {
+                        if pin_workers {
+                            pin_to_core(i % num_cores);
+                        }
+                        worker.run(rx);
+                    })
+                    .expect("Error spawning book manager worker thread");
+
+                Shard {
+                    tops,
+                    tx: Some(tx),
+                    handle: Some(handle),
+                }
+            })
+            .collect();
+
+        Self { book_type, shards }
+    }
+
+    #[must_use]
+    pub const fn book_type(&self) -> BookType {
+        self.book_type
+    }
+
+    #[must_use]
+    pub fn num_workers(&self) -> usize {
+        self.shards.len()
+    }
+
+    fn shard_index(&self, instrument_id: &InstrumentId) -> usize {
+        let mut hasher = DefaultHasher::new();
+        instrument_id.hash(&mut hasher);
+        (hasher.finish() % self.shards.len() as u64) as usize
+    }
+
+    fn send(&self, index: usize, cmd: ShardCommand) -> Result<(), BookManagerError> {
+        self.shards[index]
+            .tx
+            .as_ref()
+            .and_then(|tx| tx.send(cmd).ok())
+            .ok_or(BookManagerError::WorkerStopped(index))
+    }
+
+    /// Adds the given `book` to the manager, replacing any book for the same instrument.
+    ///
+    /// The book is installed in order with any data already passed to the manager.
+    ///
+    /// # Errors
+    ///
+    /// This function returns an error:
+    /// - If the worker owning the instrument has stopped.
+    pub fn add_book(&self, book: OrderBook) -> Result<(), BookManagerError> {
+        let index = self.shard_index(&book.instrument_id);
+        self.send(index, ShardCommand::AddBook(Box::new(book)))
+    }
+
+    /// Routes the given interleaved `data` to the workers owning each instrument.
+    ///
+    /// Order book deltas and depth snapshots are applied asynchronously, in the order
+    /// given for each instrument. Other data types are ignored. Blocks while the queue
+    /// of a receiving worker is full.
+    ///
+    /// # Errors
+    ///
+    /// This function returns an error:
+    /// - If a worker owning any of the instruments has stopped.
+    pub fn apply(&self, data: impl IntoIterator<Item = Data>) -> Result<(), BookManagerError> {
+        let mut batches: Vec<Vec<Data>> = (0..self.shards.len()).map(|_| Vec::new()).collect();
+        for item in data {
+            if item.is_order_book_data() {
+                batches[self.shard_index(&item.instrument_id())].push(item);
+            }
+        }
+
+        for (index, batch) in batches.into_iter().enumerate() {
+            if !batch.is_empty() {
+                self.send(index, ShardCommand::Apply(batch))?;
+            }
+        }
+        Ok(())
+    }
+
+    /// Blocks until all data passed to the manager so far has been applied.
+    ///
+    /// # Errors
+    ///
+    /// This function returns an error:
+    /// - If any worker has stopped.
+    pub fn flush(&self) -> Result<(), BookManagerError> {
+        let mut receivers = Vec::with_capacity(self.shards.len());
+        for index in 0..self.shards.len() {
+            let (tx, rx) = channel();
+            self.send(index, ShardCommand::Flush(tx))?;
+            receivers.push((index, rx));
+        }
+
+        for (index, rx) in receivers {
+            rx.recv()
+                .map_err(|_| BookManagerError::WorkerStopped(index))?;
+        }
+        Ok(())
+    }
+
+    /// Returns whether a book exists for the given instrument.
+    #[must_use]
+    pub fn contains(&self, instrument_id: &InstrumentId) -> bool {
+        self.top_handle(instrument_id).is_some()
+    }
+
+    /// Returns the top of book for the given instrument, if a book exists for it.
+    ///
+    /// The record is read through the book's seqlock handle, so this never waits for a
+    /// worker to finish applying a batch.
+    #[must_use]
+    pub fn top_of_book(&self, instrument_id: &InstrumentId) -> Option<TopOfBook> {
+        self.top_handle(instrument_id).map(|handle| handle.read())
+    }
+
+    fn top_handle(&self, instrument_id: &InstrumentId) -> Option<TopOfBookHandle> {
+        let shard = &self.shards[self.shard_index(instrument_id)];
+        let tops = shard.tops.read().unwrap_or_else(PoisonError::into_inner);
+        tops.get(instrument_id).cloned()
+    }
+
+    /// Returns a copy of the book for the given instrument, taken by its worker after
+    /// applying all data passed to the manager so far.
+    ///
+    /// # Errors
+    ///
+    /// This function returns an error:
+    /// - If the worker owning the instrument has stopped.
+    pub fn snapshot(
+        &self,
+        instrument_id: &InstrumentId,
+    ) -> Result<Option<OrderBook>, BookManagerError> {
+        let index = self.shard_index(instrument_id);
+        let (tx, rx) = channel();
+        self.send(index, ShardCommand::Snapshot(*instrument_id, tx))?;
+        rx.recv()
+            .map_err(|_| BookManagerError::WorkerStopped(index))
+    }
+
+    /// Returns the number of books currently held across all workers.
+    #[must_use]
+    pub fn len(&self) -> usize {
+        self.shards
+            .iter()
+            .map(|shard| {
+                shard
+                    .tops
+                    .read()
+                    .unwrap_or_else(PoisonError::into_inner)
+                    .len()
+            })
+            .sum()
+    }
+
+    #[must_use]
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+}
+
+impl Drop for BookManager {
+    fn drop(&mut self) {
+        // Closing every channel first lets the workers drain and exit concurrently
+        for shard in &mut self.shards {
+            shard.tx.take();
+        }
+        for shard in &mut self.shards {
+            if let Some(handle) = shard.handle.take() {
+                // A worker which panicked has already reported it, so is not joined again
+                let _ = handle.join();
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Tests
+////////////////////////////////////////////////////////////////////////////////
+#[cfg(test)]
+mod tests {
+    use rstest::rstest;
+
+    use crate::{
+        data::{
+            delta::OrderBookDelta,
+            deltas::{OrderBookDeltas, OrderBookDeltas_API},
+            depth::OrderBookDepth10,
+            order::BookOrder,
+            stubs::*,
+            Data,
+        },
+        enums::{BookAction, BookType, OrderSide},
+        identifiers::InstrumentId,
+        orderbook::{book::OrderBook, manager::BookManager, top::TopOfBook},
+        types::{price::Price, quantity::Quantity},
+    };
+
+    fn add_bid(instrument_id: InstrumentId, price: &str, sequence: u64) -> Data {
+        Data::Delta(OrderBookDelta::new(
+            instrument_id,
+            BookAction::Add,
+            BookOrder::new(
+                OrderSide::Buy,
+                Price::from(price),
+                Quantity::from(1),
+                sequence,
+            ),
+            0,
+            sequence,
+            sequence.into(),
+            sequence.into(),
+        ))
+    }
+
+    #[rstest]
+    fn test_apply_matches_single_threaded_books() {
+        let manager = BookManager::new(4, BookType::L3_MBO, false);
+        let instrument_ids: Vec<InstrumentId> = (0..16)
+            .map(|i| InstrumentId::from(format!("SYM{i}.VENUE").as_str()))
+            .collect();
+
+        let mut expected: Vec<OrderBook> = instrument_ids
+            .iter()
+            .map(|id| OrderBook::new(*id, BookType::L3_MBO))
+            .collect();
+        let mut data = Vec::new();
+        for sequence in 1..=50u64 {
+            for (i, id) in instrument_ids.iter().enumerate() {
+                let item = add_bid(*id, &format!("{}.00", 100 + sequence), sequence);
+                if let Data::Delta(delta) = &item {
+                    expected[i].apply_delta(delta);
+                }
+                data.push(item);
+            }
+        }
+
+        manager.apply(data).unwrap();
+        manager.flush().unwrap();
+
+        assert_eq!(manager.len(), instrument_ids.len());
+        for (id, book) in instrument_ids.iter().zip(&expected) {
+            let top = manager.top_of_book(id).unwrap();
+            assert_eq!(top, book.top_of_book());
+            assert_eq!(top.bid_price, Price::from("150.00"));
+            assert_eq!(top.sequence, 50);
+            assert_eq!(manager.snapshot(id).unwrap().unwrap().count, 50);
+        }
+    }
+
+    #[rstest]
+    fn test_apply_deltas_and_depth(stub_deltas: OrderBookDeltas, stub_depth10: OrderBookDepth10) {
+        let manager = BookManager::new(2, BookType::L2_MBP, true);
+        let deltas_id = stub_deltas.instrument_id;
+        let depth_id = InstrumentId::from("ETHUSDT.BINANCE");
+        let depth = OrderBookDepth10 {
+            instrument_id: depth_id,
+            ..stub_depth10
+        };
+
+        manager
+            .apply([
+                Data::Deltas(OrderBookDeltas_API::new(stub_deltas)),
+                Data::Depth10(depth),
+            ])
+            .unwrap();
+        manager.flush().unwrap();
+
+        let top = manager.top_of_book(&deltas_id).unwrap();
+        assert_eq!(top.bid_price, Price::from("99.00"));
+        assert_eq!(top.ask_price, Price::from("100.00"));
+
+        let top = manager.top_of_book(&depth_id).unwrap();
+        assert_eq!(top.bid_price, Price::from("99.00"));
+        assert_eq!(top.ask_size, Quantity::from(100));
+    }
+
+    #[rstest]
+    fn test_add_book_and_unknown_instrument() {
+        let manager = BookManager::new(1, BookType::L2_MBP, false);
+        let instrument_id = InstrumentId::from("ETHUSDT.BINANCE");
+
+        assert!(manager.is_empty());
+        assert!(!manager.contains(&instrument_id));
+        assert_eq!(manager.top_of_book(&instrument_id), None);
+        assert!(manager.snapshot(&instrument_id).unwrap().is_none());
+
+        manager
+            .add_book(OrderBook::new(instrument_id, BookType::L3_MBO))
+            .unwrap();
+        manager.flush().unwrap();
+
+        assert!(manager.contains(&instrument_id));
+        assert_eq!(
+            manager.snapshot(&instrument_id).unwrap().unwrap().book_type,
+            BookType::L3_MBO
+        );
+        assert_eq!(
+            manager.top_of_book(&instrument_id),
+            Some(TopOfBook::default())
+        );
+    }
+}
@@ -18,7 +18,15 @@
 pub mod aggregation;
 pub mod analysis;
 pub mod book;
+pub mod cumulative;
 pub mod display;
 pub mod error;
+pub mod fixed_depth;
 pub mod ladder;
 pub mod level;
+pub mod manager;
+pub mod queue;
+pub mod sequencer;
+pub mod snapshot;
+pub mod tick_ladder;
+pub mod top;
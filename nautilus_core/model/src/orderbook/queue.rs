@@ -0,0 +1,291 @@
+// -------------------------------------------------------------------------------------------------
+//  Copyright (C) 2015-2024 Nautech Systems Pty Ltd. All rights reserved.
+//  https://nautechsystems.io
+//
+//  Licensed under the GNU Lesser General Public License Version 3.0 (the "License");
+//  You may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at https://www.gnu.org/licenses/lgpl-3.0.en.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+// -------------------------------------------------------------------------------------------------
+
+//! A slab-backed FIFO queue of orders for a single price level.
+
+use std::collections::HashMap;
+
+use crate::data::order::{BookOrder, OrderId};
+
+const NIL: usize = usize::MAX;
+
+#[derive(Clone, Debug)]
+struct Node {
+    order: BookOrder,
+    prev: usize,
+    next: usize,
+}
+
+/// Provides a FIFO queue of orders with O(1) add, update and removal by order ID.
+///
+/// Orders live in a slab of intrusive doubly-linked nodes, with vacated nodes recycled
+/// through a free list, so cancels from the middle of a deep queue neither scan nor
+/// shift the remaining orders.
+#[derive(Clone, Debug)]
+pub struct OrderQueue {
+    nodes: Vec<Node>,
+    index: HashMap<OrderId, usize>,
+    head: usize,
+    tail: usize,
+    free: usize,
+}
+
+impl Default for OrderQueue {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+impl OrderQueue {
+    /// Creates a new empty [`OrderQueue`] instance.
+    #[must_use]
+    pub fn new() -> Self {
+        Self {
+            nodes: Vec::new(),
+            index: HashMap::new(),
+            head: NIL,
+            tail: NIL,
+            free: NIL,
+        }
+    }
+
+    #[must_use]
+    pub fn len(&self) -> usize {
+        self.index.len()
+    }
+
+    #[must_use]
+    pub fn is_empty(&self) -> bool {
+        self.index.is_empty()
+    }
+
+    #[must_use]
+    pub fn contains_key(&self, order_id: &OrderId) -> bool {
+        self.index.contains_key(order_id)
+    }
+
+    #[must_use]
+    pub fn get(&self, order_id: &OrderId) -> Option<&BookOrder> {
+        self.index.get(order_id).map(|&i| &self.nodes[i].order)
+    }
+
+    /// Returns the order at the front of the queue (highest time priority).
+    #[must_use]
+    pub fn first(&self) -> Option<&BookOrder> {
+        (self.head != NIL).then(|| &self.nodes[self.head].order)
+    }
+
+    /// Returns an iterator over the orders in time priority.
+    #[must_use]
+    pub fn values(&self) -> OrderQueueIter<'_> {
+        OrderQueueIter {
+            queue: self,
+            cursor: self.head,
+        }
+    }
+
+    /// Adds the order to the back of the queue.
+    ///
+    /// An order already queued under the same ID is replaced and loses its time priority.
+    pub fn push_back(&mut self, order: BookOrder) {
+        self.remove(&order.order_id);
+
+        let node = Node {
+            order,
+            prev: self.tail,
+            next: NIL,
+        };
+
+        let i = if self.free == NIL {
+            self.nodes.push(node);
+            self.nodes.len() - 1
+        } else {
+            let i = self.free;
+            self.free = self.nodes[i].next;
+            self.nodes[i] = node;
+            i
+        };
+
+        if self.tail == NIL {
+            self.head = i;
+        } else {
+            self.nodes[self.tail].next = i;
+        }
+        self.tail = i;
+        self.index.insert(order.order_id, i);
+    }
+
+    /// Updates the order in place, retaining its time priority, otherwise adds it to
+    /// the back of the queue.
+    pub fn update(&mut self, order: BookOrder) {
+        match self.index.get(&order.order_id) {
+            Some(&i) => self.nodes[i].order = order,
+            None => self.push_back(order),
+        }
+    }
+
+    /// Removes the order with the given ID, returning it if it was queued.
+    pub fn remove(&mut self, order_id: &OrderId) -> Option<BookOrder> {
+        let i = self.index.remove(order_id)?;
+        let (order, prev, next) = {
+            let node = &self.nodes[i];
+            (node.order, node.prev, node.next)
+        };
+
+        if prev == NIL {
+            self.head = next;
+        } else {
+            self.nodes[prev].next = next;
+        }
+
+        if next == NIL {
+            self.tail = prev;
+        } else {
+            self.nodes[next].prev = prev;
+        }
+
+        self.nodes[i].prev = NIL;
+        self.nodes[i].next = self.free;
+        self.free = i;
+
+        Some(order)
+    }
+
+    pub fn clear(&mut self) {
+        self.nodes.clear();
+        self.index.clear();
+        self.head = NIL;
+        self.tail = NIL;
+        self.free = NIL;
+    }
+}
+
+impl PartialEq for OrderQueue {
+    fn eq(&self, other: &Self) -> bool {
+        self.len() == other.len() && self.values().eq(other.values())
+    }
+}
+
+impl Eq for OrderQueue {}
+
+/// Iterates the orders of an [`OrderQueue`] in time priority.
+pub struct OrderQueueIter<'a> {
+    queue: &'a OrderQueue,
+    cursor: usize,
+}
+
+impl<'a> Iterator for OrderQueueIter<'a> {
+    type Item = &'a BookOrder;
+
+    fn next(&mut self) -> Option<Self::Item> {
+        if self.cursor == NIL {
+            return None;
+        }
+        let node = &self.queue.nodes[self.cursor];
+        self.cursor = node.next;
+        Some(&node.order)
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Tests
+////////////////////////////////////////////////////////////////////////////////
+#[cfg(test)]
+mod tests {
+    use rstest::rstest;
+
+    use crate::{
+        data::order::BookOrder,
+        enums::OrderSide,
+        orderbook::queue::OrderQueue,
+        types::{price::Price, quantity::Quantity},
+    };
+
+    fn order(size: i64, order_id: u64) -> BookOrder {
+        BookOrder::new(
+            OrderSide::Buy,
+            Price::from("1.00"),
+            Quantity::from(size),
+            order_id,
+        )
+    }
+
+    fn ids(queue: &OrderQueue) -> Vec<u64> {
+        queue.values().map(|o| o.order_id).collect()
+    }
+
+    #[rstest]
+    fn test_empty_queue() {
+        let queue = OrderQueue::new();
+        assert!(queue.is_empty());
+        assert!(queue.first().is_none());
+        assert_eq!(queue.values().count(), 0);
+    }
+
+    #[rstest]
+    fn test_push_back_preserves_time_priority() {
+        let mut queue = OrderQueue::new();
+        queue.push_back(order(10, 3));
+        queue.push_back(order(20, 1));
+        queue.push_back(order(30, 2));
+
+        assert_eq!(queue.len(), 3);
+        assert_eq!(ids(&queue), vec![3, 1, 2]);
+        assert_eq!(queue.first().unwrap().order_id, 3);
+    }
+
+    #[rstest]
+    fn test_remove_from_middle_head_and_tail() {
+        let mut queue = OrderQueue::new();
+        for id in 1..=5 {
+            queue.push_back(order(10, id));
+        }
+
+        assert_eq!(queue.remove(&3).unwrap().order_id, 3);
+        assert_eq!(ids(&queue), vec![1, 2, 4, 5]);
+        queue.remove(&1);
+        queue.remove(&5);
+        assert_eq!(ids(&queue), vec![2, 4]);
+        assert!(queue.remove(&5).is_none());
+        assert!(!queue.contains_key(&1));
+    }
+
+    #[rstest]
+    fn test_update_retains_priority_and_push_back_loses_it() {
+        let mut queue = OrderQueue::new();
+        queue.push_back(order(10, 1));
+        queue.push_back(order(20, 2));
+
+        queue.update(order(5, 1));
+        assert_eq!(ids(&queue), vec![1, 2]);
+        assert_eq!(queue.get(&1).unwrap().size, Quantity::from(5));
+
+        queue.push_back(order(7, 1));
+        assert_eq!(ids(&queue), vec![2, 1]);
+        assert_eq!(queue.len(), 2);
+    }
+
+    #[rstest]
+    fn test_recycles_vacated_nodes() {
+        let mut queue = OrderQueue::new();
+        queue.push_back(order(10, 1));
+        queue.push_back(order(20, 2));
+        queue.remove(&1);
+        queue.push_back(order(30, 3));
+
+        assert_eq!(queue.nodes.len(), 2);
+        assert_eq!(ids(&queue), vec![2, 3]);
+    }
+}
@@ -0,0 +1,318 @@
+// -------------------------------------------------------------------------------------------------
+//  Copyright (C) 2015-2024 Nautech Systems Pty Ltd. All rights reserved.
+//  https://nautechsystems.io
+//
+//  Licensed under the GNU Lesser General Public License Version 3.0 (the "License");
+//  You may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at https://www.gnu.org/licenses/lgpl-3.0.en.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+// -------------------------------------------------------------------------------------------------
+
+//! Sequence gap detection and reordering for order book delta ingestion.
+
+use std::{
+    collections::BTreeMap,
+    fmt::{Debug, Formatter},
+    sync::Arc,
+};
+
+use crate::{data::delta::OrderBookDelta, enums::BookAction};
+
+/// Represents a gap in the sequence of deltas received for an order book.
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub struct SequenceGap {
+    /// The sequence number which was expected next.
+    pub expected: u64,
+    /// The sequence number the book skipped ahead to.
+    pub received: u64,
+}
+
+/// A handler called whenever a [`DeltaSequencer`] detects a sequence gap.
+pub type SequenceGapHandler = Arc<dyn Fn(SequenceGap) + Send + Sync>;
+
+/// Provides in-order application of order book deltas keyed on their sequence number.
+///
+/// A delta carrying the next sequence number (or the same sequence number as the last
+/// delta applied, for a multi-delta event) is applied immediately, followed by any
+/// buffered deltas it unblocks. A delta from the future is held in a bounded reorder
+/// buffer, and a delta from the past is dropped as a duplicate.
+///
+/// When the buffer overflows, the missing sequence numbers are treated as lost: the gap
+/// is counted and reported, the book is marked stale, and application resumes from the
+/// earliest buffered delta. A `Clear` delta received while stale resynchronizes the
+/// sequence, as sent at the start of a venue snapshot.
+#[derive(Clone)]
+pub struct DeltaSequencer {
+    capacity: usize,
+    last: Option<u64>,
+    pending: BTreeMap<u64, Vec<OrderBookDelta>>,
+    pending_len: usize,
+    gaps: u64,
+    dropped: u64,
+    stale: bool,
+    gap_handler: Option<SequenceGapHandler>,
+}
+
+impl Debug for DeltaSequencer {
+    fn fmt(&self, f: &mut Formatter<'_>) -> std::fmt::Result {
+        f.debug_struct(stringify!(DeltaSequencer))
+            .field("capacity", &self.capacity)
+            .field("last", &self.last)
+            .field("pending_len", &self.pending_len)
+            .field("gaps", &self.gaps)
+            .field("dropped", &self.dropped)
+            .field("stale", &self.stale)
+            .finish_non_exhaustive()
+    }
+}
+
+impl DeltaSequencer {
+    /// Creates a new [`DeltaSequencer`] instance which buffers at most `capacity`
+    /// out-of-order deltas before declaring a gap.
+    #[must_use]
+    pub fn new(capacity: usize) -> Self {
+        Self {
+            capacity,
+            last: None,
+            pending: BTreeMap::new(),
+            pending_len: 0,
+            gaps: 0,
+            dropped: 0,
+            stale: false,
+            gap_handler: None,
+        }
+    }
+
+    /// Sets the handler called whenever a gap is detected.
+    pub fn set_gap_handler(&mut self, handler: SequenceGapHandler) {
+        self.gap_handler = Some(handler);
+    }
+
+    #[must_use]
+    pub const fn capacity(&self) -> usize {
+        self.capacity
+    }
+
+    /// Returns the sequence number of the last delta applied.
+    #[must_use]
+    pub const fn last_sequence(&self) -> Option<u64> {
+        self.last
+    }
+
+    /// Returns the number of deltas held in the reorder buffer.
+    #[must_use]
+    pub const fn pending_len(&self) -> usize {
+        self.pending_len
+    }
+
+    /// Returns the number of sequence gaps detected.
+    #[must_use]
+    pub const fn gaps(&self) -> u64 {
+        self.gaps
+    }
+
+    /// Returns the number of duplicate or late deltas dropped.
+    #[must_use]
+    pub const fn dropped(&self) -> u64 {
+        self.dropped
+    }
+
+    /// Returns whether a gap has been detected since the last resynchronization.
+    #[must_use]
+    pub const fn is_stale(&self) -> bool {
+        self.stale
+    }
+
+    /// Discards the buffered deltas and sequence state, keeping the counters.
+    pub fn reset(&mut self) {
+        self.last = None;
+        self.pending.clear();
+        self.pending_len = 0;
+        self.stale = false;
+    }
+
+    /// Accepts the given `delta`, calling `apply` for it and every other delta which is
+    /// now next in sequence.
+    pub fn push(&mut self, delta: OrderBookDelta, mut apply: impl FnMut(&OrderBookDelta)) {
+        let sequence = delta.sequence;
+
+        if self.stale && delta.action == BookAction::Clear {
+            self.pending.retain(|&s, _| s > sequence);
+            self.pending_len = self.pending.values().map(Vec::len).sum();
+            self.stale = false;
+            self.last = Some(sequence);
+            apply(&delta);
+            self.drain(&mut apply);
+            return;
+        }
+
+        match self.last {
+            Some(last) if sequence == last => apply(&delta),
+            Some(last) if sequence < last => self.dropped += 1,
+            Some(last) if sequence > last + 1 => {
+                self.pending.entry(sequence).or_default().push(delta);
+                self.pending_len += 1;
+                if self.pending_len > self.capacity {
+                    self.skip_gap(last + 1, &mut apply);
+                }
+            }
+            _ => {
+                self.last = Some(sequence);
+                apply(&delta);
+                self.drain(&mut apply);
+            }
+        }
+    }
+
+    fn skip_gap(&mut self, expected: u64, apply: &mut impl FnMut(&OrderBookDelta)) {
+        let Some((&received, _)) = self.pending.first_key_value() else {
+            return;
+        };
+
+        self.gaps += 1;
+        self.stale = true;
+        if let Some(handler) = &self.gap_handler {
+            handler(SequenceGap { expected, received });
+        }
+
+        self.last = Some(received - 1);
+        self.drain(apply);
+    }
+
+    fn drain(&mut self, apply: &mut impl FnMut(&OrderBookDelta)) {
+        while let Some(entry) = self.pending.first_entry() {
+            let last = self.last.unwrap_or_default();
+            if *entry.key() > last + 1 {
+                break;
+            }
+
+            let sequence = *entry.key();
+            let deltas = entry.remove();
+            self.pending_len -= deltas.len();
+            if sequence < last {
+                self.dropped += deltas.len() as u64;
+                continue;
+            }
+
+            self.last = Some(sequence);
+            for delta in &deltas {
+                apply(delta);
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Tests
+////////////////////////////////////////////////////////////////////////////////
+#[cfg(test)]
+mod tests {
+    use std::sync::{Arc, Mutex};
+
+    use rstest::rstest;
+
+    use crate::{
+        data::{delta::OrderBookDelta, order::BookOrder},
+        enums::{BookAction, OrderSide},
+        identifiers::InstrumentId,
+        orderbook::sequencer::{DeltaSequencer, SequenceGap},
+        types::{price::Price, quantity::Quantity},
+    };
+
+    fn delta(sequence: u64) -> OrderBookDelta {
+        OrderBookDelta::new(
+            InstrumentId::from("AAPL.XNAS"),
+            BookAction::Add,
+            BookOrder::new(
+                OrderSide::Buy,
+                Price::from("100.00"),
+                Quantity::from(1),
+                sequence,
+            ),
+            0,
+            sequence,
+            sequence.into(),
+            sequence.into(),
+        )
+    }
+
+    fn push_all(sequencer: &mut DeltaSequencer, sequences: &[u64]) -> Vec<u64> {
+        let mut applied = Vec::new();
+        for &sequence in sequences {
+            sequencer.push(delta(sequence), |d| applied.push(d.sequence));
+        }
+        applied
+    }
+
+    #[rstest]
+    fn test_in_order_and_repeated_sequences() {
+        let mut sequencer = DeltaSequencer::new(4);
+        let applied = push_all(&mut sequencer, &[5, 6, 6, 7]);
+        assert_eq!(applied, vec![5, 6, 6, 7]);
+        assert_eq!(sequencer.last_sequence(), Some(7));
+        assert_eq!(sequencer.gaps(), 0);
+    }
+
+    #[rstest]
+    fn test_reorders_within_capacity() {
+        let mut sequencer = DeltaSequencer::new(4);
+        let applied = push_all(&mut sequencer, &[1, 3, 4, 2, 5]);
+        assert_eq!(applied, vec![1, 2, 3, 4, 5]);
+        assert_eq!(sequencer.pending_len(), 0);
+        assert!(!sequencer.is_stale());
+    }
+
+    #[rstest]
+    fn test_drops_duplicates() {
+        let mut sequencer = DeltaSequencer::new(4);
+        let applied = push_all(&mut sequencer, &[1, 2, 1, 3]);
+        assert_eq!(applied, vec![1, 2, 3]);
+        assert_eq!(sequencer.dropped(), 1);
+    }
+
+    #[rstest]
+    fn test_gap_when_buffer_overflows() {
+        let gaps = Arc::new(Mutex::new(Vec::new()));
+        let reported = gaps.clone();
+        let mut sequencer = DeltaSequencer::new(2);
+        sequencer.set_gap_handler(Arc::new(move |gap| reported.lock().unwrap().push(gap)));
+
+        let applied = push_all(&mut sequencer, &[1, 3, 4]);
+        assert_eq!(applied, vec![1]);
+        let applied = push_all(&mut sequencer, &[5, 2]);
+
+        assert_eq!(applied, vec![3, 4, 5]);
+        assert_eq!(sequencer.gaps(), 1);
+        assert_eq!(sequencer.dropped(), 1);
+        assert!(sequencer.is_stale());
+        assert_eq!(
+            *gaps.lock().unwrap(),
+            vec![SequenceGap {
+                expected: 2,
+                received: 3
+            }]
+        );
+    }
+
+    #[rstest]
+    fn test_clear_resynchronizes_when_stale() {
+        let mut sequencer = DeltaSequencer::new(0);
+        push_all(&mut sequencer, &[1, 3]);
+        assert!(sequencer.is_stale());
+
+        let mut applied = Vec::new();
+        let clear =
+            OrderBookDelta::clear(InstrumentId::from("AAPL.XNAS"), 10, 10.into(), 10.into());
+        sequencer.push(clear, |d| applied.push(d.sequence));
+        sequencer.push(delta(11), |d| applied.push(d.sequence));
+
+        assert_eq!(applied, vec![10, 11]);
+        assert!(!sequencer.is_stale());
+        assert_eq!(sequencer.gaps(), 1);
+    }
+}
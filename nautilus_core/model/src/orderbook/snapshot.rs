@@ -0,0 +1,543 @@
+// -------------------------------------------------------------------------------------------------
+//  Copyright (C) 2015-2024 Nautech Systems Pty Ltd. All rights reserved.
+//  https://nautechsystems.io
+//
+//  Licensed under the GNU Lesser General Public License Version 3.0 (the "License");
+//  You may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at https://www.gnu.org/licenses/lgpl-3.0.en.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+// -------------------------------------------------------------------------------------------------
+
+//! A compact, versioned binary snapshot format for order book state.
+//!
+//! All integers are little-endian. A snapshot is laid out as:
+//!
+//! - Header: magic `NTOB`, version `u8`, book type `u8`, flags `u8`.
+//! - Tick config (only if flagged tick-indexed): raw price increment `i64`, price increment
+//!   precision `u8`, capacity `u64`.
+//! - State: sequence `u64`, `ts_last` `u64`, count `u64`.
+//! - Instrument ID: length `u16` then UTF-8 bytes.
+//! - Bids then asks, each as a level count `u32` followed by the levels from best to worst.
+//!   A level is its raw price `i64`, price precision `u8` and order count `u32`, followed by
+//!   the orders in time priority as raw size `u64`, size precision `u8` and order ID `u64`.
+//!   If flagged as fixed levels, a level is instead its aggregated order as raw price `i64`,
+//!   price precision `u8`, raw size `u64`, size precision `u8` and order ID `u64`, followed
+//!   by its order count `u32`.
+//!
+//! The order cache of each ladder is rebuilt as the orders are restored. A fixed depth book
+//! keeps its mode, and its levels stay in the fixed arrays unless they had been moved into
+//! the ladders.
+
+use std::{str::FromStr, thread};
+
+use nautilus_core::nanos::UnixNanos;
+
+use super::{book::OrderBook, error::BookSnapshotError, fixed_depth::FixedDepth, ladder::Ladder};
+use crate::{
+    data::{
+        depth::DEPTH10_LEN,
+        order::{BookOrder, NULL_ORDER},
+    },
+    enums::{BookType, FromU8, OrderSide},
+    identifiers::InstrumentId,
+    types::{fixed::FIXED_PRECISION, price::Price, quantity::Quantity},
+};
+
+/// The magic bytes which open every order book snapshot.
+pub const BOOK_SNAPSHOT_MAGIC: [u8; 4] = *b"NTOB";
+
+/// The current order book snapshot format version.
+pub const BOOK_SNAPSHOT_VERSION: u8 = 1;
+
+const FLAG_TICK_INDEXED: u8 = 1;
+const FLAG_CUMULATIVE_DEPTH: u8 = 1 << 1;
+const FLAG_FIXED_DEPTH: u8 = 1 << 2;
+const FLAG_FIXED_LEVELS: u8 = 1 << 3;
+
+/// Writes a snapshot of the given `book` to the end of `buf`.
+pub fn write_snapshot(book: &OrderBook, buf: &mut Vec<u8>) {
+    let tick_config = book.bids.tick_config();
+    let mut flags = 0;
+    if tick_config.is_some() {
+        flags |= FLAG_TICK_INDEXED;
+    }
+    if book.has_cumulative_depth() {
+        flags |= FLAG_CUMULATIVE_DEPTH;
+    }
+    if book.is_fixed_depth() {
+        flags |= FLAG_FIXED_DEPTH;
+    }
+    let fixed = book.fixed_levels();
+    if fixed.is_some() {
+        flags |= FLAG_FIXED_LEVELS;
+    }
+
+    buf.extend_from_slice(&BOOK_SNAPSHOT_MAGIC);
+    buf.push(BOOK_SNAPSHOT_VERSION);
+    buf.push(book.book_type as u8);
+    buf.push(flags);
+
+    if let Some((price_increment, capacity)) = tick_config {
+        buf.extend_from_slice(&price_increment.raw.to_le_bytes());
+        buf.push(price_increment.precision);
+        buf.extend_from_slice(&(capacity as u64).to_le_bytes());
+    }
+
+    buf.extend_from_slice(&book.sequence.to_le_bytes());
+    buf.extend_from_slice(&book.ts_last.as_u64().to_le_bytes());
+    buf.extend_from_slice(&book.count.to_le_bytes());
+
+    let instrument_id = book.instrument_id.to_string();
+    buf.extend_from_slice(&(instrument_id.len() as u16).to_le_bytes());
+    buf.extend_from_slice(instrument_id.as_bytes());
+
+    match fixed {
+        Some(fixed) => {
+            write_fixed_side(fixed, OrderSide::Buy, buf);
+            write_fixed_side(fixed, OrderSide::Sell, buf);
+        }
+        None => {
+            write_ladder(&book.bids, buf);
+            write_ladder(&book.asks, buf);
+        }
+    }
+}
+
+fn write_fixed_side(fixed: &FixedDepth, side: OrderSide, buf: &mut Vec<u8>) {
+    let orders = match side {
+        OrderSide::Buy => fixed.bids(),
+        _ => fixed.asks(),
+    };
+    buf.extend_from_slice(&(orders.len() as u32).to_le_bytes());
+    for (order, count) in orders.iter().zip(fixed.counts(side)) {
+        buf.extend_from_slice(&order.price.raw.to_le_bytes());
+        buf.push(order.price.precision);
+        buf.extend_from_slice(&order.size.raw.to_le_bytes());
+        buf.push(order.size.precision);
+        buf.extend_from_slice(&order.order_id.to_le_bytes());
+        buf.extend_from_slice(&count.to_le_bytes());
+    }
+}
+
+fn write_ladder(ladder: &Ladder, buf: &mut Vec<u8>) {
+    buf.extend_from_slice(&(ladder.len() as u32).to_le_bytes());
+    for level in ladder.levels() {
+        buf.extend_from_slice(&level.price.value.raw.to_le_bytes());
+        buf.push(level.price.value.precision);
+        buf.extend_from_slice(&(level.len() as u32).to_le_bytes());
+        for order in level.orders.values() {
+            buf.extend_from_slice(&order.size.raw.to_le_bytes());
+            buf.push(order.size.precision);
+            buf.extend_from_slice(&order.order_id.to_le_bytes());
+        }
+    }
+}
+
+/// Restores an [`OrderBook`] from the snapshot held in `bytes`.
+///
+/// # Errors
+///
+/// This function returns an error:
+/// - If `bytes` is not a snapshot of a supported version.
+/// - If `bytes` is truncated or holds an invalid value.
+pub fn read_snapshot(bytes: &[u8]) -> Result<OrderBook, BookSnapshotError> {
+    let mut reader = SnapshotReader { bytes, pos: 0 };
+
+    if reader.take(BOOK_SNAPSHOT_MAGIC.len())? != BOOK_SNAPSHOT_MAGIC {
+        return Err(BookSnapshotError::InvalidMagic);
+    }
+    let version = reader.u8()?;
+    if version != BOOK_SNAPSHOT_VERSION {
+        return Err(BookSnapshotError::UnsupportedVersion(version));
+    }
+    let book_type_u8 = reader.u8()?;
+    let book_type = BookType::from_u8(book_type_u8).ok_or(BookSnapshotError::InvalidValue(
+        stringify!(book_type),
+        i64::from(book_type_u8),
+    ))?;
+    let flags = reader.u8()?;
+    let is_fixed_depth = flags & FLAG_FIXED_DEPTH != 0;
+    if (is_fixed_depth && flags & FLAG_TICK_INDEXED != 0)
+        || (!is_fixed_depth && flags & FLAG_FIXED_LEVELS != 0)
+    {
+        return Err(BookSnapshotError::InvalidValue(
+            stringify!(flags),
+            i64::from(flags),
+        ));
+    }
+
+    let tick_config = if flags & FLAG_TICK_INDEXED == 0 {
+        None
+    } else {
+        let price_increment = reader.i64()?;
+        let tick_precision = reader.precision()?;
+        let capacity = reader.u64()?;
+        if price_increment <= 0 {
+            return Err(BookSnapshotError::InvalidValue(
+                stringify!(price_increment),
+                price_increment,
+            ));
+        }
+        if capacity == 0 {
+            return Err(BookSnapshotError::InvalidValue(stringify!(capacity), 0));
+        }
+        Some((
+            Price::from_raw(price_increment, tick_precision),
+            capacity as usize,
+        ))
+    };
+
+    let sequence = reader.u64()?;
+    let ts_last = reader.u64()?;
+    let count = reader.u64()?;
+
+    let instrument_id_len = reader.u16()? as usize;
+    let instrument_id = std::str::from_utf8(reader.take(instrument_id_len)?)
+        .map_err(|e| BookSnapshotError::InvalidInstrumentId(e.to_string()))
+        .and_then(|s| {
+            InstrumentId::from_str(s)
+                .map_err(|e| BookSnapshotError::InvalidInstrumentId(e.to_string()))
+        })?;
+
+    let mut book = match tick_config {
+        Some((price_increment, capacity)) => {
+            OrderBook::new_tick_indexed(instrument_id, book_type, price_increment, capacity)
+        }
+        None if is_fixed_depth => OrderBook::new_depth10(instrument_id),
+        None => OrderBook::new(instrument_id, book_type),
+    };
+    if flags & FLAG_CUMULATIVE_DEPTH != 0 {
+        book.enable_cumulative_depth();
+    }
+
+    match book.fixed_levels_mut() {
+        Some(fixed) if flags & FLAG_FIXED_LEVELS != 0 => {
+            read_fixed_side(&mut reader, fixed, OrderSide::Buy)?;
+            read_fixed_side(&mut reader, fixed, OrderSide::Sell)?;
+        }
+        _ => {
+            book.spill_fixed_depth();
+            read_ladder(&mut reader, &mut book.bids)?;
+            read_ladder(&mut reader, &mut book.asks)?;
+        }
+    }
+
+    book.sequence = sequence;
+    book.ts_last = UnixNanos::from(ts_last);
+    book.count = count;
+
+    Ok(book)
+}
+
+fn read_ladder(reader: &mut SnapshotReader, ladder: &mut Ladder) -> Result<(), BookSnapshotError> {
+    let num_levels = reader.u32()?;
+    for _ in 0..num_levels {
+        let price_raw = reader.i64()?;
+        let price_precision = reader.precision()?;
+        let price = Price::from_raw(price_raw, price_precision);
+        let num_orders = reader.u32()?;
+        for _ in 0..num_orders {
+            let size_raw = reader.u64()?;
+            let size_precision = reader.precision()?;
+            let order_id = reader.u64()?;
+            ladder.add(BookOrder::new(
+                ladder.side,
+                price,
+                Quantity::from_raw(size_raw, size_precision),
+                order_id,
+            ));
+        }
+    }
+    Ok(())
+}
+
+fn read_fixed_side(
+    reader: &mut SnapshotReader,
+    fixed: &mut FixedDepth,
+    side: OrderSide,
+) -> Result<(), BookSnapshotError> {
+    let num_levels = reader.u32()?;
+    if num_levels as usize > DEPTH10_LEN {
+        return Err(BookSnapshotError::InvalidValue(
+            stringify!(num_levels),
+            i64::from(num_levels),
+        ));
+    }
+    let mut orders = [NULL_ORDER; DEPTH10_LEN];
+    let mut counts = [0u32; DEPTH10_LEN];
+    for i in 0..num_levels as usize {
+        let price_raw = reader.i64()?;
+        let price_precision = reader.precision()?;
+        let size_raw = reader.u64()?;
+        let size_precision = reader.precision()?;
+        let order_id = reader.u64()?;
+        orders[i] = BookOrder::new(
+            side,
+            Price::from_raw(price_raw, price_precision),
+            Quantity::from_raw(size_raw, size_precision),
+            order_id,
+        );
+        counts[i] = reader.u32()?;
+    }
+    fixed.load_side(side, &orders, &counts);
+    Ok(())
+}
+
+/// Restores many order books from their snapshots, spreading the work across threads.
+///
+/// The results are returned in the same order as `snapshots`.
+#[must_use]
+pub fn read_snapshots(snapshots: &[&[u8]]) -> Vec<Result<OrderBook, BookSnapshotError>> {
+    let num_threads = thread::available_parallelism()
+        .map_or(1, std::num::NonZeroUsize::get)
+        .min(snapshots.len());
+    if num_threads <= 1 {
+        return snapshots.iter().map(|bytes| read_snapshot(bytes)).collect();
+    }
+
+    let chunk_size = snapshots.len().div_ceil(num_threads);
+    thread::scope(|scope| {
+        let handles: Vec<_> = snapshots
+            .chunks(chunk_size)
+            .map(|chunk| {
+                scope.spawn(move || {
+                    chunk
+                        .iter()
+                        .map(|bytes| read_snapshot(bytes))
+                        .collect::<Vec<_>>()
+                })
+            })
+            .collect();
+
+        handles
+            .into_iter()
+            .flat_map(|handle| handle.join().expect("snapshot restore thread panicked"))
+            .collect()
+    })
+}
+
+struct SnapshotReader<'a> {
+    bytes: &'a [u8],
+    pos: usize,
+}
+
+impl<'a> SnapshotReader<'a> {
+    fn take(&mut self, len: usize) -> Result<&'a [u8], BookSnapshotError> {
+        let end = self
+            .pos
+            .checked_add(len)
+            .filter(|&end| end <= self.bytes.len())
+            .ok_or(BookSnapshotError::Truncated(self.pos))?;
+        let slice = &self.bytes[self.pos..end];
+        self.pos = end;
+        Ok(slice)
+    }
+
+    fn array<const N: usize>(&mut self) -> Result<[u8; N], BookSnapshotError> {
+        let mut array = [0; N];
+        array.copy_from_slice(self.take(N)?);
+        Ok(array)
+    }
+
+    fn u8(&mut self) -> Result<u8, BookSnapshotError> {
+        Ok(self.array::<1>()?[0])
+    }
+
+    fn u16(&mut self) -> Result<u16, BookSnapshotError> {
+        Ok(u16::from_le_bytes(self.array()?))
+    }
+
+    fn u32(&mut self) -> Result<u32, BookSnapshotError> {
+        Ok(u32::from_le_bytes(self.array()?))
+    }
+
+    fn u64(&mut self) -> Result<u64, BookSnapshotError> {
+        Ok(u64::from_le_bytes(self.array()?))
+    }
+
+    fn i64(&mut self) -> Result<i64, BookSnapshotError> {
+        Ok(i64::from_le_bytes(self.array()?))
+    }
+
+    fn precision(&mut self) -> Result<u8, BookSnapshotError> {
+        let precision = self.u8()?;
+        if precision > FIXED_PRECISION {
+            return Err(BookSnapshotError::InvalidValue(
+                stringify!(precision),
+                i64::from(precision),
+            ));
+        }
+        Ok(precision)
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Tests
+////////////////////////////////////////////////////////////////////////////////
+#[cfg(test)]
+mod tests {
+    use rstest::rstest;
+
+    use super::*;
+    use crate::{
+        data::{depth::OrderBookDepth10, stubs::*},
+        enums::OrderSide,
+    };
+
+    fn l3_book() -> OrderBook {
+        let instrument_id = InstrumentId::from("ESH4.GLBX");
+        let mut book = OrderBook::new(instrument_id, BookType::L3_MBO);
+        let orders = [
+            (OrderSide::Buy, "100.25", 5, 1),
+            (OrderSide::Buy, "100.25", 3, 2),
+            (OrderSide::Buy, "100.00", 7, 3),
+            (OrderSide::Sell, "100.50", 2, 4),
+            (OrderSide::Sell, "100.50", 9, 5),
+        ];
+        for (i, (side, price, size, order_id)) in orders.into_iter().enumerate() {
+            let order = BookOrder::new(side, Price::from(price), Quantity::from(size), order_id);
+            book.add(order, 0, i as u64 + 1, (i as u64 + 10).into());
+        }
+        // Move the first bid to the back of the queue
+        let order = BookOrder::new(OrderSide::Buy, Price::from("100.25"), Quantity::from(4), 1);
+        book.delete(order, 0, 6, 16.into());
+        book.add(order, 0, 7, 17.into());
+        book
+    }
+
+    fn assert_books_equal(restored: &OrderBook, book: &OrderBook) {
+        assert_eq!(restored, book);
+        assert_eq!(restored.sequence, book.sequence);
+        assert_eq!(restored.ts_last, book.ts_last);
+        assert_eq!(restored.count, book.count);
+        for (restored, ladder) in [(&restored.bids, &book.bids), (&restored.asks, &book.asks)] {
+            assert_eq!(restored.len(), ladder.len());
+            for (restored_level, level) in restored.levels().zip(ladder.levels()) {
+                assert_eq!(restored_level.price.value, level.price.value);
+                assert_eq!(restored_level.orders, level.orders);
+            }
+        }
+        assert_eq!(restored.bids.cache, book.bids.cache);
+        assert_eq!(restored.asks.cache, book.asks.cache);
+    }
+
+    #[rstest]
+    fn test_round_trip_l3_book() {
+        let book = l3_book();
+        let bytes = book.to_snapshot_bytes();
+        let restored = OrderBook::from_snapshot_bytes(&bytes).unwrap();
+
+        assert_books_equal(&restored, &book);
+        let bid_ids: Vec<u64> = restored
+            .bids()
+            .next()
+            .unwrap()
+            .orders
+            .values()
+            .map(|o| o.order_id)
+            .collect();
+        assert_eq!(bid_ids, vec![2, 1]);
+    }
+
+    #[rstest]
+    fn test_round_trip_tick_indexed_book(stub_depth10: OrderBookDepth10) {
+        let instrument_id = InstrumentId::from("AAPL.XNAS");
+        let mut book =
+            OrderBook::new_tick_indexed(instrument_id, BookType::L2_MBP, Price::from("0.01"), 128);
+        book.enable_cumulative_depth();
+        book.apply_depth(&stub_depth10);
+
+        let restored = OrderBook::from_snapshot_bytes(&book.to_snapshot_bytes()).unwrap();
+
+        assert_books_equal(&restored, &book);
+        let (price_increment, capacity) = restored.bids.tick_config().unwrap();
+        assert_eq!(price_increment, Price::from("0.01"));
+        assert_eq!(price_increment.precision, 2);
+        assert_eq!(capacity, 128);
+        assert!(restored.has_cumulative_depth());
+    }
+
+    #[rstest]
+    fn test_round_trip_depth10_book(stub_depth10: OrderBookDepth10) {
+        let mut book = OrderBook::new_depth10(stub_depth10.instrument_id);
+        book.apply_depth(&stub_depth10);
+
+        let restored = OrderBook::from_snapshot_bytes(&book.to_snapshot_bytes()).unwrap();
+
+        assert!(restored.is_fixed_depth());
+        let (restored_fixed, fixed) = (
+            restored.fixed_levels().unwrap(),
+            book.fixed_levels().unwrap(),
+        );
+        for side in [OrderSide::Buy, OrderSide::Sell] {
+            assert_eq!(restored_fixed.counts(side), fixed.counts(side));
+        }
+        assert_eq!(restored_fixed.bids(), fixed.bids());
+        assert_eq!(restored_fixed.asks(), fixed.asks());
+        assert_eq!(restored.count, book.count);
+        assert_eq!(restored.pprint(10), book.pprint(10));
+    }
+
+    #[rstest]
+    fn test_round_trip_spilled_depth10_book(stub_depth10: OrderBookDepth10) {
+        let mut book = OrderBook::new_depth10(stub_depth10.instrument_id);
+        book.apply_depth(&stub_depth10);
+        let bid = BookOrder::new(OrderSide::Buy, Price::from("99.50"), Quantity::from(75), 0);
+        book.add(bid, 0, 1, 1.into());
+
+        let mut restored = OrderBook::from_snapshot_bytes(&book.to_snapshot_bytes()).unwrap();
+
+        assert!(restored.is_fixed_depth());
+        assert!(restored.fixed_levels().is_none());
+        assert_books_equal(&restored, &book);
+
+        restored.apply_depth(&stub_depth10);
+        assert!(restored.fixed_levels().is_some());
+    }
+
+    #[rstest]
+    fn test_read_snapshots_preserves_order() {
+        let books: Vec<OrderBook> = (0..5)
+            .map(|i| {
+                let mut book = l3_book();
+                book.sequence = i;
+                book
+            })
+            .collect();
+        let snapshots: Vec<Vec<u8>> = books.iter().map(OrderBook::to_snapshot_bytes).collect();
+        let slices: Vec<&[u8]> = snapshots.iter().map(Vec::as_slice).collect();
+
+        let restored = read_snapshots(&slices);
+
+        assert_eq!(restored.len(), books.len());
+        for (restored, book) in restored.iter().zip(&books) {
+            assert_books_equal(restored.as_ref().unwrap(), book);
+        }
+    }
+
+    #[rstest]
+    fn test_invalid_snapshots() {
+        let bytes = l3_book().to_snapshot_bytes();
+
+        assert!(matches!(
+            read_snapshot(b"NOPE"),
+            Err(BookSnapshotError::InvalidMagic)
+        ));
+        assert!(matches!(
+            read_snapshot(&bytes[..bytes.len() - 1]),
+            Err(BookSnapshotError::Truncated(_))
+        ));
+
+        let mut bytes = bytes;
+        bytes[4] = BOOK_SNAPSHOT_VERSION + 1;
+        assert!(matches!(
+            read_snapshot(&bytes),
+            Err(BookSnapshotError::UnsupportedVersion(_))
+        ));
+    }
+}
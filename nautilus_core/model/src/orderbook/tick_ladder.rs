@@ -0,0 +1,633 @@
+// -------------------------------------------------------------------------------------------------
+//  Copyright (C) 2015-2024 Nautech Systems Pty Ltd. All rights reserved.
+//  https://nautechsystems.io
+//
+//  Licensed under the GNU Lesser General Public License Version 3.0 (the "License");
+//  You may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at https://www.gnu.org/licenses/lgpl-3.0.en.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+// -------------------------------------------------------------------------------------------------
+
+//! Array-indexed price level storage for instruments trading on a fixed tick grid.
+
+use std::{
+    collections::{btree_map, BTreeMap},
+    iter::Peekable,
+};
+
+use nautilus_core::correctness::{check_positive_i64, FAILED};
+
+use crate::{
+    enums::{OrderSide, OrderSideSpecified},
+    orderbook::{ladder::BookPrice, level::Level},
+    types::price::Price,
+};
+
+/// The default number of tick slots held in the array window of a [`TickLadder`].
+pub const TICK_LADDER_DEFAULT_CAPACITY: usize = 1024;
+
+const WORD_BITS: usize = u64::BITS as usize;
+
+/// Provides price level storage for one side of an order book, held in a contiguous
+/// array indexed by `(price.raw - anchor) / tick`.
+///
+/// Occupied slots are tracked with a two-level bitmap so the best level is located
+/// with a couple of bit scans rather than a tree descent. The array window recenters
+/// on the best price whenever the top of book moves outside of it, or drifts into the
+/// back quarter of the window while levels are held behind it. Levels which fall
+/// outside the window are held in overflow trees either side of it, and any level
+/// priced off the tick grid is kept in its own tree and merged on iteration, so
+/// ordering is always exact.
+#[derive(Clone, Debug)]
+pub struct TickLadder {
+    side: OrderSide,
+    tick: i64,
+    tick_precision: u8,
+    anchor: i64,
+    slots: Vec<Option<Level>>,
+    words: Vec<u64>,
+    summary: Vec<u64>,
+    count: usize,
+    below: BTreeMap<BookPrice, Level>,
+    above: BTreeMap<BookPrice, Level>,
+    off_grid: BTreeMap<BookPrice, Level>,
+}
+
+impl TickLadder {
+    /// Creates a new [`TickLadder`] instance.
+    ///
+    /// The `capacity` is rounded up to a whole multiple of 64 slots.
+    ///
+    /// # Panics
+    ///
+    /// This function panics:
+    /// - If `price_increment` is not positive.
+    /// - If `capacity` is zero.
+    #[must_use]
+    pub fn new(side: OrderSide, price_increment: Price, capacity: usize) -> Self {
+        check_positive_i64(price_increment.raw, stringify!(price_increment)).expect(FAILED);
+        assert!(capacity > 0, "`capacity` must be positive");
+
+        let num_words = capacity.div_ceil(WORD_BITS);
+        let num_summary = num_words.div_ceil(WORD_BITS);
+
+        Self {
+            side,
+            tick: price_increment.raw,
+            tick_precision: price_increment.precision,
+            anchor: 0,
+            slots: vec![None; num_words * WORD_BITS],
+            words: vec![0; num_words],
+            summary: vec![0; num_summary],
+            count: 0,
+            below: BTreeMap::new(),
+            above: BTreeMap::new(),
+            off_grid: BTreeMap::new(),
+        }
+    }
+
+    /// Returns the number of slots in the array window.
+    #[must_use]
+    pub fn capacity(&self) -> usize {
+        self.slots.len()
+    }
+
+    /// Returns the raw price increment of one tick.
+    #[must_use]
+    pub fn tick_raw(&self) -> i64 {
+        self.tick
+    }
+
+    /// Returns the price increment of one tick.
+    #[must_use]
+    pub fn price_increment(&self) -> Price {
+        Price::from_raw(self.tick, self.tick_precision)
+    }
+
+    #[must_use]
+    pub fn len(&self) -> usize {
+        self.count + self.below.len() + self.above.len() + self.off_grid.len()
+    }
+
+    #[must_use]
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+
+    pub fn clear(&mut self) {
+        self.drain_slots();
+        self.below.clear();
+        self.above.clear();
+        self.off_grid.clear();
+    }
+
+    #[must_use]
+    pub fn get(&self, price: &BookPrice) -> Option<&Level> {
+        match self.index_of(price.value.raw) {
+            Some(index) => self.slots[index].as_ref(),
+            None => self.overflow(price.value.raw).get(price),
+        }
+    }
+
+    pub fn get_mut(&mut self, price: &BookPrice) -> Option<&mut Level> {
+        match self.index_of(price.value.raw) {
+            Some(index) => self.slots[index].as_mut(),
+            None => self.overflow_mut(price.value.raw).get_mut(price),
+        }
+    }
+
+    pub fn insert(&mut self, price: BookPrice, level: Level) {
+        let raw = price.value.raw;
+        if self.is_on_grid(raw) && self.index_of(raw).is_none() && self.is_new_top(raw) {
+            self.recenter(raw);
+        }
+        self.place(price, level);
+    }
+
+    pub fn remove(&mut self, price: &BookPrice) -> Option<Level> {
+        let level = match self.index_of(price.value.raw) {
+            Some(index) => {
+                let level = self.slots[index].take();
+                if level.is_some() {
+                    self.clear_bit(index);
+                }
+                level
+            }
+            None => self.overflow_mut(price.value.raw).remove(price),
+        };
+        if level.is_some() {
+            self.rebalance();
+        }
+        level
+    }
+
+    /// Returns the best level on this side.
+    #[must_use]
+    pub fn first(&self) -> Option<&Level> {
+        let (outer, inner) = match self.side.as_specified() {
+            OrderSideSpecified::Buy => (&self.above, &self.below),
+            OrderSideSpecified::Sell => (&self.below, &self.above),
+        };
+
+        let on_grid = outer
+            .values()
+            .next()
+            .or_else(|| self.best_index().and_then(|i| self.slots[i].as_ref()))
+            .or_else(|| inner.values().next());
+
+        match (on_grid, self.off_grid.values().next()) {
+            (Some(level), Some(other)) if other.price < level.price => Some(other),
+            (None, other) => other,
+            (level, _) => level,
+        }
+    }
+
+    /// Returns an iterator over the levels from best to worst price.
+    #[must_use]
+    pub fn iter(&self) -> TickLadderIter<'_> {
+        let (head, tail, cursor) = match self.side.as_specified() {
+            OrderSideSpecified::Buy => (
+                self.above.values(),
+                self.below.values(),
+                self.find_prev(self.capacity() - 1),
+            ),
+            OrderSideSpecified::Sell => {
+                (self.below.values(), self.above.values(), self.find_next(0))
+            }
+        };
+
+        let grid = GridIter {
+            ladder: self,
+            head,
+            tail,
+            cursor,
+        };
+
+        TickLadderIter {
+            grid: grid.peekable(),
+            off_grid: self.off_grid.values().peekable(),
+        }
+    }
+
+    fn overflow(&self, raw: i64) -> &BTreeMap<BookPrice, Level> {
+        if !self.is_on_grid(raw) {
+            &self.off_grid
+        } else if raw < self.anchor {
+            &self.below
+        } else {
+            &self.above
+        }
+    }
+
+    fn overflow_mut(&mut self, raw: i64) -> &mut BTreeMap<BookPrice, Level> {
+        if !self.is_on_grid(raw) {
+            &mut self.off_grid
+        } else if raw < self.anchor {
+            &mut self.below
+        } else {
+            &mut self.above
+        }
+    }
+
+    fn is_on_grid(&self, raw: i64) -> bool {
+        raw.rem_euclid(self.tick) == 0
+    }
+
+    fn is_new_top(&self, raw: i64) -> bool {
+        match self.first() {
+            Some(top) => match self.side.as_specified() {
+                OrderSideSpecified::Buy => raw > top.price.value.raw,
+                OrderSideSpecified::Sell => raw < top.price.value.raw,
+            },
+            None => true,
+        }
+    }
+
+    fn index_of(&self, raw: i64) -> Option<usize> {
+        let offset = raw.checked_sub(self.anchor)?;
+        if offset < 0 || offset % self.tick != 0 {
+            return None;
+        }
+        let index = usize::try_from(offset / self.tick).ok()?;
+        (index < self.capacity()).then_some(index)
+    }
+
+    fn place(&mut self, price: BookPrice, level: Level) {
+        match self.index_of(price.value.raw) {
+            Some(index) => {
+                if self.slots[index].replace(level).is_none() {
+                    self.set_bit(index);
+                }
+            }
+            None => {
+                self.overflow_mut(price.value.raw).insert(price, level);
+            }
+        }
+    }
+
+    /// Recenters the window on the best on-grid price once it has left the window, or has
+    /// drifted into the back quarter of it while levels are held in the overflow behind.
+    ///
+    /// A recenter is O(levels), but the best price must then move another quarter of the
+    /// window before the next one, so the cost is amortized over the moves which caused it.
+    fn rebalance(&mut self) {
+        let (outer, inner) = match self.side.as_specified() {
+            OrderSideSpecified::Buy => (&self.above, &self.below),
+            OrderSideSpecified::Sell => (&self.below, &self.above),
+        };
+
+        let best_raw = match (outer.keys().next(), self.best_index()) {
+            (Some(price), _) => price.value.raw,
+            (None, Some(index)) => self.slot_raw(index),
+            (None, None) => match inner.keys().next() {
+                Some(price) => price.value.raw,
+                None => return,
+            },
+        };
+
+        let drifted = match self.index_of(best_raw) {
+            Some(index) => !inner.is_empty() && self.is_in_back_quarter(index),
+            None => true,
+        };
+        if drifted {
+            self.recenter(best_raw);
+        }
+    }
+
+    fn slot_raw(&self, index: usize) -> i64 {
+        self.anchor + index as i64 * self.tick
+    }
+
+    /// Returns whether `index` lies in the quarter of the window furthest from the
+    /// direction in which prices improve.
+    fn is_in_back_quarter(&self, index: usize) -> bool {
+        let quarter = self.capacity() / 4;
+        match self.side.as_specified() {
+            OrderSideSpecified::Buy => index < quarter,
+            OrderSideSpecified::Sell => index >= self.capacity() - quarter,
+        }
+    }
+
+    /// Moves the array window so that `raw` sits at its center, re-homing every level.
+    fn recenter(&mut self, raw: i64) {
+        let mut levels = self.drain_slots();
+        levels.extend(std::mem::take(&mut self.below).into_values());
+        levels.extend(std::mem::take(&mut self.above).into_values());
+
+        let half_span = ((self.capacity() / 2) as i64).saturating_mul(self.tick);
+        let low = raw.saturating_sub(half_span);
+        let rem = low.rem_euclid(self.tick);
+        // Align down onto the tick grid, or up when that would pass `i64::MIN`
+        self.anchor = low
+            .checked_sub(rem)
+            .unwrap_or_else(|| low.saturating_add(self.tick - rem));
+
+        for level in levels {
+            self.place(level.price, level);
+        }
+    }
+
+    fn drain_slots(&mut self) -> Vec<Level> {
+        let mut levels = Vec::with_capacity(self.count);
+        let mut cursor = self.find_next(0);
+        while let Some(index) = cursor {
+            if let Some(level) = self.slots[index].take() {
+                levels.push(level);
+            }
+            cursor = self.find_next(index + 1);
+        }
+        self.words.fill(0);
+        self.summary.fill(0);
+        self.count = 0;
+        levels
+    }
+
+    fn best_index(&self) -> Option<usize> {
+        match self.side.as_specified() {
+            OrderSideSpecified::Buy => self.find_prev(self.capacity() - 1),
+            OrderSideSpecified::Sell => self.find_next(0),
+        }
+    }
+
+    fn set_bit(&mut self, index: usize) {
+        let word = index / WORD_BITS;
+        self.words[word] |= 1 << (index % WORD_BITS);
+        self.summary[word / WORD_BITS] |= 1 << (word % WORD_BITS);
+        self.count += 1;
+    }
+
+    fn clear_bit(&mut self, index: usize) {
+        let word = index / WORD_BITS;
+        self.words[word] &= !(1 << (index % WORD_BITS));
+        if self.words[word] == 0 {
+            self.summary[word / WORD_BITS] &= !(1 << (word % WORD_BITS));
+        }
+        self.count -= 1;
+    }
+
+    /// Returns the lowest occupied slot index at or above `from`.
+    fn find_next(&self, from: usize) -> Option<usize> {
+        let word = from / WORD_BITS;
+        if word >= self.words.len() {
+            return None;
+        }
+
+        let masked = self.words[word] & (u64::MAX << (from % WORD_BITS));
+        if masked != 0 {
+            return Some(word * WORD_BITS + masked.trailing_zeros() as usize);
+        }
+
+        let next_word = next_set_bit(&self.summary, word + 1)?;
+        Some(next_word * WORD_BITS + self.words[next_word].trailing_zeros() as usize)
+    }
+
+    /// Returns the highest occupied slot index at or below `from`.
+    fn find_prev(&self, from: usize) -> Option<usize> {
+        let word = from / WORD_BITS;
+        let masked = self.words[word] & (u64::MAX >> (WORD_BITS - 1 - from % WORD_BITS));
+        if masked != 0 {
+            return Some(word * WORD_BITS + WORD_BITS - 1 - masked.leading_zeros() as usize);
+        }
+
+        let prev_word = prev_set_bit(&self.summary, word.checked_sub(1)?)?;
+        Some(prev_word * WORD_BITS + WORD_BITS - 1 - self.words[prev_word].leading_zeros() as usize)
+    }
+}
+
+fn next_set_bit(bits: &[u64], from: usize) -> Option<usize> {
+    let mut word = from / WORD_BITS;
+    let mut mask = u64::MAX.checked_shl((from % WORD_BITS) as u32).unwrap_or(0);
+    while word < bits.len() {
+        let masked = bits[word] & mask;
+        if masked != 0 {
+            return Some(word * WORD_BITS + masked.trailing_zeros() as usize);
+        }
+        word += 1;
+        mask = u64::MAX;
+    }
+    None
+}
+
+fn prev_set_bit(bits: &[u64], from: usize) -> Option<usize> {
+    let mut word = from / WORD_BITS;
+    let mut mask = u64::MAX >> (WORD_BITS - 1 - from % WORD_BITS);
+    loop {
+        let masked = bits[word] & mask;
+        if masked != 0 {
+            return Some(word * WORD_BITS + WORD_BITS - 1 - masked.leading_zeros() as usize);
+        }
+        word = word.checked_sub(1)?;
+        mask = u64::MAX;
+    }
+}
+
+/// Iterates the levels of a [`TickLadder`] from best to worst price.
+pub struct TickLadderIter<'a> {
+    grid: Peekable<GridIter<'a>>,
+    off_grid: Peekable<btree_map::Values<'a, BookPrice, Level>>,
+}
+
+impl<'a> Iterator for TickLadderIter<'a> {
+    type Item = &'a Level;
+
+    fn next(&mut self) -> Option<Self::Item> {
+        match (self.grid.peek(), self.off_grid.peek()) {
+            (Some(level), Some(other)) if other.price < level.price => self.off_grid.next(),
+            (Some(_), _) => self.grid.next(),
+            (None, _) => self.off_grid.next(),
+        }
+    }
+}
+
+/// Iterates the on-grid levels of a [`TickLadder`]: the overflow ahead of the
+/// window, then the occupied slots, then the overflow behind it.
+struct GridIter<'a> {
+    ladder: &'a TickLadder,
+    head: btree_map::Values<'a, BookPrice, Level>,
+    tail: btree_map::Values<'a, BookPrice, Level>,
+    cursor: Option<usize>,
+}
+
+impl<'a> Iterator for GridIter<'a> {
+    type Item = &'a Level;
+
+    fn next(&mut self) -> Option<Self::Item> {
+        if let Some(level) = self.head.next() {
+            return Some(level);
+        }
+
+        if let Some(index) = self.cursor {
+            self.cursor = match self.ladder.side.as_specified() {
+                OrderSideSpecified::Buy => index
+                    .checked_sub(1)
+                    .and_then(|from| self.ladder.find_prev(from)),
+                OrderSideSpecified::Sell => self.ladder.find_next(index + 1),
+            };
+            return self.ladder.slots[index].as_ref();
+        }
+
+        self.tail.next()
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Tests
+////////////////////////////////////////////////////////////////////////////////
+#[cfg(test)]
+mod tests {
+    use rstest::rstest;
+
+    use crate::{
+        data::order::BookOrder,
+        enums::OrderSide,
+        orderbook::{level::Level, tick_ladder::TickLadder},
+        types::{price::Price, quantity::Quantity},
+    };
+
+    fn insert(ladder: &mut TickLadder, side: OrderSide, price: &str, order_id: u64) {
+        let order = BookOrder::new(side, Price::from(price), Quantity::from(1), order_id);
+        ladder.insert(order.to_book_price(), Level::from_order(order));
+    }
+
+    fn prices(ladder: &TickLadder) -> Vec<f64> {
+        ladder.iter().map(|l| l.price.value.as_f64()).collect()
+    }
+
+    #[rstest]
+    fn test_empty_ladder() {
+        let ladder = TickLadder::new(OrderSide::Buy, Price::from("0.01"), 100);
+        assert!(ladder.is_empty());
+        assert_eq!(ladder.capacity(), 128);
+        assert!(ladder.first().is_none());
+        assert_eq!(ladder.iter().count(), 0);
+    }
+
+    #[rstest]
+    fn test_bid_ordering_and_removal() {
+        let mut ladder = TickLadder::new(OrderSide::Buy, Price::from("0.01"), 64);
+        insert(&mut ladder, OrderSide::Buy, "10.00", 1);
+        insert(&mut ladder, OrderSide::Buy, "10.02", 2);
+        insert(&mut ladder, OrderSide::Buy, "9.97", 3);
+
+        assert_eq!(ladder.len(), 3);
+        assert_eq!(ladder.first().unwrap().price.value, Price::from("10.02"));
+        assert_eq!(prices(&ladder), vec![10.02, 10.00, 9.97]);
+
+        let top = ladder.first().unwrap().price;
+        assert!(ladder.remove(&top).is_some());
+        assert_eq!(ladder.first().unwrap().price.value, Price::from("10.00"));
+        assert_eq!(ladder.len(), 2);
+    }
+
+    #[rstest]
+    fn test_ask_ordering() {
+        let mut ladder = TickLadder::new(OrderSide::Sell, Price::from("0.01"), 64);
+        insert(&mut ladder, OrderSide::Sell, "10.05", 1);
+        insert(&mut ladder, OrderSide::Sell, "10.01", 2);
+        insert(&mut ladder, OrderSide::Sell, "10.03", 3);
+
+        assert_eq!(ladder.first().unwrap().price.value, Price::from("10.01"));
+        assert_eq!(prices(&ladder), vec![10.01, 10.03, 10.05]);
+    }
+
+    #[rstest]
+    fn test_recenters_when_top_moves_outside_window() {
+        let mut ladder = TickLadder::new(OrderSide::Buy, Price::from("0.01"), 64);
+        insert(&mut ladder, OrderSide::Buy, "10.00", 1);
+        insert(&mut ladder, OrderSide::Buy, "9.00", 2); // Deep level beyond the window
+        insert(&mut ladder, OrderSide::Buy, "11.00", 3); // New top beyond the window
+
+        assert_eq!(ladder.len(), 3);
+        assert_eq!(ladder.first().unwrap().price.value, Price::from("11.00"));
+        assert_eq!(prices(&ladder), vec![11.00, 10.00, 9.00]);
+    }
+
+    #[rstest]
+    fn test_recenters_when_top_level_removed() {
+        let mut ladder = TickLadder::new(OrderSide::Buy, Price::from("0.01"), 64);
+        insert(&mut ladder, OrderSide::Buy, "10.00", 1);
+        insert(&mut ladder, OrderSide::Buy, "9.00", 2); // Deep level beyond the window
+        insert(&mut ladder, OrderSide::Buy, "8.99", 3);
+        assert_eq!(ladder.count, 1);
+
+        let top = ladder.first().unwrap().price;
+        ladder.remove(&top);
+
+        assert_eq!(ladder.count, 2);
+        assert!(ladder.below.is_empty());
+        assert_eq!(ladder.first().unwrap().price.value, Price::from("9.00"));
+        assert_eq!(prices(&ladder), vec![9.00, 8.99]);
+    }
+
+    #[rstest]
+    fn test_recenters_when_market_drifts_away() {
+        let mut ladder = TickLadder::new(OrderSide::Sell, Price::from("0.01"), 64);
+        insert(&mut ladder, OrderSide::Sell, "10.00", 0);
+        for i in 1..=60 {
+            let price = format!("{:.2}", 10.0 + f64::from(i) * 0.01);
+            insert(&mut ladder, OrderSide::Sell, &price, i);
+        }
+        assert!(!ladder.above.is_empty());
+
+        // Asks lift away level by level until the best drifts into the back of the window
+        for _ in 0..20 {
+            let top = ladder.first().unwrap().price;
+            ladder.remove(&top);
+        }
+
+        assert_eq!(ladder.len(), 41);
+        assert_eq!(ladder.count, 28);
+        assert_eq!(ladder.above.len(), 13);
+        assert_eq!(ladder.first().unwrap().price.value, Price::from("10.20"));
+        assert!(ladder.index_of(Price::from("10.20").raw).is_some());
+    }
+
+    #[rstest]
+    fn test_recenter_near_min_price() {
+        let mut ladder = TickLadder::new(OrderSide::Buy, Price::from("0.01"), 64);
+        let min_price = Price::min(2);
+        let order = BookOrder::new(OrderSide::Buy, min_price, Quantity::from(1), 1);
+        ladder.insert(order.to_book_price(), Level::from_order(order));
+
+        assert_eq!(ladder.first().unwrap().price.value, min_price);
+        assert_eq!(ladder.anchor.rem_euclid(ladder.tick), 0);
+
+        ladder.recenter(i64::MIN);
+        assert_eq!(ladder.anchor.rem_euclid(ladder.tick), 0);
+        assert_eq!(ladder.first().unwrap().price.value, min_price);
+    }
+
+    #[rstest]
+    fn test_off_grid_and_boundary_prices() {
+        let mut ladder = TickLadder::new(OrderSide::Sell, Price::from("0.01"), 64);
+        insert(&mut ladder, OrderSide::Sell, "10.00", 1);
+        insert(&mut ladder, OrderSide::Sell, "10.01", 2);
+        insert(&mut ladder, OrderSide::Sell, "10.005", 3); // Off the tick grid
+
+        let max_price = Price::max(2);
+        let order = BookOrder::new(OrderSide::Sell, max_price, Quantity::from(1), 4);
+        ladder.insert(order.to_book_price(), Level::from_order(order));
+
+        assert_eq!(ladder.len(), 4);
+        assert_eq!(ladder.first().unwrap().price.value, Price::from("10.00"));
+        assert_eq!(prices(&ladder)[..3], [10.00, 10.005, 10.01]);
+        assert_eq!(ladder.iter().last().unwrap().price.value, max_price);
+    }
+
+    #[rstest]
+    fn test_clear() {
+        let mut ladder = TickLadder::new(OrderSide::Buy, Price::from("0.01"), 64);
+        insert(&mut ladder, OrderSide::Buy, "10.00", 1);
+        insert(&mut ladder, OrderSide::Buy, "5.00", 2);
+
+        ladder.clear();
+
+        assert!(ladder.is_empty());
+        assert!(ladder.first().is_none());
+    }
+}
@@ -0,0 +1,221 @@
+// -------------------------------------------------------------------------------------------------
+//  Copyright (C) 2015-2024 Nautech Systems Pty Ltd. All rights reserved.
+//  https://nautechsystems.io
+//
+//  Licensed under the GNU Lesser General Public License Version 3.0 (the "License");
+//  You may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at https://www.gnu.org/licenses/lgpl-3.0.en.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+// -------------------------------------------------------------------------------------------------
+
+//! A fixed-size top-of-book record for an order book, and a seqlock which publishes it
+//! to other threads.
+
+use std::{
+    hint,
+    sync::{
+        atomic::{fence, AtomicU64, Ordering},
+        Arc,
+    },
+};
+
+use nautilus_core::nanos::UnixNanos;
+
+use super::book::OrderBook;
+use crate::types::{price::Price, quantity::Quantity};
+
+/// The number of atomic words a [`TopOfBook`] is published as.
+const TOP_OF_BOOK_WORDS: usize = 7;
+/// The leading words holding the prices, sizes and their precisions.
+const TOP_OF_BOOK_QUOTE_WORDS: usize = 5;
+
+/// Represents the best bid and ask of an order book at a point in its event sequence.
+///
+/// A side with no levels has a zero price and size.
+#[repr(C)]
+#[derive(Clone, Copy, Debug, Default, PartialEq, Eq)]
+#[cfg_attr(
+    feature = "python",
+    pyo3::pyclass(module = "nautilus_trader.core.nautilus_pyo3.model")
+)]
+pub struct TopOfBook {
+    /// The best bid price.
+    pub bid_price: Price,
+    /// The size at the best bid price.
+    pub bid_size: Quantity,
+    /// The best ask price.
+    pub ask_price: Price,
+    /// The size at the best ask price.
+    pub ask_size: Quantity,
+    /// The last event sequence number for the order book.
+    pub sequence: u64,
+    /// The timestamp of the last event applied to the order book.
+    pub ts_last: UnixNanos,
+}
+
+impl TopOfBook {
+    /// Creates a new [`TopOfBook`] instance from the current state of the given `book`.
+    #[must_use]
+    pub fn from_book(book: &OrderBook) -> Self {
+        Self {
+            bid_price: book.best_bid_price().unwrap_or_default(),
+            bid_size: book.best_bid_size().unwrap_or_default(),
+            ask_price: book.best_ask_price().unwrap_or_default(),
+            ask_size: book.best_ask_size().unwrap_or_default(),
+            sequence: book.sequence,
+            ts_last: book.ts_last,
+        }
+    }
+
+    /// Returns whether the prices and sizes of both sides equal those of `other`,
+    /// including their precisions.
+    fn same_quotes(&self, other: &Self) -> bool {
+        self.to_words()[..TOP_OF_BOOK_QUOTE_WORDS] == other.to_words()[..TOP_OF_BOOK_QUOTE_WORDS]
+    }
+
+    fn to_words(self) -> [u64; TOP_OF_BOOK_WORDS] {
+        [
+            self.bid_price.raw as u64,
+            self.bid_size.raw,
+            self.ask_price.raw as u64,
+            self.ask_size.raw,
+            u64::from_le_bytes([
+                self.bid_price.precision,
+                self.bid_size.precision,
+                self.ask_price.precision,
+                self.ask_size.precision,
+                0,
+                0,
+                0,
+                0,
+            ]),
+            self.sequence,
+            self.ts_last.as_u64(),
+        ]
+    }
+
+    fn from_words(words: [u64; TOP_OF_BOOK_WORDS]) -> Self {
+        let precisions = words[4].to_le_bytes();
+        Self {
+            bid_price: Price {
+                raw: words[0] as i64,
+                precision: precisions[0],
+            },
+            bid_size: Quantity {
+                raw: words[1],
+                precision: precisions[1],
+            },
+            ask_price: Price {
+                raw: words[2] as i64,
+                precision: precisions[2],
+            },
+            ask_size: Quantity {
+                raw: words[3],
+                precision: precisions[3],
+            },
+            sequence: words[5],
+            ts_last: UnixNanos::from(words[6]),
+        }
+    }
+}
+
+/// A sequence lock over a [`TopOfBook`] encoded as atomic words.
+///
+/// The single writer makes the version odd while it stores the words, then even again.
+/// A reader retries whenever the version was odd or changed across its loads, so it
+/// never observes a torn record and never blocks the writer.
+#[derive(Debug, Default)]
+struct SharedTopOfBook {
+    version: AtomicU64,
+    words: [AtomicU64; TOP_OF_BOOK_WORDS],
+}
+
+impl SharedTopOfBook {
+    fn write(&self, top: TopOfBook) {
+        let version = self.version.load(Ordering::Relaxed);
+        self.version
+            .store(version.wrapping_add(1), Ordering::Relaxed);
+        fence(Ordering::Release);
+        for (word, value) in self.words.iter().zip(top.to_words()) {
+            word.store(value, Ordering::Relaxed);
+        }
+        self.version
+            .store(version.wrapping_add(2), Ordering::Release);
+    }
+
+    fn read(&self) -> TopOfBook {
+        loop {
+            let version = self.version.load(Ordering::Acquire);
+            if version & 1 == 0 {
+                let words = std::array::from_fn(|i| self.words[i].load(Ordering::Relaxed));
+                fence(Ordering::Acquire);
+                if self.version.load(Ordering::Relaxed) == version {
+                    return TopOfBook::from_words(words);
+                }
+            }
+            hint::spin_loop();
+        }
+    }
+}
+
+/// Provides a handle to the top of book published by an [`OrderBook`].
+///
+/// The handle can be cloned and sent to any thread, which then reads the latest record
+/// without locking or messaging the thread which owns the book.
+#[derive(Clone, Debug)]
+#[cfg_attr(
+    feature = "python",
+    pyo3::pyclass(module = "nautilus_trader.core.nautilus_pyo3.model")
+)]
+pub struct TopOfBookHandle {
+    shared: Arc<SharedTopOfBook>,
+}
+
+impl TopOfBookHandle {
+    /// Returns the latest top of book published by the order book.
+    #[must_use]
+    pub fn read(&self) -> TopOfBook {
+        self.shared.read()
+    }
+}
+
+/// Publishes the top of book of an [`OrderBook`] whenever its best prices or sizes change.
+#[derive(Debug)]
+pub(crate) struct TopOfBookPublisher {
+    shared: Arc<SharedTopOfBook>,
+    last: TopOfBook,
+}
+
+impl TopOfBookPublisher {
+    pub fn new(top: TopOfBook) -> Self {
+        let shared = Arc::new(SharedTopOfBook::default());
+        shared.write(top);
+        Self { shared, last: top }
+    }
+
+    pub fn handle(&self) -> TopOfBookHandle {
+        TopOfBookHandle {
+            shared: self.shared.clone(),
+        }
+    }
+
+    pub fn publish(&mut self, top: TopOfBook) {
+        if !top.same_quotes(&self.last) {
+            self.shared.write(top);
+            self.last = top;
+        }
+    }
+}
+
+impl Clone for TopOfBookPublisher {
+    /// Clones the publisher with its own shared record, so a cloned book never writes
+    /// to the handles of the original.
+    fn clone(&self) -> Self {
+        Self::new(self.last)
+    }
+}
@@ -72,7 +72,7 @@ impl OrderBookDeltas {
     #[pyo3(name = "deltas")]
     fn py_deltas(&self) -> Vec<OrderBookDelta> {
         // `OrderBookDelta` is `Copy`
-        self.deltas.clone()
+        self.deltas.to_vec()
     }
 
     #[getter]
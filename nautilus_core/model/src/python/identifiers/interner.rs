@@ -0,0 +1,93 @@
+// -------------------------------------------------------------------------------------------------
+//  Copyright (C) 2015-2024 Nautech Systems Pty Ltd. All rights reserved.
+//  https://nautechsystems.io
+//
+//  Licensed under the GNU Lesser General Public License Version 3.0 (the "License");
+//  You may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at https://www.gnu.org/licenses/lgpl-3.0.en.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+// -------------------------------------------------------------------------------------------------
+
+use pyo3::prelude::*;
+
+use crate::identifiers::interner::{
+    intern_bulk, interner_stats, reset_interner_stats, InternerStats,
+};
+
+#[pymethods]
+impl InternerStats {
+    #[getter]
+    #[pyo3(name = "entries")]
+    fn py_entries(&self) -> usize {
+        self.entries
+    }
+
+    #[getter]
+    #[pyo3(name = "allocated_bytes")]
+    fn py_allocated_bytes(&self) -> usize {
+        self.allocated_bytes
+    }
+
+    #[getter]
+    #[pyo3(name = "capacity_bytes")]
+    fn py_capacity_bytes(&self) -> usize {
+        self.capacity_bytes
+    }
+
+    #[getter]
+    #[pyo3(name = "lookups")]
+    fn py_lookups(&self) -> u64 {
+        self.lookups
+    }
+
+    #[getter]
+    #[pyo3(name = "bulk_calls")]
+    fn py_bulk_calls(&self) -> u64 {
+        self.bulk_calls
+    }
+
+    #[getter]
+    #[pyo3(name = "bulk_strings")]
+    fn py_bulk_strings(&self) -> u64 {
+        self.bulk_strings
+    }
+
+    #[getter]
+    #[pyo3(name = "bulk_inserts")]
+    fn py_bulk_inserts(&self) -> u64 {
+        self.bulk_inserts
+    }
+
+    #[getter]
+    #[pyo3(name = "bulk_nanos")]
+    fn py_bulk_nanos(&self) -> u64 {
+        self.bulk_nanos
+    }
+
+    fn __repr__(&self) -> String {
+        format!("{self:?}")
+    }
+}
+
+#[pyfunction]
+#[pyo3(name = "interner_stats")]
+pub fn py_interner_stats() -> InternerStats {
+    interner_stats()
+}
+
+#[pyfunction]
+#[pyo3(name = "interner_reset_stats")]
+pub fn py_interner_reset_stats() {
+    reset_interner_stats();
+}
+
+#[pyfunction]
+#[pyo3(name = "intern_strings")]
+pub fn py_intern_strings(values: Vec<&str>) -> usize {
+    intern_bulk(values)
+}
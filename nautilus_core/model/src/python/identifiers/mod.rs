@@ -27,6 +27,7 @@ use pyo3::{
 use crate::identifier_for_python;
 
 pub mod instrument_id;
+pub mod interner;
 pub mod symbol;
 pub mod trade_id;
 
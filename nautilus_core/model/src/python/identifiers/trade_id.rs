@@ -15,7 +15,6 @@
 
 use std::{
     collections::hash_map::DefaultHasher,
-    ffi::CString,
     hash::{Hash, Hasher},
     str::FromStr,
 };
@@ -28,7 +27,7 @@ use pyo3::{
     types::{PyString, PyTuple},
 };
 
-use crate::identifiers::trade_id::{TradeId, TRADE_ID_LEN};
+use crate::identifiers::trade_id::TradeId;
 
 #[pymethods]
 impl TradeId {
@@ -41,12 +40,7 @@ impl TradeId {
         let value: (&PyString,) = state.extract(py)?;
         let value_str: String = value.0.extract()?;
 
-        // TODO: Extract this to single function
-        let c_string = CString::new(value_str).expect("`CString` conversion failed");
-        let bytes = c_string.as_bytes_with_nul();
-        let mut value = [0; TRADE_ID_LEN];
-        value[..bytes.len()].copy_from_slice(bytes);
-        self.value = value;
+        *self = Self::new_checked(&value_str).map_err(to_pyvalue_err)?;
 
         Ok(())
     }
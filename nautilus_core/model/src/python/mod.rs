@@ -102,6 +102,19 @@ pub fn model(_: Python<'_>, m: &PyModule) -> PyResult<()> {
     m.add_class::<crate::identifiers::TraderId>()?;
     m.add_class::<crate::identifiers::Venue>()?;
     m.add_class::<crate::identifiers::VenueOrderId>()?;
+    m.add_class::<crate::identifiers::interner::InternerStats>()?;
+    m.add_function(wrap_pyfunction!(
+        crate::python::identifiers::interner::py_interner_stats,
+        m
+    )?)?;
+    m.add_function(wrap_pyfunction!(
+        crate::python::identifiers::interner::py_interner_reset_stats,
+        m
+    )?)?;
+    m.add_function(wrap_pyfunction!(
+        crate::python::identifiers::interner::py_intern_strings,
+        m
+    )?)?;
     // Orders
     m.add_class::<crate::orders::limit::LimitOrder>()?;
     m.add_class::<crate::orders::limit_if_touched::LimitIfTouchedOrder>()?;
@@ -117,6 +130,70 @@ pub fn model(_: Python<'_>, m: &PyModule) -> PyResult<()> {
     m.add_class::<crate::types::quantity::Quantity>()?;
     m.add_class::<crate::types::balance::AccountBalance>()?;
     m.add_class::<crate::types::balance::MarginBalance>()?;
+    m.add_function(wrap_pyfunction!(
+        crate::python::types::kernels::py_price_raw_from_f64,
+        m
+    )?)?;
+    m.add_function(wrap_pyfunction!(
+        crate::python::types::kernels::py_price_raw_to_f64,
+        m
+    )?)?;
+    m.add_function(wrap_pyfunction!(
+        crate::python::types::kernels::py_price_raw_rescale,
+        m
+    )?)?;
+    m.add_function(wrap_pyfunction!(
+        crate::python::types::kernels::py_price_raw_min,
+        m
+    )?)?;
+    m.add_function(wrap_pyfunction!(
+        crate::python::types::kernels::py_price_raw_max,
+        m
+    )?)?;
+    m.add_function(wrap_pyfunction!(
+        crate::python::types::kernels::py_price_raw_sum,
+        m
+    )?)?;
+    m.add_function(wrap_pyfunction!(
+        crate::python::types::kernels::py_price_raw_compare,
+        m
+    )?)?;
+    m.add_function(wrap_pyfunction!(
+        crate::python::types::kernels::py_price_raw_parse_delimited,
+        m
+    )?)?;
+    m.add_function(wrap_pyfunction!(
+        crate::python::types::kernels::py_quantity_raw_from_f64,
+        m
+    )?)?;
+    m.add_function(wrap_pyfunction!(
+        crate::python::types::kernels::py_quantity_raw_to_f64,
+        m
+    )?)?;
+    m.add_function(wrap_pyfunction!(
+        crate::python::types::kernels::py_quantity_raw_rescale,
+        m
+    )?)?;
+    m.add_function(wrap_pyfunction!(
+        crate::python::types::kernels::py_quantity_raw_min,
+        m
+    )?)?;
+    m.add_function(wrap_pyfunction!(
+        crate::python::types::kernels::py_quantity_raw_max,
+        m
+    )?)?;
+    m.add_function(wrap_pyfunction!(
+        crate::python::types::kernels::py_quantity_raw_sum,
+        m
+    )?)?;
+    m.add_function(wrap_pyfunction!(
+        crate::python::types::kernels::py_quantity_raw_compare,
+        m
+    )?)?;
+    m.add_function(wrap_pyfunction!(
+        crate::python::types::kernels::py_quantity_raw_parse_delimited,
+        m
+    )?)?;
     // Instruments
     m.add_class::<crate::instruments::binary_option::BinaryOption>()?;
     m.add_class::<crate::instruments::crypto_future::CryptoFuture>()?;
@@ -131,6 +208,8 @@ pub fn model(_: Python<'_>, m: &PyModule) -> PyResult<()> {
     // Order book
     m.add_class::<crate::orderbook::book::OrderBook>()?;
     m.add_class::<crate::orderbook::level::Level>()?;
+    m.add_class::<crate::orderbook::top::TopOfBook>()?;
+    m.add_class::<crate::orderbook::top::TopOfBookHandle>()?;
     m.add_function(wrap_pyfunction!(
         crate::python::orderbook::book::py_update_book_with_quote_tick,
         m
@@ -23,15 +23,32 @@ use crate::{
     },
     enums::{BookType, OrderSide},
     identifiers::InstrumentId,
-    orderbook::{analysis::book_check_integrity, book::OrderBook, level::Level},
+    orderbook::{
+        analysis::book_check_integrity,
+        book::OrderBook,
+        level::Level,
+        tick_ladder::TICK_LADDER_DEFAULT_CAPACITY,
+        top::{TopOfBook, TopOfBookHandle},
+    },
     types::{price::Price, quantity::Quantity},
 };
 
 #[pymethods]
 impl OrderBook {
     #[new]
-    fn py_new(instrument_id: InstrumentId, book_type: BookType) -> Self {
-        Self::new(instrument_id, book_type)
+    #[pyo3(signature = (instrument_id, book_type, price_increment=None, capacity=TICK_LADDER_DEFAULT_CAPACITY))]
+    fn py_new(
+        instrument_id: InstrumentId,
+        book_type: BookType,
+        price_increment: Option<Price>,
+        capacity: usize,
+    ) -> Self {
+        match price_increment {
+            Some(price_increment) => {
+                Self::new_tick_indexed(instrument_id, book_type, price_increment, capacity)
+            }
+            None => Self::new(instrument_id, book_type),
+        }
     }
 
     fn __repr__(&self) -> String {
@@ -178,6 +195,16 @@ impl OrderBook {
         self.best_ask_size()
     }
 
+    #[pyo3(name = "top_of_book")]
+    fn py_top_of_book(&self) -> TopOfBook {
+        self.top_of_book()
+    }
+
+    #[pyo3(name = "top_of_book_handle")]
+    fn py_top_of_book_handle(&mut self) -> TopOfBookHandle {
+        self.top_of_book_handle()
+    }
+
     #[pyo3(name = "spread")]
     fn py_spread(&self) -> Option<f64> {
         self.spread()
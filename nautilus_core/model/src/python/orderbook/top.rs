@@ -0,0 +1,80 @@
+// -------------------------------------------------------------------------------------------------
+//  Copyright (C) 2015-2024 Nautech Systems Pty Ltd. All rights reserved.
+//  https://nautechsystems.io
+//
+//  Licensed under the GNU Lesser General Public License Version 3.0 (the "License");
+//  You may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at https://www.gnu.org/licenses/lgpl-3.0.en.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+// -------------------------------------------------------------------------------------------------
+
+use pyo3::prelude::*;
+
+use crate::{
+    orderbook::top::{TopOfBook, TopOfBookHandle},
+    types::{price::Price, quantity::Quantity},
+};
+
+#[pymethods]
+impl TopOfBook {
+    fn __repr__(&self) -> String {
+        format!("{self:?}")
+    }
+
+    fn __str__(&self) -> String {
+        format!("{self:?}")
+    }
+
+    #[getter]
+    #[pyo3(name = "bid_price")]
+    fn py_bid_price(&self) -> Price {
+        self.bid_price
+    }
+
+    #[getter]
+    #[pyo3(name = "bid_size")]
+    fn py_bid_size(&self) -> Quantity {
+        self.bid_size
+    }
+
+    #[getter]
+    #[pyo3(name = "ask_price")]
+    fn py_ask_price(&self) -> Price {
+        self.ask_price
+    }
+
+    #[getter]
+    #[pyo3(name = "ask_size")]
+    fn py_ask_size(&self) -> Quantity {
+        self.ask_size
+    }
+
+    #[getter]
+    #[pyo3(name = "sequence")]
+    fn py_sequence(&self) -> u64 {
+        self.sequence
+    }
+
+    #[getter]
+    #[pyo3(name = "ts_last")]
+    fn py_ts_last(&self) -> u64 {
+        self.ts_last.as_u64()
+    }
+}
+
+#[pymethods]
+impl TopOfBookHandle {
+    fn __repr__(&self) -> String {
+        format!("{self:?}")
+    }
+
+    #[pyo3(name = "read")]
+    fn py_read(&self) -> TopOfBook {
+        self.read()
+    }
+}
@@ -0,0 +1,220 @@
+// -------------------------------------------------------------------------------------------------
+//  Copyright (C) 2015-2024 Nautech Systems Pty Ltd. All rights reserved.
+//  https://nautechsystems.io
+//
+//  Licensed under the GNU Lesser General Public License Version 3.0 (the "License");
+//  You may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at https://www.gnu.org/licenses/lgpl-3.0.en.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+// -------------------------------------------------------------------------------------------------
+
+//! NumPy friendly bindings for the bulk fixed-point kernels.
+//!
+//! Arguments are any objects supporting the buffer protocol (such as `numpy.ndarray`), which
+//! must be C-contiguous. Outputs are written in place into caller allocated buffers.
+
+use nautilus_core::python::to_pyvalue_err;
+use pyo3::{
+    buffer::{Element, PyBuffer},
+    prelude::*,
+};
+
+use crate::types::kernels::{
+    compare_fixed_i64_arrays, compare_fixed_u64_arrays, f64_to_fixed_i64_array,
+    f64_to_fixed_u64_array, fixed_i64_max, fixed_i64_min, fixed_i64_sum, fixed_i64_to_f64_array,
+    fixed_u64_max, fixed_u64_min, fixed_u64_sum, fixed_u64_to_f64_array, parse_fixed_i64_delimited,
+    parse_fixed_u64_delimited, rescale_fixed_i64_array, rescale_fixed_u64_array,
+};
+
+fn as_slice<T: Element>(buf: &PyBuffer<T>) -> PyResult<&[T]> {
+    if !buf.is_c_contiguous() {
+        return Err(to_pyvalue_err("buffer was not C-contiguous"));
+    }
+    if buf.item_count() == 0 {
+        return Ok(&[]);
+    }
+    // SAFETY: The buffer is C-contiguous with elements of type `T`, and is kept alive (and its
+    // exporter locked against resizing) for as long as the `PyBuffer` is held
+    Ok(unsafe { std::slice::from_raw_parts(buf.buf_ptr().cast::<T>(), buf.item_count()) })
+}
+
+#[allow(clippy::mut_from_ref)]
+fn as_mut_slice<T: Element>(buf: &PyBuffer<T>) -> PyResult<&mut [T]> {
+    if buf.readonly() {
+        return Err(to_pyvalue_err("output buffer was read-only"));
+    }
+    if !buf.is_c_contiguous() {
+        return Err(to_pyvalue_err("buffer was not C-contiguous"));
+    }
+    if buf.item_count() == 0 {
+        return Ok(&mut []);
+    }
+    // SAFETY: As for `as_slice`, with the buffer writable and not aliased by another argument
+    Ok(unsafe { std::slice::from_raw_parts_mut(buf.buf_ptr().cast::<T>(), buf.item_count()) })
+}
+
+fn check_len(lhs: usize, rhs: usize) -> PyResult<()> {
+    if lhs != rhs {
+        return Err(to_pyvalue_err(format!(
+            "buffer lengths differ ({lhs} != {rhs})"
+        )));
+    }
+    Ok(())
+}
+
+fn check_precision(precision: u8) -> PyResult<()> {
+    crate::types::fixed::check_fixed_precision(precision).map_err(to_pyvalue_err)
+}
+
+#[pyfunction]
+#[pyo3(name = "price_raw_from_f64")]
+pub fn py_price_raw_from_f64(
+    values: PyBuffer<f64>,
+    precision: u8,
+    out: PyBuffer<i64>,
+) -> PyResult<()> {
+    check_precision(precision)?;
+    let (values, out) = (as_slice(&values)?, as_mut_slice(&out)?);
+    check_len(values.len(), out.len())?;
+    f64_to_fixed_i64_array(values, precision, out);
+    Ok(())
+}
+
+#[pyfunction]
+#[pyo3(name = "price_raw_to_f64")]
+pub fn py_price_raw_to_f64(raws: PyBuffer<i64>, out: PyBuffer<f64>) -> PyResult<()> {
+    let (raws, out) = (as_slice(&raws)?, as_mut_slice(&out)?);
+    check_len(raws.len(), out.len())?;
+    fixed_i64_to_f64_array(raws, out);
+    Ok(())
+}
+
+#[pyfunction]
+#[pyo3(name = "price_raw_rescale")]
+pub fn py_price_raw_rescale(raws: PyBuffer<i64>, precision: u8) -> PyResult<()> {
+    check_precision(precision)?;
+    rescale_fixed_i64_array(as_mut_slice(&raws)?, precision);
+    Ok(())
+}
+
+#[pyfunction]
+#[pyo3(name = "price_raw_min")]
+pub fn py_price_raw_min(raws: PyBuffer<i64>) -> PyResult<Option<i64>> {
+    Ok(fixed_i64_min(as_slice(&raws)?))
+}
+
+#[pyfunction]
+#[pyo3(name = "price_raw_max")]
+pub fn py_price_raw_max(raws: PyBuffer<i64>) -> PyResult<Option<i64>> {
+    Ok(fixed_i64_max(as_slice(&raws)?))
+}
+
+#[pyfunction]
+#[pyo3(name = "price_raw_sum")]
+pub fn py_price_raw_sum(raws: PyBuffer<i64>) -> PyResult<i128> {
+    Ok(fixed_i64_sum(as_slice(&raws)?))
+}
+
+#[pyfunction]
+#[pyo3(name = "price_raw_compare")]
+pub fn py_price_raw_compare(
+    lhs: PyBuffer<i64>,
+    rhs: PyBuffer<i64>,
+    out: PyBuffer<i8>,
+) -> PyResult<()> {
+    let (lhs, rhs, out) = (as_slice(&lhs)?, as_slice(&rhs)?, as_mut_slice(&out)?);
+    check_len(lhs.len(), rhs.len())?;
+    check_len(lhs.len(), out.len())?;
+    compare_fixed_i64_arrays(lhs, rhs, out);
+    Ok(())
+}
+
+#[pyfunction]
+#[pyo3(name = "price_raw_parse_delimited")]
+pub fn py_price_raw_parse_delimited(
+    data: &[u8],
+    delimiter: u8,
+    out: PyBuffer<i64>,
+) -> PyResult<(usize, u8)> {
+    parse_fixed_i64_delimited(data, delimiter, as_mut_slice(&out)?)
+        .map_err(|e| to_pyvalue_err(format!("{e:#}")))
+}
+
+#[pyfunction]
+#[pyo3(name = "quantity_raw_from_f64")]
+pub fn py_quantity_raw_from_f64(
+    values: PyBuffer<f64>,
+    precision: u8,
+    out: PyBuffer<u64>,
+) -> PyResult<()> {
+    check_precision(precision)?;
+    let (values, out) = (as_slice(&values)?, as_mut_slice(&out)?);
+    check_len(values.len(), out.len())?;
+    f64_to_fixed_u64_array(values, precision, out);
+    Ok(())
+}
+
+#[pyfunction]
+#[pyo3(name = "quantity_raw_to_f64")]
+pub fn py_quantity_raw_to_f64(raws: PyBuffer<u64>, out: PyBuffer<f64>) -> PyResult<()> {
+    let (raws, out) = (as_slice(&raws)?, as_mut_slice(&out)?);
+    check_len(raws.len(), out.len())?;
+    fixed_u64_to_f64_array(raws, out);
+    Ok(())
+}
+
+#[pyfunction]
+#[pyo3(name = "quantity_raw_rescale")]
+pub fn py_quantity_raw_rescale(raws: PyBuffer<u64>, precision: u8) -> PyResult<()> {
+    check_precision(precision)?;
+    rescale_fixed_u64_array(as_mut_slice(&raws)?, precision);
+    Ok(())
+}
+
+#[pyfunction]
+#[pyo3(name = "quantity_raw_min")]
+pub fn py_quantity_raw_min(raws: PyBuffer<u64>) -> PyResult<Option<u64>> {
+    Ok(fixed_u64_min(as_slice(&raws)?))
+}
+
+#[pyfunction]
+#[pyo3(name = "quantity_raw_max")]
+pub fn py_quantity_raw_max(raws: PyBuffer<u64>) -> PyResult<Option<u64>> {
+    Ok(fixed_u64_max(as_slice(&raws)?))
+}
+
+#[pyfunction]
+#[pyo3(name = "quantity_raw_sum")]
+pub fn py_quantity_raw_sum(raws: PyBuffer<u64>) -> PyResult<u128> {
+    Ok(fixed_u64_sum(as_slice(&raws)?))
+}
+
+#[pyfunction]
+#[pyo3(name = "quantity_raw_compare")]
+pub fn py_quantity_raw_compare(
+    lhs: PyBuffer<u64>,
+    rhs: PyBuffer<u64>,
+    out: PyBuffer<i8>,
+) -> PyResult<()> {
+    let (lhs, rhs, out) = (as_slice(&lhs)?, as_slice(&rhs)?, as_mut_slice(&out)?);
+    check_len(lhs.len(), rhs.len())?;
+    check_len(lhs.len(), out.len())?;
+    compare_fixed_u64_arrays(lhs, rhs, out);
+    Ok(())
+}
+
+#[pyfunction]
+#[pyo3(name = "quantity_raw_parse_delimited")]
+pub fn py_quantity_raw_parse_delimited(
+    data: &[u8],
+    delimiter: u8,
+    out: PyBuffer<u64>,
+) -> PyResult<(usize, u8)> {
+    parse_fixed_u64_delimited(data, delimiter, as_mut_slice(&out)?)
+        .map_err(|e| to_pyvalue_err(format!("{e:#}")))
+}
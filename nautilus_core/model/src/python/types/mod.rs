@@ -17,6 +17,7 @@
 
 pub mod balance;
 pub mod currency;
+pub mod kernels;
 pub mod money;
 pub mod price;
 pub mod quantity;
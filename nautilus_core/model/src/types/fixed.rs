@@ -79,6 +79,155 @@ pub fn fixed_u64_to_f64(value: u64) -> f64 {
     (value as f64) / FIXED_SCALAR
 }
 
+const ASCII_ZEROS: u64 = 0x3030_3030_3030_3030;
+
+/// Returns whether all eight bytes packed (little-endian) into `chunk` are ASCII digits.
+#[inline]
+fn is_eight_digits(chunk: u64) -> bool {
+    let above = chunk.wrapping_add(0x4646_4646_4646_4646); // Sets high bit if byte > b'9'
+    let below = chunk.wrapping_sub(ASCII_ZEROS); // Sets high bit if byte < b'0'
+    (above | below) & 0x8080_8080_8080_8080 == 0
+}
+
+/// Returns the value of eight ASCII digits packed (little-endian) into `chunk`,
+/// combining adjacent digit pairs in parallel within the register (SWAR).
+#[inline]
+fn parse_eight_digits(chunk: u64) -> u64 {
+    let mut v = chunk.wrapping_sub(ASCII_ZEROS);
+    v = (v.wrapping_mul(10).wrapping_add(v >> 8)) & 0x00FF_00FF_00FF_00FF;
+    v = (v.wrapping_mul(100).wrapping_add(v >> 16)) & 0x0000_FFFF_0000_FFFF;
+    (v.wrapping_mul(10_000).wrapping_add(v >> 32)) & 0x0000_0000_FFFF_FFFF
+}
+
+/// Accumulates the run of ASCII digits at the start of `bytes` into `acc`,
+/// returning the number of digits consumed.
+fn accumulate_digits(bytes: &[u8], acc: &mut u64) -> anyhow::Result<usize> {
+    let overflow = || anyhow::anyhow!("Decimal value overflowed `u64`");
+    let mut i = 0;
+    while let Some(chunk) = bytes.get(i..i + 8) {
+        let chunk = u64::from_le_bytes(chunk.try_into().unwrap());
+        if !is_eight_digits(chunk) {
+            break;
+        }
+        *acc = acc
+            .checked_mul(100_000_000)
+            .and_then(|v| v.checked_add(parse_eight_digits(chunk)))
+            .ok_or_else(overflow)?;
+        i += 8;
+    }
+    while let Some(&b) = bytes.get(i) {
+        if !b.is_ascii_digit() {
+            break;
+        }
+        *acc = acc
+            .checked_mul(10)
+            .and_then(|v| v.checked_add(u64::from(b - b'0')))
+            .ok_or_else(overflow)?;
+        i += 1;
+    }
+    Ok(i)
+}
+
+/// Parses a decimal number from ASCII `bytes`, returning its sign, the raw fixed-point
+/// magnitude and the precision inferred from the number of fractional digits.
+fn parse_fixed(bytes: &[u8]) -> anyhow::Result<(bool, u64, u8)> {
+    let invalid = || anyhow::anyhow!("Invalid decimal value '{}'", String::from_utf8_lossy(bytes));
+    let trimmed = bytes.trim_ascii();
+    let (negative, rest) = match trimmed.first() {
+        Some(b'-') => (true, &trimmed[1..]),
+        Some(b'+') => (false, &trimmed[1..]),
+        _ => (false, trimmed),
+    };
+
+    let mut mantissa = 0_u64;
+    let int_len = accumulate_digits(rest, &mut mantissa)?;
+    let mut pos = int_len;
+    let mut frac_len = 0;
+    if rest.get(pos) == Some(&b'.') {
+        frac_len = accumulate_digits(&rest[pos + 1..], &mut mantissa)?;
+        pos += 1 + frac_len;
+    }
+    if int_len + frac_len == 0 {
+        return Err(invalid());
+    }
+
+    // Check for scientific notation
+    let mut exponent = 0_i64;
+    if matches!(rest.get(pos), Some(b'e' | b'E')) {
+        pos += 1;
+        let exp_negative = rest.get(pos) == Some(&b'-');
+        if matches!(rest.get(pos), Some(b'-' | b'+')) {
+            pos += 1;
+        }
+        let mut exp = 0_u64;
+        let exp_len = accumulate_digits(&rest[pos..], &mut exp)?;
+        if exp_len == 0 || exp > u64::from(u8::MAX) {
+            return Err(invalid());
+        }
+        pos += exp_len;
+        exponent = if exp_negative {
+            -(exp as i64)
+        } else {
+            exp as i64
+        };
+    }
+    if pos != rest.len() {
+        return Err(invalid());
+    }
+
+    let scale = frac_len as i64 - exponent;
+    if scale > i64::from(FIXED_PRECISION) {
+        anyhow::bail!(
+            "Condition failed: `precision` was greater than the maximum `FIXED_PRECISION` (9), was {scale}"
+        )
+    }
+    let precision = scale.max(0) as u8;
+    let shift = (i64::from(FIXED_PRECISION) - scale) as u32;
+    let raw = 10_u64
+        .checked_pow(shift)
+        .and_then(|pow| mantissa.checked_mul(pow))
+        .ok_or_else(|| anyhow::anyhow!("Decimal value overflowed `u64`"))?;
+    Ok((negative, raw, precision))
+}
+
+/// Parses a decimal number from ASCII `bytes` to a raw fixed-point `i64` value, returning the
+/// value along with the precision inferred from the number of fractional digits.
+///
+/// Digits are parsed eight at a time within a register and the value never passes through
+/// `f64`, so the result is exact. Scientific notation such as `1e-8` is also accepted.
+///
+/// # Errors
+///
+/// This function returns an error:
+/// - If `bytes` is not a valid decimal number.
+/// - If the inferred precision exceeds `FIXED_PRECISION`.
+/// - If the value overflows `i64`.
+pub fn parse_fixed_i64(bytes: &[u8]) -> anyhow::Result<(i64, u8)> {
+    let (negative, raw, precision) = parse_fixed(bytes)?;
+    let raw = i64::try_from(raw).map_err(|_| anyhow::anyhow!("Decimal value overflowed `i64`"))?;
+    Ok((if negative { -raw } else { raw }, precision))
+}
+
+/// Parses a decimal number from ASCII `bytes` to a raw fixed-point `u64` value, returning the
+/// value along with the precision inferred from the number of fractional digits.
+///
+/// # Errors
+///
+/// This function returns an error:
+/// - If `bytes` is not a valid decimal number.
+/// - If the value is negative.
+/// - If the inferred precision exceeds `FIXED_PRECISION`.
+pub fn parse_fixed_u64(bytes: &[u8]) -> anyhow::Result<(u64, u8)> {
+    let (negative, raw, precision) = parse_fixed(bytes)?;
+    if negative && raw != 0 {
+        anyhow::bail!(
+            "Condition failed: value was negative, was '{}'",
+            String::from_utf8_lossy(bytes)
+        )
+    }
+    Ok((raw, precision))
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // Tests
 ////////////////////////////////////////////////////////////////////////////////
@@ -222,4 +371,63 @@ mod tests {
         let result = fixed_u64_to_f64(value);
         assert_eq!(result, (value as f64) / FIXED_SCALAR);
     }
+
+    #[rstest]
+    #[case("0", 0, 0)]
+    #[case("1", 1_000_000_000, 0)]
+    #[case("-1.5", -1_500_000_000, 1)]
+    #[case("+2.25", 2_250_000_000, 2)]
+    #[case("  1.00  ", 1_000_000_000, 2)]
+    #[case(".5", 500_000_000, 1)]
+    #[case("5.", 5_000_000_000, 0)]
+    #[case("0.000000001", 1, 9)]
+    #[case("123456.789101112", 123_456_789_101_112, 9)]
+    #[case("12345678.87654321", 12_345_678_876_543_210, 8)]
+    #[case("1e-8", 10, 8)]
+    #[case("2.5E-3", 2_500_000, 4)]
+    #[case("1.5e3", 1_500_000_000_000, 0)]
+    fn test_parse_fixed_i64(#[case] input: &str, #[case] expected: i64, #[case] precision: u8) {
+        let result = parse_fixed_i64(input.as_bytes()).unwrap();
+        assert_eq!(result, (expected, precision));
+    }
+
+    #[rstest]
+    #[case("")]
+    #[case("-")]
+    #[case(".")]
+    #[case("1.2.3")]
+    #[case("12a")]
+    #[case("1e")]
+    #[case("1e-x")]
+    #[case("0.0000000001")]
+    #[case("99999999999999999999")]
+    #[case("10000000000")]
+    fn test_parse_fixed_i64_invalid(#[case] input: &str) {
+        assert!(parse_fixed_i64(input.as_bytes()).is_err());
+    }
+
+    #[rstest]
+    #[case("0.5", 500_000_000, 1)]
+    #[case("18446744073.709551615", u64::MAX, 9)]
+    #[case("-0", 0, 0)]
+    fn test_parse_fixed_u64(#[case] input: &str, #[case] expected: u64, #[case] precision: u8) {
+        let result = parse_fixed_u64(input.as_bytes()).unwrap();
+        assert_eq!(result, (expected, precision));
+    }
+
+    #[rstest]
+    fn test_parse_fixed_u64_negative() {
+        assert!(parse_fixed_u64(b"-0.5").is_err());
+    }
+
+    #[rstest]
+    #[case(0.1, 1)]
+    #[case(1234.5678, 4)]
+    #[case(0.000_123, 6)]
+    fn test_parse_fixed_matches_f64_conversion(#[case] value: f64, #[case] precision: u8) {
+        let text = format!("{value:.*}", usize::from(precision));
+        let (raw, parsed_precision) = parse_fixed_i64(text.as_bytes()).unwrap();
+        assert_eq!(raw, f64_to_fixed_i64(value, precision));
+        assert_eq!(parsed_precision, precision);
+    }
 }
@@ -0,0 +1,597 @@
+// -------------------------------------------------------------------------------------------------
+//  Copyright (C) 2015-2024 Nautech Systems Pty Ltd. All rights reserved.
+//  https://nautechsystems.io
+//
+//  Licensed under the GNU Lesser General Public License Version 3.0 (the "License");
+//  You may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at https://www.gnu.org/licenses/lgpl-3.0.en.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+// -------------------------------------------------------------------------------------------------
+
+//! Bulk kernels over contiguous arrays of raw fixed-point values.
+//!
+//! The kernels are written as straight-line loops over slices (with independent accumulator
+//! lanes for the reductions) so the compiler can auto-vectorize them for the target CPU.
+//! They avoid calls into libm and 128-bit arithmetic inside the loops, which would stop the
+//! compiler vectorizing them. Results are identical to applying the scalar functions in
+//! [`crate::types::fixed`] element-wise.
+
+use anyhow::Context;
+
+use crate::types::fixed::{parse_fixed_i64, parse_fixed_u64, FIXED_PRECISION, FIXED_SCALAR};
+
+/// The number of independent accumulator lanes used by the reduction kernels.
+const LANES: usize = 8;
+
+#[inline]
+fn check_same_len(lhs: usize, rhs: usize) {
+    assert_eq!(lhs, rhs, "slice lengths differ ({lhs} != {rhs})");
+}
+
+#[inline]
+fn check_precision(precision: u8) {
+    assert!(precision <= FIXED_PRECISION, "precision exceeded maximum 9");
+}
+
+#[inline]
+fn reduce_lanes<T: Copy>(values: &[T], identity: T, f: impl Fn(T, T) -> T) -> T {
+    let mut acc = [identity; LANES];
+    let chunks = values.chunks_exact(LANES);
+    let remainder = chunks.remainder();
+    for chunk in chunks {
+        for (a, &v) in acc.iter_mut().zip(chunk) {
+            *a = f(*a, v);
+        }
+    }
+    let mut result = acc.into_iter().fold(identity, &f);
+    for &v in remainder {
+        result = f(result, v);
+    }
+    result
+}
+
+/// Sums the values in independent 64-bit lanes, counting the carries out of each lane
+/// rather than widening every element to 128 bits.
+#[inline]
+fn sum_lanes<T: Copy>(values: &[T], to_u64: impl Fn(T) -> u64) -> u128 {
+    let mut sums = [0_u64; LANES];
+    let mut carries = [0_u64; LANES];
+    let chunks = values.chunks_exact(LANES);
+    let remainder = chunks.remainder();
+    for chunk in chunks {
+        for ((s, c), &v) in sums.iter_mut().zip(carries.iter_mut()).zip(chunk) {
+            let (sum, carry) = s.overflowing_add(to_u64(v));
+            *s = sum;
+            *c += u64::from(carry);
+        }
+    }
+    let mut total: u128 = remainder.iter().map(|&v| u128::from(to_u64(v))).sum();
+    for (&s, &c) in sums.iter().zip(&carries) {
+        total += u128::from(s) + (u128::from(c) << 64);
+    }
+    total
+}
+
+/// Rounds `value` half away from zero to an `i64`, exactly as `value.round() as i64` does.
+///
+/// The fraction left by a truncating conversion is exact, so comparing it against one half
+/// replaces the call to `round`. Out of range values saturate, leaving a fraction outside
+/// the open unit interval, so they are not adjusted.
+#[inline]
+fn round_to_i64(value: f64) -> i64 {
+    let truncated = value as i64;
+    let frac = value - truncated as f64;
+    truncated + i64::from((0.5..1.0).contains(&frac)) - i64::from((-1.0..=-0.5).contains(&frac))
+}
+
+/// Rounds `value` half away from zero to a `u64`, exactly as `value.round() as u64` does.
+///
+/// See [`round_to_i64`]; negative values saturate to zero and are never adjusted.
+#[inline]
+fn round_to_u64(value: f64) -> u64 {
+    let truncated = value as u64;
+    let frac = value - truncated as f64;
+    truncated + u64::from((0.5..1.0).contains(&frac))
+}
+
+/// Rounds `magnitude` half up to a multiple of `step`, saturating at the largest multiple
+/// of `step` which does not exceed `max`.
+#[inline]
+fn round_half_up(magnitude: u64, step: u64, max: u64) -> u64 {
+    let rounded = magnitude / step * step;
+    let rounded = if magnitude % step >= step / 2 {
+        rounded.checked_add(step).unwrap_or(rounded)
+    } else {
+        rounded
+    };
+    rounded.min(max / step * step)
+}
+
+#[inline]
+fn compare_arrays<T: Copy + Ord>(lhs: &[T], rhs: &[T], out: &mut [i8]) {
+    check_same_len(lhs.len(), rhs.len());
+    check_same_len(lhs.len(), out.len());
+    for ((o, &a), &b) in out.iter_mut().zip(lhs).zip(rhs) {
+        *o = i8::from(a > b) - i8::from(a < b);
+    }
+}
+
+/// Converts `values` to raw fixed-point `i64` values with the given `precision`, writing to `out`.
+///
+/// # Panics
+///
+/// This function panics:
+/// - If `precision` exceeds `FIXED_PRECISION`.
+/// - If `values` and `out` have different lengths.
+pub fn f64_to_fixed_i64_array(values: &[f64], precision: u8, out: &mut [i64]) {
+    check_precision(precision);
+    check_same_len(values.len(), out.len());
+    let pow1 = 10_i64.pow(u32::from(precision)) as f64;
+    let pow2 = 10_i64.pow(u32::from(FIXED_PRECISION - precision));
+    for (o, &v) in out.iter_mut().zip(values) {
+        *o = round_to_i64(v * pow1) * pow2;
+    }
+}
+
+/// Converts `values` to raw fixed-point `u64` values with the given `precision`, writing to `out`.
+///
+/// # Panics
+///
+/// This function panics:
+/// - If `precision` exceeds `FIXED_PRECISION`.
+/// - If `values` and `out` have different lengths.
+pub fn f64_to_fixed_u64_array(values: &[f64], precision: u8, out: &mut [u64]) {
+    check_precision(precision);
+    check_same_len(values.len(), out.len());
+    let pow1 = 10_u64.pow(u32::from(precision)) as f64;
+    let pow2 = 10_u64.pow(u32::from(FIXED_PRECISION - precision));
+    for (o, &v) in out.iter_mut().zip(values) {
+        *o = round_to_u64(v * pow1) * pow2;
+    }
+}
+
+/// Converts raw fixed-point `i64` values back to `f64` values, writing to `out`.
+///
+/// # Panics
+///
+/// This function panics:
+/// - If `raws` and `out` have different lengths.
+pub fn fixed_i64_to_f64_array(raws: &[i64], out: &mut [f64]) {
+    check_same_len(raws.len(), out.len());
+    for (o, &r) in out.iter_mut().zip(raws) {
+        *o = r as f64 / FIXED_SCALAR;
+    }
+}
+
+/// Converts raw fixed-point `u64` values back to `f64` values, writing to `out`.
+///
+/// # Panics
+///
+/// This function panics:
+/// - If `raws` and `out` have different lengths.
+pub fn fixed_u64_to_f64_array(raws: &[u64], out: &mut [f64]) {
+    check_same_len(raws.len(), out.len());
+    for (o, &r) in out.iter_mut().zip(raws) {
+        *o = r as f64 / FIXED_SCALAR;
+    }
+}
+
+/// Rounds raw fixed-point `i64` values in place to the given (coarser) `precision`.
+///
+/// Ties are rounded half away from zero, consistent with [`f64::round`]. Values which would
+/// round beyond the range of `i64` saturate at the furthest multiple of the new precision.
+///
+/// # Panics
+///
+/// This function panics:
+/// - If `precision` exceeds `FIXED_PRECISION`.
+pub fn rescale_fixed_i64_array(raws: &mut [i64], precision: u8) {
+    check_precision(precision);
+    if precision == FIXED_PRECISION {
+        return;
+    }
+    let step = 10_u64.pow(u32::from(FIXED_PRECISION - precision));
+    for r in raws.iter_mut() {
+        let max = if *r < 0 { i64::MIN } else { i64::MAX }.unsigned_abs();
+        // The magnitude is a multiple of `step` not above `max`, so is below 2^63
+        let magnitude = round_half_up(r.unsigned_abs(), step, max) as i64;
+        *r = if *r < 0 { -magnitude } else { magnitude };
+    }
+}
+
+/// Rounds raw fixed-point `u64` values in place to the given (coarser) `precision`.
+///
+/// Ties are rounded half up, consistent with [`f64::round`] for non-negative values. Values
+/// which would round beyond `u64::MAX` saturate at the largest multiple of the new precision.
+///
+/// # Panics
+///
+/// This function panics:
+/// - If `precision` exceeds `FIXED_PRECISION`.
+pub fn rescale_fixed_u64_array(raws: &mut [u64], precision: u8) {
+    check_precision(precision);
+    if precision == FIXED_PRECISION {
+        return;
+    }
+    let step = 10_u64.pow(u32::from(FIXED_PRECISION - precision));
+    for r in raws.iter_mut() {
+        *r = round_half_up(*r, step, u64::MAX);
+    }
+}
+
+/// Returns the minimum of the raw `i64` values, or `None` if `raws` is empty.
+#[must_use]
+pub fn fixed_i64_min(raws: &[i64]) -> Option<i64> {
+    (!raws.is_empty()).then(|| reduce_lanes(raws, i64::MAX, i64::min))
+}
+
+/// Returns the maximum of the raw `i64` values, or `None` if `raws` is empty.
+#[must_use]
+pub fn fixed_i64_max(raws: &[i64]) -> Option<i64> {
+    (!raws.is_empty()).then(|| reduce_lanes(raws, i64::MIN, i64::max))
+}
+
+/// Returns the sum of the raw `i64` values, widened to `i128` so it cannot overflow.
+#[must_use]
+pub fn fixed_i64_sum(raws: &[i64]) -> i128 {
+    // Offset each value by 2^63 into the `u64` range, then remove the offsets
+    let offset_sum = sum_lanes(raws, |r| (r as u64) ^ (1 << 63));
+    offset_sum as i128 - ((raws.len() as i128) << 63)
+}
+
+/// Returns the minimum of the raw `u64` values, or `None` if `raws` is empty.
+#[must_use]
+pub fn fixed_u64_min(raws: &[u64]) -> Option<u64> {
+    (!raws.is_empty()).then(|| reduce_lanes(raws, u64::MAX, u64::min))
+}
+
+/// Returns the maximum of the raw `u64` values, or `None` if `raws` is empty.
+#[must_use]
+pub fn fixed_u64_max(raws: &[u64]) -> Option<u64> {
+    (!raws.is_empty()).then(|| reduce_lanes(raws, u64::MIN, u64::max))
+}
+
+/// Returns the sum of the raw `u64` values, widened to `u128` so it cannot overflow.
+#[must_use]
+pub fn fixed_u64_sum(raws: &[u64]) -> u128 {
+    sum_lanes(raws, |r| r)
+}
+
+/// Compares raw `i64` values element-wise, writing -1, 0 or 1 to `out` when the `lhs` value
+/// is less than, equal to or greater than the `rhs` value.
+///
+/// # Panics
+///
+/// This function panics:
+/// - If `lhs`, `rhs` and `out` do not all have the same length.
+pub fn compare_fixed_i64_arrays(lhs: &[i64], rhs: &[i64], out: &mut [i8]) {
+    compare_arrays(lhs, rhs, out);
+}
+
+/// Compares raw `u64` values element-wise, writing -1, 0 or 1 to `out` when the `lhs` value
+/// is less than, equal to or greater than the `rhs` value.
+///
+/// # Panics
+///
+/// This function panics:
+/// - If `lhs`, `rhs` and `out` do not all have the same length.
+pub fn compare_fixed_u64_arrays(lhs: &[u64], rhs: &[u64], out: &mut [i8]) {
+    compare_arrays(lhs, rhs, out);
+}
+
+#[inline]
+fn parse_delimited<T>(
+    buf: &[u8],
+    delimiter: u8,
+    out: &mut [T],
+    parse: impl Fn(&[u8]) -> anyhow::Result<(T, u8)>,
+) -> anyhow::Result<(usize, u8)> {
+    let buf = buf.strip_suffix(&[delimiter]).unwrap_or(buf);
+    if buf.is_empty() {
+        return Ok((0, 0));
+    }
+    let capacity = out.len();
+    let mut count = 0;
+    let mut max_precision = 0;
+    for field in buf.split(|&b| b == delimiter) {
+        let slot = out
+            .get_mut(count)
+            .with_context(|| format!("More than {capacity} values to parse"))?;
+        let (raw, precision) =
+            parse(field).with_context(|| format!("Failed to parse field {count}"))?;
+        *slot = raw;
+        count += 1;
+        max_precision = max_precision.max(precision);
+    }
+    Ok((count, max_precision))
+}
+
+/// Parses the `delimiter` separated decimal values in ASCII `buf` to raw fixed-point `i64`
+/// values written to the front of `out`, returning the number of values written and the
+/// maximum precision inferred across them.
+///
+/// Values are parsed exactly with [`parse_fixed_i64`] rather than through `f64`.
+/// A single trailing delimiter is ignored.
+///
+/// # Errors
+///
+/// This function returns an error:
+/// - If any value fails to parse (values before it remain written to `out`).
+/// - If there are more values than the length of `out`.
+pub fn parse_fixed_i64_delimited(
+    buf: &[u8],
+    delimiter: u8,
+    out: &mut [i64],
+) -> anyhow::Result<(usize, u8)> {
+    parse_delimited(buf, delimiter, out, parse_fixed_i64)
+}
+
+/// Parses the `delimiter` separated decimal values in ASCII `buf` to raw fixed-point `u64`
+/// values written to the front of `out`, returning the number of values written and the
+/// maximum precision inferred across them.
+///
+/// Values are parsed exactly with [`parse_fixed_u64`] rather than through `f64`.
+/// A single trailing delimiter is ignored.
+///
+/// # Errors
+///
+/// This function returns an error:
+/// - If any value fails to parse (values before it remain written to `out`).
+/// - If there are more values than the length of `out`.
+pub fn parse_fixed_u64_delimited(
+    buf: &[u8],
+    delimiter: u8,
+    out: &mut [u64],
+) -> anyhow::Result<(usize, u8)> {
+    parse_delimited(buf, delimiter, out, parse_fixed_u64)
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Tests
+////////////////////////////////////////////////////////////////////////////////
+#[cfg(test)]
+mod tests {
+    use rstest::rstest;
+
+    use super::*;
+    use crate::types::fixed::{
+        f64_to_fixed_i64, f64_to_fixed_u64, fixed_i64_to_f64, fixed_u64_to_f64,
+    };
+
+    const VALUES: [f64; 11] = [
+        0.0,
+        1.0,
+        -1.0,
+        1.5,
+        -2.5,
+        0.000_000_001,
+        123.456_789,
+        -99.999_5,
+        1e6,
+        0.5,
+        -0.5,
+    ];
+
+    #[rstest]
+    #[case(0)]
+    #[case(2)]
+    #[case(5)]
+    #[case(FIXED_PRECISION)]
+    fn test_f64_to_fixed_i64_array_matches_scalar(#[case] precision: u8) {
+        let mut out = [0_i64; VALUES.len()];
+        f64_to_fixed_i64_array(&VALUES, precision, &mut out);
+
+        for (&v, &r) in VALUES.iter().zip(&out) {
+            assert_eq!(r, f64_to_fixed_i64(v, precision));
+        }
+    }
+
+    #[rstest]
+    #[case(0)]
+    #[case(3)]
+    #[case(FIXED_PRECISION)]
+    fn test_f64_to_fixed_u64_array_matches_scalar(#[case] precision: u8) {
+        let values: Vec<f64> = VALUES.iter().map(|v| v.abs()).collect();
+        let mut out = vec![0_u64; values.len()];
+        f64_to_fixed_u64_array(&values, precision, &mut out);
+
+        for (&v, &r) in values.iter().zip(&out) {
+            assert_eq!(r, f64_to_fixed_u64(v, precision));
+        }
+    }
+
+    #[rstest]
+    fn test_round_matches_f64_round() {
+        let values = [
+            0.5,
+            -0.5,
+            2.5,
+            -2.5,
+            0.499_999_999_999_999_94,
+            -0.499_999_999_999_999_94,
+            4_503_599_627_370_495.5,
+            -4_503_599_627_370_495.5,
+            9_007_199_254_740_993.0,
+            9.223_372_036_854_776e18,
+            1.844_674_407_370_955_2e19,
+            1e300,
+            -1e300,
+            f64::INFINITY,
+            f64::NEG_INFINITY,
+            f64::NAN,
+            -0.0,
+        ];
+        for v in values {
+            assert_eq!(round_to_i64(v), v.round() as i64, "{v}");
+            assert_eq!(round_to_u64(v), v.round() as u64, "{v}");
+        }
+    }
+
+    #[rstest]
+    fn test_fixed_to_f64_arrays_match_scalar() {
+        let raws_i64: Vec<i64> = VALUES.iter().map(|&v| f64_to_fixed_i64(v, 9)).collect();
+        let raws_u64: Vec<u64> = raws_i64.iter().map(|r| r.unsigned_abs()).collect();
+        let mut out_i64 = vec![0.0; raws_i64.len()];
+        let mut out_u64 = vec![0.0; raws_u64.len()];
+
+        fixed_i64_to_f64_array(&raws_i64, &mut out_i64);
+        fixed_u64_to_f64_array(&raws_u64, &mut out_u64);
+
+        for (i, &r) in raws_i64.iter().enumerate() {
+            assert_eq!(out_i64[i], fixed_i64_to_f64(r));
+            assert_eq!(out_u64[i], fixed_u64_to_f64(raws_u64[i]));
+        }
+    }
+
+    #[rstest]
+    #[should_panic(expected = "slice lengths differ")]
+    fn test_mismatched_lengths_panics() {
+        let mut out = [0_i64; 2];
+        f64_to_fixed_i64_array(&[1.0], 2, &mut out);
+    }
+
+    #[rstest]
+    #[case(
+        0,
+        &[1_500_000_000, -1_500_000_000, 1_499_999_999, -400_000_000],
+        &[2_000_000_000, -2_000_000_000, 1_000_000_000, 0],
+    )]
+    #[case(
+        2,
+        &[1_005_000_000, -1_005_000_000, 1_004_999_999, 12],
+        &[1_010_000_000, -1_010_000_000, 1_000_000_000, 0],
+    )]
+    #[case(9, &[1, -1, 123, 0], &[1, -1, 123, 0])]
+    fn test_rescale_fixed_i64_array(
+        #[case] precision: u8,
+        #[case] raws: &[i64],
+        #[case] expected: &[i64],
+    ) {
+        let mut raws = raws.to_vec();
+        rescale_fixed_i64_array(&mut raws, precision);
+        assert_eq!(raws, expected);
+    }
+
+    #[rstest]
+    fn test_rescale_fixed_u64_array() {
+        let mut raws = vec![1_500_000_000, 1_499_999_999, 0, 250_000_000];
+        rescale_fixed_u64_array(&mut raws, 0);
+        assert_eq!(raws, vec![2_000_000_000, 1_000_000_000, 0, 0]);
+    }
+
+    #[rstest]
+    fn test_rescale_saturates_at_limits() {
+        let mut raws_u64 = vec![u64::MAX, u64::MAX - 1_000_000_000];
+        let mut raws_i64 = vec![i64::MAX, i64::MIN, i64::MIN + 1];
+
+        rescale_fixed_u64_array(&mut raws_u64, 0);
+        rescale_fixed_i64_array(&mut raws_i64, 0);
+
+        assert_eq!(
+            raws_u64,
+            vec![18_446_744_073_000_000_000, 18_446_744_073_000_000_000]
+        );
+        assert_eq!(
+            raws_i64,
+            vec![
+                9_223_372_036_000_000_000,
+                -9_223_372_036_000_000_000,
+                -9_223_372_036_000_000_000,
+            ]
+        );
+    }
+
+    #[rstest]
+    fn test_reductions_i64() {
+        let raws: Vec<i64> = (-10..=20).map(|i| i * 1_000_000_000).collect();
+
+        assert_eq!(fixed_i64_min(&raws), Some(-10_000_000_000));
+        assert_eq!(fixed_i64_max(&raws), Some(20_000_000_000));
+        assert_eq!(fixed_i64_sum(&raws), 155_000_000_000);
+        assert_eq!(fixed_i64_sum(&[i64::MIN; 17]), i128::from(i64::MIN) * 17);
+        assert_eq!(fixed_i64_sum(&[i64::MAX; 17]), i128::from(i64::MAX) * 17);
+        assert_eq!(fixed_i64_min(&[]), None);
+        assert_eq!(fixed_i64_max(&[]), None);
+        assert_eq!(fixed_i64_sum(&[]), 0);
+    }
+
+    #[rstest]
+    fn test_reductions_u64() {
+        let raws: Vec<u64> = (1..=17).rev().collect();
+
+        assert_eq!(fixed_u64_min(&raws), Some(1));
+        assert_eq!(fixed_u64_max(&raws), Some(17));
+        assert_eq!(fixed_u64_sum(&raws), 153);
+        assert_eq!(
+            fixed_u64_sum(&[u64::MAX, u64::MAX]),
+            u128::from(u64::MAX) * 2
+        );
+        assert_eq!(fixed_u64_sum(&[u64::MAX; 33]), u128::from(u64::MAX) * 33);
+        assert_eq!(fixed_u64_min(&[]), None);
+    }
+
+    #[rstest]
+    fn test_compare_arrays() {
+        let lhs = [1, 2, 3, -4];
+        let rhs = [2, 2, 1, -5];
+        let mut out = [0_i8; 4];
+
+        compare_fixed_i64_arrays(&lhs, &rhs, &mut out);
+        assert_eq!(out, [-1, 0, 1, 1]);
+
+        compare_fixed_u64_arrays(&[0, 5], &[0, 7], &mut out[..2]);
+        assert_eq!(out[..2], [0, -1]);
+    }
+
+    #[rstest]
+    fn test_parse_fixed_i64_delimited() {
+        let mut out = [0_i64; 4];
+        let (count, precision) =
+            parse_fixed_i64_delimited(b"1.5\n-2.25\r\n3\n", b'\n', &mut out).unwrap();
+
+        assert_eq!(count, 3);
+        assert_eq!(out, [1_500_000_000, -2_250_000_000, 3_000_000_000, 0]);
+        assert_eq!(precision, 2);
+    }
+
+    #[rstest]
+    fn test_parse_fixed_u64_delimited() {
+        let mut out = [0_u64; 3];
+        let (count, precision) =
+            parse_fixed_u64_delimited(b"0.001,100,2.5", b',', &mut out).unwrap();
+
+        assert_eq!(count, 3);
+        assert_eq!(out, [1_000_000, 100_000_000_000, 2_500_000_000]);
+        assert_eq!(precision, 3);
+        assert_eq!(
+            parse_fixed_u64_delimited(b"", b',', &mut []).unwrap(),
+            (0, 0)
+        );
+    }
+
+    #[rstest]
+    fn test_parse_fixed_delimited_invalid_field() {
+        let mut out = [0_i64; 3];
+        let result = parse_fixed_i64_delimited(b"1,,2", b',', &mut out);
+
+        assert_eq!(result.unwrap_err().to_string(), "Failed to parse field 1");
+        assert_eq!(out, [1_000_000_000, 0, 0]);
+    }
+
+    #[rstest]
+    fn test_parse_fixed_delimited_exceeds_out() {
+        let mut out = [0_u64; 2];
+        let result = parse_fixed_u64_delimited(b"1,2,3", b',', &mut out);
+
+        assert_eq!(
+            result.unwrap_err().to_string(),
+            "More than 2 values to parse"
+        );
+        assert_eq!(out, [1_000_000_000, 2_000_000_000]);
+    }
+}
@@ -18,6 +18,7 @@
 pub mod balance;
 pub mod currency;
 pub mod fixed;
+pub mod kernels;
 pub mod money;
 pub mod price;
 pub mod quantity;
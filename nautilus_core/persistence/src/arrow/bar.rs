@@ -21,14 +21,18 @@ use datafusion::arrow::{
     error::ArrowError,
     record_batch::RecordBatch,
 };
+use nautilus_core::nanos::UnixNanos;
 use nautilus_model::{
-    data::bar::{Bar, BarType},
+    data::{
+        bar::{Bar, BarType},
+        batch::BarBatch,
+    },
     types::{price::Price, quantity::Quantity},
 };
 
 use super::{
-    extract_column, DecodeDataFromRecordBatch, EncodingError, KEY_BAR_TYPE, KEY_PRICE_PRECISION,
-    KEY_SIZE_PRECISION,
+    extract_column, DecodeColumnsFromRecordBatch, DecodeDataFromRecordBatch, EncodingError,
+    KEY_BAR_TYPE, KEY_PRICE_PRECISION, KEY_SIZE_PRECISION,
 };
 use crate::arrow::{ArrowSchemaProvider, Data, DecodeFromRecordBatch, EncodeToRecordBatch};
 
@@ -172,6 +176,50 @@ impl DecodeDataFromRecordBatch for Bar {
     }
 }
 
+impl DecodeColumnsFromRecordBatch for Bar {
+    type Batch = BarBatch;
+
+    fn decode_columns(
+        metadata: &HashMap<String, String>,
+        record_batch: RecordBatch,
+    ) -> Result<Self::Batch, EncodingError> {
+        let (bar_type, price_precision, size_precision) = parse_metadata(metadata)?;
+        let cols = record_batch.columns();
+
+        let open_values = extract_column::<Int64Array>(cols, "open", 0, DataType::Int64)?;
+        let high_values = extract_column::<Int64Array>(cols, "high", 1, DataType::Int64)?;
+        let low_values = extract_column::<Int64Array>(cols, "low", 2, DataType::Int64)?;
+        let close_values = extract_column::<Int64Array>(cols, "close", 3, DataType::Int64)?;
+        let volume_values = extract_column::<UInt64Array>(cols, "volume", 4, DataType::UInt64)?;
+        let ts_event_values = extract_column::<UInt64Array>(cols, "ts_event", 5, DataType::UInt64)?;
+        let ts_init_values = extract_column::<UInt64Array>(cols, "ts_init", 6, DataType::UInt64)?;
+
+        let ts_event = ts_event_values
+            .values()
+            .iter()
+            .map(|&ts| UnixNanos::from(ts))
+            .collect();
+        let ts_init = ts_init_values
+            .values()
+            .iter()
+            .map(|&ts| UnixNanos::from(ts))
+            .collect();
+
+        Ok(BarBatch {
+            bar_type,
+            price_precision,
+            size_precision,
+            open: open_values.values().to_vec(),
+            high: high_values.values().to_vec(),
+            low: low_values.values().to_vec(),
+            close: close_values.values().to_vec(),
+            volume: volume_values.values().to_vec(),
+            ts_event,
+            ts_init,
+        })
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // Tests
 ////////////////////////////////////////////////////////////////////////////////
@@ -21,16 +21,17 @@ use datafusion::arrow::{
     error::ArrowError,
     record_batch::RecordBatch,
 };
+use nautilus_core::nanos::UnixNanos;
 use nautilus_model::{
-    data::{delta::OrderBookDelta, order::BookOrder},
+    data::{batch::DeltaBatch, delta::OrderBookDelta, order::BookOrder},
     enums::{BookAction, FromU8, OrderSide},
     identifiers::InstrumentId,
     types::{price::Price, quantity::Quantity},
 };
 
 use super::{
-    extract_column, DecodeDataFromRecordBatch, EncodingError, KEY_INSTRUMENT_ID,
-    KEY_PRICE_PRECISION, KEY_SIZE_PRECISION,
+    extract_column, DecodeColumnsFromRecordBatch, DecodeDataFromRecordBatch, EncodingError,
+    KEY_INSTRUMENT_ID, KEY_PRICE_PRECISION, KEY_SIZE_PRECISION,
 };
 use crate::arrow::{ArrowSchemaProvider, Data, DecodeFromRecordBatch, EncodeToRecordBatch};
 
@@ -206,6 +207,78 @@ impl DecodeDataFromRecordBatch for OrderBookDelta {
     }
 }
 
+impl DecodeColumnsFromRecordBatch for OrderBookDelta {
+    type Batch = DeltaBatch;
+
+    fn decode_columns(
+        metadata: &HashMap<String, String>,
+        record_batch: RecordBatch,
+    ) -> Result<Self::Batch, EncodingError> {
+        let (instrument_id, price_precision, size_precision) = parse_metadata(metadata)?;
+        let cols = record_batch.columns();
+
+        let action_values = extract_column::<UInt8Array>(cols, "action", 0, DataType::UInt8)?;
+        let side_values = extract_column::<UInt8Array>(cols, "side", 1, DataType::UInt8)?;
+        let price_values = extract_column::<Int64Array>(cols, "price", 2, DataType::Int64)?;
+        let size_values = extract_column::<UInt64Array>(cols, "size", 3, DataType::UInt64)?;
+        let order_id_values = extract_column::<UInt64Array>(cols, "order_id", 4, DataType::UInt64)?;
+        let flags_values = extract_column::<UInt8Array>(cols, "flags", 5, DataType::UInt8)?;
+        let sequence_values = extract_column::<UInt64Array>(cols, "sequence", 6, DataType::UInt64)?;
+        let ts_event_values = extract_column::<UInt64Array>(cols, "ts_event", 7, DataType::UInt64)?;
+        let ts_init_values = extract_column::<UInt64Array>(cols, "ts_init", 8, DataType::UInt64)?;
+
+        let action = action_values
+            .values()
+            .iter()
+            .map(|&value| {
+                BookAction::from_u8(value).ok_or_else(|| {
+                    EncodingError::ParseError(
+                        stringify!(BookAction),
+                        format!("Invalid enum value, was {value}"),
+                    )
+                })
+            })
+            .collect::<Result<Vec<_>, _>>()?;
+        let side = side_values
+            .values()
+            .iter()
+            .map(|&value| {
+                OrderSide::from_u8(value).ok_or_else(|| {
+                    EncodingError::ParseError(
+                        stringify!(OrderSide),
+                        format!("Invalid enum value, was {value}"),
+                    )
+                })
+            })
+            .collect::<Result<Vec<_>, _>>()?;
+        let ts_event = ts_event_values
+            .values()
+            .iter()
+            .map(|&ts| UnixNanos::from(ts))
+            .collect();
+        let ts_init = ts_init_values
+            .values()
+            .iter()
+            .map(|&ts| UnixNanos::from(ts))
+            .collect();
+
+        Ok(DeltaBatch {
+            instrument_id,
+            price_precision,
+            size_precision,
+            action,
+            side,
+            price: price_values.values().to_vec(),
+            size: size_values.values().to_vec(),
+            order_id: order_id_values.values().to_vec(),
+            flags: flags_values.values().to_vec(),
+            sequence: sequence_values.values().to_vec(),
+            ts_event,
+            ts_init,
+        })
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // Tests
 ////////////////////////////////////////////////////////////////////////////////
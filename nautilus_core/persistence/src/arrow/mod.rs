@@ -33,7 +33,7 @@ use datafusion::arrow::{
     ipc::writer::StreamWriter,
     record_batch::RecordBatch,
 };
-use nautilus_model::data::Data;
+use nautilus_model::data::{batch::DataBatch, Data};
 use pyo3::prelude::*;
 
 // Define metadata key constants constants
@@ -112,6 +112,20 @@ where
     ) -> Result<Vec<Data>, EncodingError>;
 }
 
+pub trait DecodeColumnsFromRecordBatch
+where
+    Self: Sized + ArrowSchemaProvider,
+{
+    type Batch: Into<DataBatch>;
+
+    /// Decodes the record batch directly into a columnar batch, without building a value
+    /// per row.
+    fn decode_columns(
+        metadata: &HashMap<String, String>,
+        record_batch: RecordBatch,
+    ) -> Result<Self::Batch, EncodingError>;
+}
+
 pub trait WriteStream {
     fn write(&mut self, record_batch: &RecordBatch) -> Result<(), DataStreamingError>;
 }
@@ -21,15 +21,16 @@ use datafusion::arrow::{
     error::ArrowError,
     record_batch::RecordBatch,
 };
+use nautilus_core::nanos::UnixNanos;
 use nautilus_model::{
-    data::quote::QuoteTick,
+    data::{batch::QuoteTickBatch, quote::QuoteTick},
     identifiers::InstrumentId,
     types::{price::Price, quantity::Quantity},
 };
 
 use super::{
-    extract_column, DecodeDataFromRecordBatch, EncodingError, KEY_INSTRUMENT_ID,
-    KEY_PRICE_PRECISION, KEY_SIZE_PRECISION,
+    extract_column, DecodeColumnsFromRecordBatch, DecodeDataFromRecordBatch, EncodingError,
+    KEY_INSTRUMENT_ID, KEY_PRICE_PRECISION, KEY_SIZE_PRECISION,
 };
 use crate::arrow::{ArrowSchemaProvider, Data, DecodeFromRecordBatch, EncodeToRecordBatch};
 
@@ -167,6 +168,48 @@ impl DecodeDataFromRecordBatch for QuoteTick {
     }
 }
 
+impl DecodeColumnsFromRecordBatch for QuoteTick {
+    type Batch = QuoteTickBatch;
+
+    fn decode_columns(
+        metadata: &HashMap<String, String>,
+        record_batch: RecordBatch,
+    ) -> Result<Self::Batch, EncodingError> {
+        let (instrument_id, price_precision, size_precision) = parse_metadata(metadata)?;
+        let cols = record_batch.columns();
+
+        let bid_price_values = extract_column::<Int64Array>(cols, "bid_price", 0, DataType::Int64)?;
+        let ask_price_values = extract_column::<Int64Array>(cols, "ask_price", 1, DataType::Int64)?;
+        let bid_size_values = extract_column::<UInt64Array>(cols, "bid_size", 2, DataType::UInt64)?;
+        let ask_size_values = extract_column::<UInt64Array>(cols, "ask_size", 3, DataType::UInt64)?;
+        let ts_event_values = extract_column::<UInt64Array>(cols, "ts_event", 4, DataType::UInt64)?;
+        let ts_init_values = extract_column::<UInt64Array>(cols, "ts_init", 5, DataType::UInt64)?;
+
+        let ts_event = ts_event_values
+            .values()
+            .iter()
+            .map(|&ts| UnixNanos::from(ts))
+            .collect();
+        let ts_init = ts_init_values
+            .values()
+            .iter()
+            .map(|&ts| UnixNanos::from(ts))
+            .collect();
+
+        Ok(QuoteTickBatch {
+            instrument_id,
+            price_precision,
+            size_precision,
+            bid_price: bid_price_values.values().to_vec(),
+            ask_price: ask_price_values.values().to_vec(),
+            bid_size: bid_size_values.values().to_vec(),
+            ask_size: ask_size_values.values().to_vec(),
+            ts_event,
+            ts_init,
+        })
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // Tests
 ////////////////////////////////////////////////////////////////////////////////
@@ -292,7 +335,12 @@ mod tests {
         )
         .unwrap();
 
-        let decoded_data = QuoteTick::decode_batch(&metadata, record_batch).unwrap();
+        let decoded_data = QuoteTick::decode_batch(&metadata, record_batch.clone()).unwrap();
         assert_eq!(decoded_data.len(), 2);
+
+        let columns = QuoteTick::decode_columns(&metadata, record_batch).unwrap();
+        assert_eq!(columns.len(), 2);
+        assert_eq!(columns.get(0), decoded_data[0]);
+        assert_eq!(columns.get(1), decoded_data[1]);
     }
 }
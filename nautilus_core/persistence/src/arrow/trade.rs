@@ -21,16 +21,17 @@ use datafusion::arrow::{
     error::ArrowError,
     record_batch::RecordBatch,
 };
+use nautilus_core::nanos::UnixNanos;
 use nautilus_model::{
-    data::trade::TradeTick,
+    data::{batch::TradeTickBatch, trade::TradeTick},
     enums::AggressorSide,
     identifiers::{InstrumentId, TradeId},
     types::{price::Price, quantity::Quantity},
 };
 
 use super::{
-    extract_column, DecodeDataFromRecordBatch, EncodingError, KEY_INSTRUMENT_ID,
-    KEY_PRICE_PRECISION, KEY_SIZE_PRECISION,
+    extract_column, DecodeColumnsFromRecordBatch, DecodeDataFromRecordBatch, EncodingError,
+    KEY_INSTRUMENT_ID, KEY_PRICE_PRECISION, KEY_SIZE_PRECISION,
 };
 use crate::arrow::{ArrowSchemaProvider, Data, DecodeFromRecordBatch, EncodeToRecordBatch};
 
@@ -176,6 +177,64 @@ impl DecodeDataFromRecordBatch for TradeTick {
     }
 }
 
+impl DecodeColumnsFromRecordBatch for TradeTick {
+    type Batch = TradeTickBatch;
+
+    fn decode_columns(
+        metadata: &HashMap<String, String>,
+        record_batch: RecordBatch,
+    ) -> Result<Self::Batch, EncodingError> {
+        let (instrument_id, price_precision, size_precision) = parse_metadata(metadata)?;
+        let cols = record_batch.columns();
+
+        let price_values = extract_column::<Int64Array>(cols, "price", 0, DataType::Int64)?;
+        let size_values = extract_column::<UInt64Array>(cols, "size", 1, DataType::UInt64)?;
+        let aggressor_side_values =
+            extract_column::<UInt8Array>(cols, "aggressor_side", 2, DataType::UInt8)?;
+        let trade_id_values = extract_column::<StringArray>(cols, "trade_id", 3, DataType::Utf8)?;
+        let ts_event_values = extract_column::<UInt64Array>(cols, "ts_event", 4, DataType::UInt64)?;
+        let ts_init_values = extract_column::<UInt64Array>(cols, "ts_init", 5, DataType::UInt64)?;
+
+        let aggressor_side = aggressor_side_values
+            .values()
+            .iter()
+            .map(|&value| {
+                AggressorSide::from_repr(value as usize).ok_or_else(|| {
+                    EncodingError::ParseError(
+                        stringify!(AggressorSide),
+                        format!("Invalid enum value, was {value}"),
+                    )
+                })
+            })
+            .collect::<Result<Vec<_>, _>>()?;
+        let trade_id = (0..record_batch.num_rows())
+            .map(|i| TradeId::from(trade_id_values.value(i)))
+            .collect();
+        let ts_event = ts_event_values
+            .values()
+            .iter()
+            .map(|&ts| UnixNanos::from(ts))
+            .collect();
+        let ts_init = ts_init_values
+            .values()
+            .iter()
+            .map(|&ts| UnixNanos::from(ts))
+            .collect();
+
+        Ok(TradeTickBatch {
+            instrument_id,
+            price_precision,
+            size_precision,
+            price: price_values.values().to_vec(),
+            size: size_values.values().to_vec(),
+            aggressor_side,
+            trade_id,
+            ts_event,
+            ts_init,
+        })
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // Tests
 ////////////////////////////////////////////////////////////////////////////////
@@ -66,12 +66,12 @@ from nautilus_trader.core.datetime cimport maybe_dt_to_unix_nanos
 from nautilus_trader.core.datetime cimport unix_nanos_to_dt
 from nautilus_trader.core.rust.backtest cimport TimeEventAccumulatorAPI
 from nautilus_trader.core.rust.backtest cimport time_event_accumulator_advance_clock
-from nautilus_trader.core.rust.backtest cimport time_event_accumulator_drain
+from nautilus_trader.core.rust.backtest cimport time_event_accumulator_drain_view
 from nautilus_trader.core.rust.backtest cimport time_event_accumulator_drop
 from nautilus_trader.core.rust.backtest cimport time_event_accumulator_new
+from nautilus_trader.core.rust.backtest cimport time_event_accumulator_release
 from nautilus_trader.core.rust.common cimport TimeEventHandler_t
 from nautilus_trader.core.rust.common cimport logging_is_colored
-from nautilus_trader.core.rust.common cimport vec_time_event_handlers_drop
 from nautilus_trader.core.rust.core cimport CVec
 from nautilus_trader.core.rust.model cimport AccountType
 from nautilus_trader.core.rust.model cimport AggregationSource
@@ -1158,8 +1158,8 @@ cdef class BacktestEngine:
                         only_now=True,
                     )
 
-                    # Drop processed event handlers
-                    vec_time_event_handlers_drop(raw_handlers)
+                    # Release processed event handlers (buffers are reused)
+                    time_event_accumulator_release(&self._accumulator)
                     raw_handlers_count = 0
 
                 self._iteration += 1
@@ -1182,7 +1182,7 @@ cdef class BacktestEngine:
                 last_ns,
                 only_now=True,
             )
-            vec_time_event_handlers_drop(raw_handlers)
+            time_event_accumulator_release(&self._accumulator)
 
     cdef Data _next(self):
         cdef uint64_t cursor = self._index
@@ -1202,7 +1202,7 @@ cdef class BacktestEngine:
                 False,
             )
 
-        cdef CVec raw_handlers = time_event_accumulator_drain(&self._accumulator)
+        cdef CVec raw_handlers = time_event_accumulator_drain_view(&self._accumulator)
 
         # Handle all events prior to the `ts_now`
         self._process_raw_time_event_handlers(
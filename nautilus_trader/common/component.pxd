@@ -93,8 +93,10 @@ cdef class TestClock(Clock):
     cdef TestClock_API _mem
 
     cpdef void set_time(self, uint64_t to_time_ns)
+    cpdef uint64_t next_event_time_ns(self)
     cdef CVec advance_time_c(self, uint64_t to_time_ns, bint set_time=*)
     cpdef list advance_time(self, uint64_t to_time_ns, bint set_time=*)
+    cpdef uint64_t advance_time_and_dispatch(self, uint64_t to_time_ns, bint set_time=*)
 
 
 cdef class LiveClock(Clock):
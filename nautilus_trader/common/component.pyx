@@ -42,6 +42,7 @@ from cpython.object cimport PyCallable_Check
 from cpython.object cimport PyObject
 from cpython.pycapsule cimport PyCapsule_GetPointer
 from libc.stdint cimport int64_t
+from libc.stdint cimport uint32_t
 from libc.stdint cimport uint64_t
 from libc.stdio cimport printf
 
@@ -52,6 +53,7 @@ from nautilus_trader.core.datetime cimport maybe_dt_to_unix_nanos
 from nautilus_trader.core.fsm cimport FiniteStateMachine
 from nautilus_trader.core.fsm cimport InvalidStateTrigger
 from nautilus_trader.core.message cimport Event
+from nautilus_trader.core.rust.common cimport TIMER_ID_NONE
 from nautilus_trader.core.rust.common cimport ComponentState
 from nautilus_trader.core.rust.common cimport ComponentTrigger
 from nautilus_trader.core.rust.common cimport LogColor
@@ -95,6 +97,7 @@ from nautilus_trader.core.rust.common cimport test_clock_cancel_timer
 from nautilus_trader.core.rust.common cimport test_clock_cancel_timers
 from nautilus_trader.core.rust.common cimport test_clock_drop
 from nautilus_trader.core.rust.common cimport test_clock_new
+from nautilus_trader.core.rust.common cimport test_clock_next_event_time
 from nautilus_trader.core.rust.common cimport test_clock_next_time
 from nautilus_trader.core.rust.common cimport test_clock_register_default_handler
 from nautilus_trader.core.rust.common cimport test_clock_set_time
@@ -106,8 +109,10 @@ from nautilus_trader.core.rust.common cimport test_clock_timestamp
 from nautilus_trader.core.rust.common cimport test_clock_timestamp_ms
 from nautilus_trader.core.rust.common cimport test_clock_timestamp_ns
 from nautilus_trader.core.rust.common cimport test_clock_timestamp_us
+from nautilus_trader.core.rust.common cimport time_event_name
 from nautilus_trader.core.rust.common cimport time_event_new
 from nautilus_trader.core.rust.common cimport time_event_to_cstr
+from nautilus_trader.core.rust.common cimport timer_id_from_cstr
 from nautilus_trader.core.rust.common cimport vec_time_event_handlers_drop
 from nautilus_trader.core.rust.core cimport CVec
 from nautilus_trader.core.rust.core cimport nanos_to_millis
@@ -117,7 +122,6 @@ from nautilus_trader.core.rust.core cimport uuid4_from_cstr
 from nautilus_trader.core.string cimport cstr_to_pystr
 from nautilus_trader.core.string cimport pybytes_to_cstr
 from nautilus_trader.core.string cimport pystr_to_cstr
-from nautilus_trader.core.string cimport ustr_to_pystr
 from nautilus_trader.core.uuid cimport UUID4
 from nautilus_trader.model.identifiers cimport ComponentId
 from nautilus_trader.model.identifiers cimport Identifier
@@ -644,6 +648,18 @@ cdef class TestClock(Clock):
         Condition.valid_string(name, "name")
         return test_clock_next_time(&self._mem, pystr_to_cstr(name))
 
+    cpdef uint64_t next_event_time_ns(self):
+        """
+        Return the earliest next time of all active timers.
+
+        Returns
+        -------
+        uint64_t
+            The UNIX timestamp (nanoseconds), or 0 if there are no active timers.
+
+        """
+        return test_clock_next_event_time(&self._mem)
+
     cpdef void cancel_timer(self, str name):
         Condition.valid_string(name, "name")
         Condition.is_in(name, self.timer_names, "name", "self.timer_names")
@@ -718,6 +734,62 @@ cdef class TestClock(Clock):
 
         return event_handlers
 
+    cpdef uint64_t advance_time_and_dispatch(self, uint64_t to_time_ns, bint set_time=True):
+        """
+        Advance the clocks time to the given `to_time_ns` and call the handler
+        for every time event triggered, in chronological order.
+
+        Unlike `advance_time`, no `TimeEventHandler` objects or list are created,
+        the callbacks are called directly from the handlers returned by Rust.
+
+        If a callback raises, the remaining events are still dispatched and the
+        first exception is then re-raised.
+
+        Parameters
+        ----------
+        to_time_ns : uint64_t
+            The UNIX timestamp (nanoseconds) to advance the clock to.
+        set_time : bool
+            If the clock should also be set to the given `to_time_ns`.
+
+        Returns
+        -------
+        uint64_t
+            The number of time events dispatched.
+
+        Raises
+        ------
+        ValueError
+            If `to_time_ns` is < the clocks current time.
+        Exception
+            The first exception raised by a callback (once all events are dispatched).
+
+        """
+        cdef CVec raw_handler_vec = self.advance_time_c(to_time_ns, set_time)
+        cdef TimeEventHandler_t* raw_handlers = <TimeEventHandler_t*>raw_handler_vec.ptr
+        cdef uint64_t count = raw_handler_vec.len
+
+        cdef:
+            uint64_t i
+            object callback
+            object error = None
+        try:
+            for i in range(count):
+                # Cast raw `PyObject *` to a `PyObject`
+                callback = <object><PyObject *>raw_handlers[i].callback_ptr
+                try:
+                    callback(TimeEvent.from_mem_c(raw_handlers[i].event))
+                except Exception as e:
+                    if error is None:
+                        error = e
+        finally:
+            vec_time_event_handlers_drop(raw_handler_vec)
+
+        if error is not None:
+            raise error
+
+        return count
+
 
 cdef class LiveClock(Clock):
     """
@@ -833,6 +905,53 @@ def create_pyo3_conversion_wrapper(callback) -> Callable:
     return wrapper
 
 
+# Recurring timer names as Python strings indexed by timer ID, so each distinct name is only
+# converted from its interned C string once rather than on every event (one-shot timers such
+# as time alerts have no ID, which keeps this bounded by the number of recurring timers)
+cdef list _TIMER_NAMES = []
+
+
+cdef inline str _timer_name_to_pystr(TimeEvent_t* mem):
+    cdef uint32_t timer_id = mem.timer_id
+    cdef str name
+    if timer_id == TIMER_ID_NONE:
+        return cstr_to_pystr(time_event_name(mem), False)
+    if timer_id < len(_TIMER_NAMES):
+        name = _TIMER_NAMES[timer_id]
+        if name is not None:
+            return name
+    else:
+        _TIMER_NAMES.extend([None] * (timer_id + 1 - len(_TIMER_NAMES)))
+
+    name = cstr_to_pystr(time_event_name(mem), False)
+    _TIMER_NAMES[timer_id] = name
+    return name
+
+
+def timer_id_for_name(str name not None) -> int | None:
+    """
+    Return the numeric timer ID assigned to the given time event name.
+
+    Only events from recurring timers carry a timer ID, so this can be compared
+    with the `timer_id` of those events. Looking up a name never assigns an ID.
+
+    Parameters
+    ----------
+    name : str
+        The time event (timer) name.
+
+    Returns
+    -------
+    int or ``None``
+        ``None`` if no recurring timer has been set with the name.
+
+    """
+    cdef uint32_t timer_id = timer_id_from_cstr(pystr_to_cstr(name))
+    if timer_id == TIMER_ID_NONE:
+        return None
+    return timer_id
+
+
 cdef class TimeEvent(Event):
     """
     Represents a time event occurring at the event timestamp.
@@ -881,7 +1000,7 @@ cdef class TimeEvent(Event):
         )
 
     cdef str to_str(self):
-        return ustr_to_pystr(self._mem.name)
+        return _timer_name_to_pystr(&self._mem)
 
     def __eq__(self, TimeEvent other) -> bool:
         return self.id == other.id
@@ -905,7 +1024,23 @@ cdef class TimeEvent(Event):
         str
 
         """
-        return ustr_to_pystr(self._mem.name)
+        return _timer_name_to_pystr(&self._mem)
+
+    @property
+    def timer_id(self) -> int | None:
+        """
+        Return the numeric ID of the time event name (if from a recurring timer).
+
+        Each distinct name maps to the same ID for the life of the process.
+
+        Returns
+        -------
+        int or ``None``
+
+        """
+        if self._mem.timer_id == TIMER_ID_NONE:
+            return None
+        return self._mem.timer_id
 
     @property
     def id(self) -> UUID4:
@@ -1025,7 +1160,7 @@ cpdef LogColor log_color_from_str(str value):
 
 
 cpdef str log_color_to_str(LogColor value):
-    return cstr_to_pystr(log_color_to_cstr(value))
+    return cstr_to_pystr(log_color_to_cstr(value), False)
 
 
 cpdef LogLevel log_level_from_str(str value):
@@ -1033,7 +1168,7 @@ cpdef LogLevel log_level_from_str(str value):
 
 
 cpdef str log_level_to_str(LogLevel value):
-    return cstr_to_pystr(log_level_to_cstr(value))
+    return cstr_to_pystr(log_level_to_cstr(value), False)
 
 
 cdef class LogGuard:
@@ -1381,7 +1516,7 @@ cpdef ComponentState component_state_from_str(str value):
 
 
 cpdef str component_state_to_str(ComponentState value):
-    return cstr_to_pystr(component_state_to_cstr(value))
+    return cstr_to_pystr(component_state_to_cstr(value), False)
 
 
 cpdef ComponentTrigger component_trigger_from_str(str value):
@@ -1389,7 +1524,7 @@ cpdef ComponentTrigger component_trigger_from_str(str value):
 
 
 cpdef str component_trigger_to_str(ComponentTrigger value):
-    return cstr_to_pystr(component_trigger_to_cstr(value))
+    return cstr_to_pystr(component_trigger_to_cstr(value), False)
 
 
 cdef dict[tuple[ComponentState, ComponentTrigger], ComponentState] _COMPONENT_STATE_TABLE = {
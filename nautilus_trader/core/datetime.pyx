@@ -38,6 +38,9 @@ from cpython.unicode cimport PyUnicode_Contains
 from libc.stdint cimport uint64_t
 
 from nautilus_trader.core.correctness cimport Condition
+from nautilus_trader.core.rust.core cimport unix_nanos_to_iso8601_cstr_buf
+from nautilus_trader.core.string cimport CSTR_BUF_LEN
+from nautilus_trader.core.string cimport cstr_buf_to_pystr
 
 
 # UNIX epoch is the UTC time at 00:00:00 on 1/1/1970
@@ -105,6 +108,27 @@ cpdef str unix_nanos_to_str(uint64_t unix_nanos):
     return format_iso8601(unix_nanos_to_dt(unix_nanos))
 
 
+cpdef str unix_nanos_to_iso8601(uint64_t unix_nanos):
+    """
+    Convert the given `unix_nanos` to a nanosecond accurate ISO 8601 formatted string.
+
+    The string is formatted natively without creating an intermediate datetime.
+
+    Parameters
+    ----------
+    unix_nanos : int
+        The UNIX timestamp (nanoseconds) to be converted.
+
+    Returns
+    -------
+    str
+
+    """
+    cdef char buf[CSTR_BUF_LEN]
+    cdef size_t length = unix_nanos_to_iso8601_cstr_buf(unix_nanos, buf, CSTR_BUF_LEN)
+    return cstr_buf_to_pystr(buf, length)
+
+
 cpdef maybe_unix_nanos_to_dt(nanos):
     """
     Return the datetime (UTC) from the given UNIX timestamp (nanoseconds), or ``None``.
@@ -7,6 +7,10 @@
 
 /**
  * Provides a means of accumulating and draining time event handlers.
+ *
+ * Each clock advanced into the accumulator appends a run of handlers already sorted by
+ * `ts_event`, so draining k-way merges the runs rather than sorting. All buffers are kept
+ * and reused across iterations.
  */
 typedef struct TimeEventAccumulator TimeEventAccumulator;
 
@@ -24,3 +28,18 @@ void time_event_accumulator_advance_clock(struct TimeEventAccumulatorAPI *accumu
                                           uint8_t set_time);
 
 CVec time_event_accumulator_drain(struct TimeEventAccumulatorAPI *accumulator);
+
+/**
+ * Drains the accumulated time event handlers in sorted order into a buffer owned (and
+ * reused) by the accumulator, returning a borrowed view of it.
+ *
+ * The view is valid until `time_event_accumulator_release` is called or a clock is next
+ * advanced into the accumulator. Its `cap` is zero as it does not own the buffer, so it must
+ * not be passed to `vec_time_event_handlers_drop`.
+ */
+CVec time_event_accumulator_drain_view(struct TimeEventAccumulatorAPI *accumulator);
+
+/**
+ * Releases the handlers of the last drained view, keeping the buffers for reuse.
+ */
+void time_event_accumulator_release(struct TimeEventAccumulatorAPI *accumulator);
@@ -5,6 +5,11 @@
 #include <stdint.h>
 #include <Python.h>
 
+/**
+ * The timer ID of events which are not from a recurring timer, which is never assigned.
+ */
+#define TIMER_ID_NONE UINT32_MAX
+
 /**
  * The state of a component within the system.
  */
@@ -267,6 +272,11 @@ typedef struct TimeEvent_t {
      * The event name, identifying the nature or purpose of the event.
      */
     char* name;
+    /**
+     * The numeric ID of the event name for recurring timers (see [`timer_id`]), otherwise
+     * [`TIMER_ID_NONE`].
+     */
+    uint32_t timer_id;
     /**
      * The unique identifier for the event.
      */
@@ -400,6 +410,11 @@ void vec_time_event_handlers_drop(CVec v);
  */
 uint64_t test_clock_next_time(struct TestClock_API *clock, const char *name_ptr);
 
+/**
+ * Returns the earliest next time of all active timers, or 0 if there are none.
+ */
+uint64_t test_clock_next_event_time(struct TestClock_API *clock);
+
 /**
  * # Safety
  *
@@ -484,6 +499,9 @@ void live_clock_cancel_timer(struct LiveClock_API *clock, const char *name_ptr);
 
 void live_clock_cancel_timers(struct LiveClock_API *clock);
 
+/**
+ * Returns the enum name as a C string pointer to static storage (must not be freed).
+ */
 const char *component_state_to_cstr(enum ComponentState value);
 
 /**
@@ -495,6 +513,19 @@ const char *component_state_to_cstr(enum ComponentState value);
  */
 enum ComponentState component_state_from_cstr(const char *ptr);
 
+/**
+ * Parses the array of C strings `ptrs` of length `len` into `out` as [`ComponentState`] codes.
+ *
+ * # Safety
+ *
+ * - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+ * - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+ */
+void component_state_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
+/**
+ * Returns the enum name as a C string pointer to static storage (must not be freed).
+ */
 const char *component_trigger_to_cstr(enum ComponentTrigger value);
 
 /**
@@ -506,6 +537,19 @@ const char *component_trigger_to_cstr(enum ComponentTrigger value);
  */
 enum ComponentTrigger component_trigger_from_cstr(const char *ptr);
 
+/**
+ * Parses the array of C strings `ptrs` of length `len` into `out` as [`ComponentTrigger`] codes.
+ *
+ * # Safety
+ *
+ * - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+ * - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+ */
+void component_trigger_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
+/**
+ * Returns the enum name as a C string pointer to static storage (must not be freed).
+ */
 const char *log_level_to_cstr(enum LogLevel value);
 
 /**
@@ -517,6 +561,19 @@ const char *log_level_to_cstr(enum LogLevel value);
  */
 enum LogLevel log_level_from_cstr(const char *ptr);
 
+/**
+ * Parses the array of C strings `ptrs` of length `len` into `out` as [`LogLevel`] codes.
+ *
+ * # Safety
+ *
+ * - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+ * - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+ */
+void log_level_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
+/**
+ * Returns the enum name as a C string pointer to static storage (must not be freed).
+ */
 const char *log_color_to_cstr(enum LogColor value);
 
 /**
@@ -528,6 +585,16 @@ const char *log_color_to_cstr(enum LogColor value);
  */
 enum LogColor log_color_from_cstr(const char *ptr);
 
+/**
+ * Parses the array of C strings `ptrs` of length `len` into `out` as [`LogColor`] codes.
+ *
+ * # Safety
+ *
+ * - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+ * - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+ */
+void log_color_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
 /**
  * Initializes logging.
  *
@@ -608,6 +675,24 @@ struct TimeEvent_t time_event_new(const char *name_ptr,
                                   uint64_t ts_event,
                                   uint64_t ts_init);
 
+/**
+ * Returns the name of a [`TimeEvent`] as a C string pointer.
+ *
+ * The pointer refers to the interned name, so is valid for the life of the process and must not
+ * be freed.
+ */
+const char *time_event_name(const struct TimeEvent_t *event);
+
+/**
+ * Returns the numeric timer ID assigned to the given name, or `TIMER_ID_NONE` if no
+ * recurring timer has been registered with it (see [`registered_timer_id`]).
+ *
+ * # Safety
+ *
+ * - Assumes `name_ptr` is borrowed from a valid Python UTF-8 `str`.
+ */
+uint32_t timer_id_from_cstr(const char *name_ptr);
+
 /**
  * Returns a [`TimeEvent`] as a C string pointer.
  */
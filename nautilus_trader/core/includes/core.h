@@ -55,9 +55,9 @@ typedef struct CVec {
  */
 typedef struct UUID4_t {
     /**
-     * The UUID v4 value as a fixed-length C string byte array (includes null terminator).
+     * The UUID v4 value as a 16 byte array in RFC 4122 (big-endian) order.
      */
-    uint8_t value[37];
+    uint8_t value[16];
 } UUID4_t;
 
 /**
@@ -104,6 +104,17 @@ struct CVec cvec_new(void);
  */
 const char *unix_nanos_to_iso8601_cstr(uint64_t timestamp_ns);
 
+/**
+ * Writes a UNIX nanoseconds timestamp as an ISO 8601 formatted nul-terminated C string into
+ * the caller provided buffer `buf` of capacity `len`, returning the full string length (the
+ * output was truncated if not less than `len`).
+ *
+ * # Safety
+ *
+ * - Assumes `buf` is a valid pointer to a writable array of length `len`.
+ */
+uintptr_t unix_nanos_to_iso8601_cstr_buf(uint64_t timestamp_ns, char *buf, uintptr_t len);
+
 /**
  * Return the decimal precision inferred from the given C string.
  *
@@ -162,8 +173,31 @@ struct UUID4_t uuid4_new(void);
  */
 struct UUID4_t uuid4_from_cstr(const char *ptr);
 
+/**
+ * Fills the array `out` of length `len` with newly generated [`UUID4`]s.
+ *
+ * # Safety
+ *
+ * - Assumes `out` is a valid pointer to an array of `UUID4` of length `len`.
+ */
+void uuid4_fill(struct UUID4_t *out, uintptr_t len);
+
+/**
+ * Returns a [`UUID4`] as a C string pointer.
+ */
 const char *uuid4_to_cstr(const struct UUID4_t *uuid);
 
+/**
+ * Writes a [`UUID4`] as a nul-terminated C string into the caller provided buffer `buf` of
+ * capacity `len`, returning the full string length (the output was truncated if not less
+ * than `len`).
+ *
+ * # Safety
+ *
+ * - Assumes `buf` is a valid pointer to a writable array of length `len`.
+ */
+uintptr_t uuid4_to_cstr_buf(const struct UUID4_t *uuid, char *buf, uintptr_t len);
+
 uint8_t uuid4_eq(const struct UUID4_t *lhs, const struct UUID4_t *rhs);
 
 uint64_t uuid4_hash(const struct UUID4_t *uuid);
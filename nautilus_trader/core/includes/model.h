@@ -12,6 +12,23 @@
  */
 #define TRADE_ID_LEN 37
 
+/**
+ * The current order book snapshot format version.
+ */
+#define BOOK_SNAPSHOT_VERSION 1
+
+/**
+ * The default number of tick slots held in the array window of a [`TickLadder`].
+ */
+#define TICK_LADDER_DEFAULT_CAPACITY 1024
+
+/**
+ * The number of batches which may be queued for each worker before
+ * [`BookManager::apply`] blocks, so that a stalled worker applies backpressure rather
+ * than growing memory without limit.
+ */
+#define BOOK_MANAGER_QUEUE_CAPACITY 1024
+
 /**
  * The maximum fixed-point precision.
  */
@@ -789,6 +806,39 @@ typedef enum TriggerType {
     INDEX_PRICE = 9,
 } TriggerType;
 
+/**
+ * Represents a batch of bars for one bar type held as columns.
+ */
+typedef struct BarBatch BarBatch;
+
+/**
+ * Provides a merge of many columnar batches in ascending order of `ts_init`.
+ *
+ * Each batch must itself be ordered by `ts_init`. Rows with equal `ts_init` are
+ * yielded in the order their batches were pushed. Only one cursor per batch is held,
+ * so no row is copied out of its batch until it is read.
+ */
+typedef struct BatchMerge BatchMerge;
+
+/**
+ * Provides a manager for many order books, which applies their data in parallel.
+ *
+ * Each instrument is assigned to one of a fixed pool of worker threads by the hash of
+ * its ID, and every worker applies the data for its instruments in the order received.
+ * Updates for the same instrument are therefore never reordered, while updates for
+ * instruments on different workers proceed concurrently.
+ *
+ * Each worker owns its books outright, so applying data takes no lock. Readers see the
+ * top of book through the seqlock handle each book publishes, which never waits on a
+ * worker, or take a full [`BookManager::snapshot`] ordered after the data sent so far.
+ */
+typedef struct BookManager BookManager;
+
+/**
+ * Represents a batch of order book deltas for one instrument held as columns.
+ */
+typedef struct DeltaBatch DeltaBatch;
+
 /**
  * Represents a discrete price level in an order book.
  *
@@ -814,12 +864,30 @@ typedef struct OrderBook OrderBook;
  */
 typedef struct OrderBookDeltas_t OrderBookDeltas_t;
 
+/**
+ * Represents a batch of quote ticks for one instrument held as columns.
+ */
+typedef struct QuoteTickBatch QuoteTickBatch;
+
 /**
  * Represents a synthetic instrument with prices derived from component instruments using a
  * formula.
  */
 typedef struct SyntheticInstrument SyntheticInstrument;
 
+/**
+ * Provides a handle to the top of book published by an [`OrderBook`].
+ *
+ * The handle can be cloned and sent to any thread, which then reads the latest record
+ * without locking or messaging the thread which owns the book.
+ */
+typedef struct TopOfBookHandle TopOfBookHandle;
+
+/**
+ * Represents a batch of trade ticks for one instrument held as columns.
+ */
+typedef struct TradeTickBatch TradeTickBatch;
+
 /**
  * Represents a valid ticker symbol ID for a tradable instrument.
  */
@@ -963,6 +1031,9 @@ typedef struct OrderBookDelta_t {
  * It implements the `Deref` trait, allowing instances of `OrderBookDeltas_API` to be
  * dereferenced to `OrderBookDeltas`, providing access to `OrderBookDeltas`'s methods without
  * having to manually access the underlying `OrderBookDeltas` instance.
+ *
+ * The underlying `OrderBookDeltas` is reference counted and shared between clones, so cloning
+ * is O(1). Mutable access copies the deltas first if they are shared (copy-on-write).
  */
 typedef struct OrderBookDeltas_API {
     struct OrderBookDeltas_t *_0;
@@ -1435,6 +1506,177 @@ typedef struct Level_API {
     struct Level *_0;
 } Level_API;
 
+/**
+ * Represents the best bid and ask of an order book at a point in its event sequence.
+ *
+ * A side with no levels has a zero price and size.
+ */
+typedef struct TopOfBook_t {
+    /**
+     * The best bid price.
+     */
+    struct Price_t bid_price;
+    /**
+     * The size at the best bid price.
+     */
+    struct Quantity_t bid_size;
+    /**
+     * The best ask price.
+     */
+    struct Price_t ask_price;
+    /**
+     * The size at the best ask price.
+     */
+    struct Quantity_t ask_size;
+    /**
+     * The last event sequence number for the order book.
+     */
+    uint64_t sequence;
+    /**
+     * The timestamp of the last event applied to the order book.
+     */
+    uint64_t ts_last;
+} TopOfBook_t;
+
+/**
+ * Represents a snapshot of the global string interner statistics.
+ *
+ * The `entries` and byte counts describe the shared cache, while the remaining counters
+ * accumulate from process start (or the last [`reset_interner_stats`]).
+ */
+typedef struct InternerStats_t {
+    /**
+     * The number of distinct strings held by the cache.
+     */
+    uintptr_t entries;
+    /**
+     * The total bytes allocated by the cache.
+     */
+    uintptr_t allocated_bytes;
+    /**
+     * The total bytes of capacity reserved by the cache.
+     */
+    uintptr_t capacity_bytes;
+    /**
+     * The number of single string lookups made through [`intern`].
+     */
+    uint64_t lookups;
+    /**
+     * The number of calls to [`intern_bulk`].
+     */
+    uint64_t bulk_calls;
+    /**
+     * The number of strings passed to [`intern_bulk`] (including duplicates).
+     */
+    uint64_t bulk_strings;
+    /**
+     * The number of strings newly added to the cache by [`intern_bulk`].
+     */
+    uint64_t bulk_inserts;
+    /**
+     * The total wall time spent in [`intern_bulk`] (nanoseconds).
+     */
+    uint64_t bulk_nanos;
+} InternerStats_t;
+
+/**
+ * C compatible Foreign Function Interface (FFI) for an underlying `BookManager`.
+ *
+ * This struct wraps `BookManager` in a way that makes it compatible with C function
+ * calls, enabling interaction with `BookManager` in a C environment.
+ *
+ * It implements the `Deref` trait, allowing instances of `BookManager_API` to be
+ * dereferenced to `BookManager`, providing access to `BookManager`'s methods without
+ * having to manually access the underlying `BookManager` instance.
+ */
+typedef struct BookManager_API {
+    struct BookManager *_0;
+} BookManager_API;
+
+/**
+ * C compatible Foreign Function Interface (FFI) for an underlying `TopOfBookHandle`.
+ *
+ * This struct wraps `TopOfBookHandle` in a way that makes it compatible with C function
+ * calls, enabling interaction with `TopOfBookHandle` in a C environment.
+ *
+ * It implements the `Deref` trait, allowing instances of `TopOfBookHandle_API` to be
+ * dereferenced to `TopOfBookHandle`, providing access to `TopOfBookHandle`'s methods without
+ * having to manually access the underlying `TopOfBookHandle` instance.
+ */
+typedef struct TopOfBookHandle_API {
+    struct TopOfBookHandle *_0;
+} TopOfBookHandle_API;
+
+/**
+ * C compatible Foreign Function Interface (FFI) for an underlying `QuoteTickBatch`.
+ *
+ * This struct wraps `QuoteTickBatch` in a way that makes it compatible with C function
+ * calls, enabling interaction with `QuoteTickBatch` in a C environment.
+ *
+ * It implements the `Deref` trait, allowing instances of `QuoteTickBatch_API` to be
+ * dereferenced to `QuoteTickBatch`, providing access to `QuoteTickBatch`'s methods without
+ * having to manually access the underlying `QuoteTickBatch` instance.
+ */
+typedef struct QuoteTickBatch_API {
+    struct QuoteTickBatch *_0;
+} QuoteTickBatch_API;
+
+/**
+ * C compatible Foreign Function Interface (FFI) for an underlying `TradeTickBatch`.
+ *
+ * This struct wraps `TradeTickBatch` in a way that makes it compatible with C function
+ * calls, enabling interaction with `TradeTickBatch` in a C environment.
+ *
+ * It implements the `Deref` trait, allowing instances of `TradeTickBatch_API` to be
+ * dereferenced to `TradeTickBatch`, providing access to `TradeTickBatch`'s methods without
+ * having to manually access the underlying `TradeTickBatch` instance.
+ */
+typedef struct TradeTickBatch_API {
+    struct TradeTickBatch *_0;
+} TradeTickBatch_API;
+
+/**
+ * C compatible Foreign Function Interface (FFI) for an underlying `BarBatch`.
+ *
+ * This struct wraps `BarBatch` in a way that makes it compatible with C function
+ * calls, enabling interaction with `BarBatch` in a C environment.
+ *
+ * It implements the `Deref` trait, allowing instances of `BarBatch_API` to be
+ * dereferenced to `BarBatch`, providing access to `BarBatch`'s methods without
+ * having to manually access the underlying `BarBatch` instance.
+ */
+typedef struct BarBatch_API {
+    struct BarBatch *_0;
+} BarBatch_API;
+
+/**
+ * C compatible Foreign Function Interface (FFI) for an underlying `DeltaBatch`.
+ *
+ * This struct wraps `DeltaBatch` in a way that makes it compatible with C function
+ * calls, enabling interaction with `DeltaBatch` in a C environment.
+ *
+ * It implements the `Deref` trait, allowing instances of `DeltaBatch_API` to be
+ * dereferenced to `DeltaBatch`, providing access to `DeltaBatch`'s methods without
+ * having to manually access the underlying `DeltaBatch` instance.
+ */
+typedef struct DeltaBatch_API {
+    struct DeltaBatch *_0;
+} DeltaBatch_API;
+
+/**
+ * C compatible Foreign Function Interface (FFI) for an underlying `BatchMerge`.
+ *
+ * This struct wraps `BatchMerge` in a way that makes it compatible with C function
+ * calls, enabling interaction with `BatchMerge` in a C environment.
+ *
+ * It implements the `Deref` trait, allowing instances of `BatchMerge_API` to be
+ * dereferenced to `BatchMerge`, providing access to `BatchMerge`'s methods without
+ * having to manually access the underlying `BatchMerge` instance.
+ */
+typedef struct BatchMerge_API {
+    struct BatchMerge *_0;
+} BatchMerge_API;
+
 /**
  * Represents a medium of exchange in a specified denomination with a fixed decimal precision.
  *
@@ -1610,6 +1852,17 @@ uint64_t bar_hash(const struct Bar_t *bar);
  */
 const char *bar_to_cstr(const struct Bar_t *bar);
 
+/**
+ * Writes a [`Bar`] as a nul-terminated C string into the caller provided buffer `buf` of
+ * capacity `len`, returning the full string length (the output was truncated if not less
+ * than `len`).
+ *
+ * # Safety
+ *
+ * - Assumes `buf` is a valid pointer to a writable array of length `len`.
+ */
+uintptr_t bar_to_cstr_buf(const struct Bar_t *bar, char *buf, uintptr_t len);
+
 struct OrderBookDelta_t orderbook_delta_new(struct InstrumentId_t instrument_id,
                                             enum BookAction action,
                                             struct BookOrder_t order,
@@ -1728,6 +1981,17 @@ uint64_t quote_tick_hash(const struct QuoteTick_t *delta);
  */
 const char *quote_tick_to_cstr(const struct QuoteTick_t *quote);
 
+/**
+ * Writes a [`QuoteTick`] as a nul-terminated C string into the caller provided buffer `buf` of
+ * capacity `len`, returning the full string length (the output was truncated if not less
+ * than `len`).
+ *
+ * # Safety
+ *
+ * - Assumes `buf` is a valid pointer to a writable array of length `len`.
+ */
+uintptr_t quote_tick_to_cstr_buf(const struct QuoteTick_t *quote, char *buf, uintptr_t len);
+
 struct TradeTick_t trade_tick_new(struct InstrumentId_t instrument_id,
                                   int64_t price_raw,
                                   uint8_t price_prec,
@@ -1747,6 +2011,20 @@ uint64_t trade_tick_hash(const struct TradeTick_t *delta);
  */
 const char *trade_tick_to_cstr(const struct TradeTick_t *trade);
 
+/**
+ * Writes a [`TradeTick`] as a nul-terminated C string into the caller provided buffer `buf` of
+ * capacity `len`, returning the full string length (the output was truncated if not less
+ * than `len`).
+ *
+ * # Safety
+ *
+ * - Assumes `buf` is a valid pointer to a writable array of length `len`.
+ */
+uintptr_t trade_tick_to_cstr_buf(const struct TradeTick_t *trade, char *buf, uintptr_t len);
+
+/**
+ * Returns the enum name as a C string pointer to static storage (must not be freed).
+ */
 const char *account_type_to_cstr(enum AccountType value);
 
 /**
@@ -1758,6 +2036,19 @@ const char *account_type_to_cstr(enum AccountType value);
  */
 enum AccountType account_type_from_cstr(const char *ptr);
 
+/**
+ * Parses the array of C strings `ptrs` of length `len` into `out` as [`AccountType`] codes.
+ *
+ * # Safety
+ *
+ * - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+ * - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+ */
+void account_type_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
+/**
+ * Returns the enum name as a C string pointer to static storage (must not be freed).
+ */
 const char *aggregation_source_to_cstr(enum AggregationSource value);
 
 /**
@@ -1769,6 +2060,19 @@ const char *aggregation_source_to_cstr(enum AggregationSource value);
  */
 enum AggregationSource aggregation_source_from_cstr(const char *ptr);
 
+/**
+ * Parses the array of C strings `ptrs` of length `len` into `out` as [`AggregationSource`] codes.
+ *
+ * # Safety
+ *
+ * - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+ * - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+ */
+void aggregation_source_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
+/**
+ * Returns the enum name as a C string pointer to static storage (must not be freed).
+ */
 const char *aggressor_side_to_cstr(enum AggressorSide value);
 
 /**
@@ -1780,6 +2084,19 @@ const char *aggressor_side_to_cstr(enum AggressorSide value);
  */
 enum AggressorSide aggressor_side_from_cstr(const char *ptr);
 
+/**
+ * Parses the array of C strings `ptrs` of length `len` into `out` as [`AggressorSide`] codes.
+ *
+ * # Safety
+ *
+ * - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+ * - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+ */
+void aggressor_side_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
+/**
+ * Returns the enum name as a C string pointer to static storage (must not be freed).
+ */
 const char *asset_class_to_cstr(enum AssetClass value);
 
 /**
@@ -1791,6 +2108,19 @@ const char *asset_class_to_cstr(enum AssetClass value);
  */
 enum AssetClass asset_class_from_cstr(const char *ptr);
 
+/**
+ * Parses the array of C strings `ptrs` of length `len` into `out` as [`AssetClass`] codes.
+ *
+ * # Safety
+ *
+ * - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+ * - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+ */
+void asset_class_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
+/**
+ * Returns the enum name as a C string pointer to static storage (must not be freed).
+ */
 const char *instrument_class_to_cstr(enum InstrumentClass value);
 
 /**
@@ -1802,6 +2132,19 @@ const char *instrument_class_to_cstr(enum InstrumentClass value);
  */
 enum InstrumentClass instrument_class_from_cstr(const char *ptr);
 
+/**
+ * Parses the array of C strings `ptrs` of length `len` into `out` as [`InstrumentClass`] codes.
+ *
+ * # Safety
+ *
+ * - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+ * - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+ */
+void instrument_class_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
+/**
+ * Returns the enum name as a C string pointer to static storage (must not be freed).
+ */
 const char *bar_aggregation_to_cstr(uint8_t value);
 
 /**
@@ -1813,6 +2156,19 @@ const char *bar_aggregation_to_cstr(uint8_t value);
  */
 uint8_t bar_aggregation_from_cstr(const char *ptr);
 
+/**
+ * Parses the array of C strings `ptrs` of length `len` into `out` as [`BarAggregation`] codes.
+ *
+ * # Safety
+ *
+ * - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+ * - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+ */
+void bar_aggregation_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
+/**
+ * Returns the enum name as a C string pointer to static storage (must not be freed).
+ */
 const char *book_action_to_cstr(enum BookAction value);
 
 /**
@@ -1824,6 +2180,19 @@ const char *book_action_to_cstr(enum BookAction value);
  */
 enum BookAction book_action_from_cstr(const char *ptr);
 
+/**
+ * Parses the array of C strings `ptrs` of length `len` into `out` as [`BookAction`] codes.
+ *
+ * # Safety
+ *
+ * - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+ * - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+ */
+void book_action_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
+/**
+ * Returns the enum name as a C string pointer to static storage (must not be freed).
+ */
 const char *book_type_to_cstr(enum BookType value);
 
 /**
@@ -1835,6 +2204,19 @@ const char *book_type_to_cstr(enum BookType value);
  */
 enum BookType book_type_from_cstr(const char *ptr);
 
+/**
+ * Parses the array of C strings `ptrs` of length `len` into `out` as [`BookType`] codes.
+ *
+ * # Safety
+ *
+ * - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+ * - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+ */
+void book_type_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
+/**
+ * Returns the enum name as a C string pointer to static storage (must not be freed).
+ */
 const char *contingency_type_to_cstr(enum ContingencyType value);
 
 /**
@@ -1846,6 +2228,19 @@ const char *contingency_type_to_cstr(enum ContingencyType value);
  */
 enum ContingencyType contingency_type_from_cstr(const char *ptr);
 
+/**
+ * Parses the array of C strings `ptrs` of length `len` into `out` as [`ContingencyType`] codes.
+ *
+ * # Safety
+ *
+ * - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+ * - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+ */
+void contingency_type_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
+/**
+ * Returns the enum name as a C string pointer to static storage (must not be freed).
+ */
 const char *currency_type_to_cstr(enum CurrencyType value);
 
 /**
@@ -1857,6 +2252,16 @@ const char *currency_type_to_cstr(enum CurrencyType value);
  */
 enum CurrencyType currency_type_from_cstr(const char *ptr);
 
+/**
+ * Parses the array of C strings `ptrs` of length `len` into `out` as [`CurrencyType`] codes.
+ *
+ * # Safety
+ *
+ * - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+ * - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+ */
+void currency_type_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
 /**
  * Returns an enum from a Python string.
  *
@@ -1866,8 +2271,24 @@ enum CurrencyType currency_type_from_cstr(const char *ptr);
  */
 enum InstrumentCloseType instrument_close_type_from_cstr(const char *ptr);
 
+/**
+ * Parses the array of C strings `ptrs` of length `len` into `out` as [`InstrumentCloseType`] codes.
+ *
+ * # Safety
+ *
+ * - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+ * - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+ */
+void instrument_close_type_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
+/**
+ * Returns the enum name as a C string pointer to static storage (must not be freed).
+ */
 const char *instrument_close_type_to_cstr(enum InstrumentCloseType value);
 
+/**
+ * Returns the enum name as a C string pointer to static storage (must not be freed).
+ */
 const char *liquidity_side_to_cstr(enum LiquiditySide value);
 
 /**
@@ -1879,6 +2300,19 @@ const char *liquidity_side_to_cstr(enum LiquiditySide value);
  */
 enum LiquiditySide liquidity_side_from_cstr(const char *ptr);
 
+/**
+ * Parses the array of C strings `ptrs` of length `len` into `out` as [`LiquiditySide`] codes.
+ *
+ * # Safety
+ *
+ * - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+ * - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+ */
+void liquidity_side_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
+/**
+ * Returns the enum name as a C string pointer to static storage (must not be freed).
+ */
 const char *market_status_to_cstr(enum MarketStatus value);
 
 /**
@@ -1890,6 +2324,19 @@ const char *market_status_to_cstr(enum MarketStatus value);
  */
 enum MarketStatus market_status_from_cstr(const char *ptr);
 
+/**
+ * Parses the array of C strings `ptrs` of length `len` into `out` as [`MarketStatus`] codes.
+ *
+ * # Safety
+ *
+ * - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+ * - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+ */
+void market_status_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
+/**
+ * Returns the enum name as a C string pointer to static storage (must not be freed).
+ */
 const char *market_status_action_to_cstr(enum MarketStatusAction value);
 
 /**
@@ -1901,18 +2348,20 @@ const char *market_status_action_to_cstr(enum MarketStatusAction value);
  */
 enum MarketStatusAction market_status_action_from_cstr(const char *ptr);
 
-const char *oms_type_to_cstr(enum OmsType value);
-
 /**
- * Returns an enum from a Python string.
+ * Parses the array of C strings `ptrs` of length `len` into `out` as [`MarketStatusAction`] codes.
  *
  * # Safety
  *
- * - Assumes `ptr` is a valid C string pointer.
+ * - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+ * - Assumes `out` is a valid pointer to a `u8` array of length `len`.
  */
-enum OmsType oms_type_from_cstr(const char *ptr);
+void market_status_action_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
 
-const char *option_kind_to_cstr(enum OptionKind value);
+/**
+ * Returns the enum name as a C string pointer to static storage (must not be freed).
+ */
+const char *oms_type_to_cstr(enum OmsType value);
 
 /**
  * Returns an enum from a Python string.
@@ -1921,20 +2370,22 @@ const char *option_kind_to_cstr(enum OptionKind value);
  *
  * - Assumes `ptr` is a valid C string pointer.
  */
-enum OptionKind option_kind_from_cstr(const char *ptr);
-
-const char *order_side_to_cstr(enum OrderSide value);
+enum OmsType oms_type_from_cstr(const char *ptr);
 
 /**
- * Returns an enum from a Python string.
+ * Parses the array of C strings `ptrs` of length `len` into `out` as [`OmsType`] codes.
  *
  * # Safety
  *
- * - Assumes `ptr` is a valid C string pointer.
+ * - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+ * - Assumes `out` is a valid pointer to a `u8` array of length `len`.
  */
-enum OrderSide order_side_from_cstr(const char *ptr);
+void oms_type_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
 
-const char *order_status_to_cstr(enum OrderStatus value);
+/**
+ * Returns the enum name as a C string pointer to static storage (must not be freed).
+ */
+const char *option_kind_to_cstr(enum OptionKind value);
 
 /**
  * Returns an enum from a Python string.
@@ -1943,8 +2394,69 @@ const char *order_status_to_cstr(enum OrderStatus value);
  *
  * - Assumes `ptr` is a valid C string pointer.
  */
-enum OrderStatus order_status_from_cstr(const char *ptr);
+enum OptionKind option_kind_from_cstr(const char *ptr);
+
+/**
+ * Parses the array of C strings `ptrs` of length `len` into `out` as [`OptionKind`] codes.
+ *
+ * # Safety
+ *
+ * - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+ * - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+ */
+void option_kind_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
+/**
+ * Returns the enum name as a C string pointer to static storage (must not be freed).
+ */
+const char *order_side_to_cstr(enum OrderSide value);
+
+/**
+ * Returns an enum from a Python string.
+ *
+ * # Safety
+ *
+ * - Assumes `ptr` is a valid C string pointer.
+ */
+enum OrderSide order_side_from_cstr(const char *ptr);
+
+/**
+ * Parses the array of C strings `ptrs` of length `len` into `out` as [`OrderSide`] codes.
+ *
+ * # Safety
+ *
+ * - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+ * - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+ */
+void order_side_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
 
+/**
+ * Returns the enum name as a C string pointer to static storage (must not be freed).
+ */
+const char *order_status_to_cstr(enum OrderStatus value);
+
+/**
+ * Returns an enum from a Python string.
+ *
+ * # Safety
+ *
+ * - Assumes `ptr` is a valid C string pointer.
+ */
+enum OrderStatus order_status_from_cstr(const char *ptr);
+
+/**
+ * Parses the array of C strings `ptrs` of length `len` into `out` as [`OrderStatus`] codes.
+ *
+ * # Safety
+ *
+ * - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+ * - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+ */
+void order_status_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
+/**
+ * Returns the enum name as a C string pointer to static storage (must not be freed).
+ */
 const char *order_type_to_cstr(enum OrderType value);
 
 /**
@@ -1956,6 +2468,19 @@ const char *order_type_to_cstr(enum OrderType value);
  */
 enum OrderType order_type_from_cstr(const char *ptr);
 
+/**
+ * Parses the array of C strings `ptrs` of length `len` into `out` as [`OrderType`] codes.
+ *
+ * # Safety
+ *
+ * - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+ * - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+ */
+void order_type_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
+/**
+ * Returns the enum name as a C string pointer to static storage (must not be freed).
+ */
 const char *position_side_to_cstr(enum PositionSide value);
 
 /**
@@ -1967,6 +2492,19 @@ const char *position_side_to_cstr(enum PositionSide value);
  */
 enum PositionSide position_side_from_cstr(const char *ptr);
 
+/**
+ * Parses the array of C strings `ptrs` of length `len` into `out` as [`PositionSide`] codes.
+ *
+ * # Safety
+ *
+ * - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+ * - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+ */
+void position_side_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
+/**
+ * Returns the enum name as a C string pointer to static storage (must not be freed).
+ */
 const char *price_type_to_cstr(enum PriceType value);
 
 /**
@@ -1978,6 +2516,19 @@ const char *price_type_to_cstr(enum PriceType value);
  */
 enum PriceType price_type_from_cstr(const char *ptr);
 
+/**
+ * Parses the array of C strings `ptrs` of length `len` into `out` as [`PriceType`] codes.
+ *
+ * # Safety
+ *
+ * - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+ * - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+ */
+void price_type_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
+/**
+ * Returns the enum name as a C string pointer to static storage (must not be freed).
+ */
 const char *record_flag_to_cstr(enum RecordFlag value);
 
 /**
@@ -1989,6 +2540,19 @@ const char *record_flag_to_cstr(enum RecordFlag value);
  */
 enum RecordFlag record_flag_from_cstr(const char *ptr);
 
+/**
+ * Parses the array of C strings `ptrs` of length `len` into `out` as [`RecordFlag`] codes.
+ *
+ * # Safety
+ *
+ * - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+ * - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+ */
+void record_flag_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
+/**
+ * Returns the enum name as a C string pointer to static storage (must not be freed).
+ */
 const char *time_in_force_to_cstr(enum TimeInForce value);
 
 /**
@@ -2000,6 +2564,19 @@ const char *time_in_force_to_cstr(enum TimeInForce value);
  */
 enum TimeInForce time_in_force_from_cstr(const char *ptr);
 
+/**
+ * Parses the array of C strings `ptrs` of length `len` into `out` as [`TimeInForce`] codes.
+ *
+ * # Safety
+ *
+ * - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+ * - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+ */
+void time_in_force_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
+/**
+ * Returns the enum name as a C string pointer to static storage (must not be freed).
+ */
 const char *trading_state_to_cstr(enum TradingState value);
 
 /**
@@ -2011,6 +2588,19 @@ const char *trading_state_to_cstr(enum TradingState value);
  */
 enum TradingState trading_state_from_cstr(const char *ptr);
 
+/**
+ * Parses the array of C strings `ptrs` of length `len` into `out` as [`TradingState`] codes.
+ *
+ * # Safety
+ *
+ * - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+ * - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+ */
+void trading_state_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
+/**
+ * Returns the enum name as a C string pointer to static storage (must not be freed).
+ */
 const char *trailing_offset_type_to_cstr(enum TrailingOffsetType value);
 
 /**
@@ -2022,6 +2612,19 @@ const char *trailing_offset_type_to_cstr(enum TrailingOffsetType value);
  */
 enum TrailingOffsetType trailing_offset_type_from_cstr(const char *ptr);
 
+/**
+ * Parses the array of C strings `ptrs` of length `len` into `out` as [`TrailingOffsetType`] codes.
+ *
+ * # Safety
+ *
+ * - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+ * - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+ */
+void trailing_offset_type_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
+/**
+ * Returns the enum name as a C string pointer to static storage (must not be freed).
+ */
 const char *trigger_type_to_cstr(enum TriggerType value);
 
 /**
@@ -2033,6 +2636,16 @@ const char *trigger_type_to_cstr(enum TriggerType value);
  */
 enum TriggerType trigger_type_from_cstr(const char *ptr);
 
+/**
+ * Parses the array of C strings `ptrs` of length `len` into `out` as [`TriggerType`] codes.
+ *
+ * # Safety
+ *
+ * - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+ * - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+ */
+void trigger_type_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
 /**
  * # Safety
  *
@@ -2180,10 +2793,43 @@ struct InstrumentId_t instrument_id_from_cstr(const char *ptr);
  */
 const char *instrument_id_to_cstr(const struct InstrumentId_t *instrument_id);
 
+/**
+ * Writes an [`InstrumentId`] as a nul-terminated C string into the caller provided buffer
+ * `buf` of capacity `len`, returning the full string length (the output was truncated if not
+ * less than `len`).
+ *
+ * # Safety
+ *
+ * - Assumes `buf` is a valid pointer to a writable array of length `len`.
+ */
+uintptr_t instrument_id_to_cstr_buf(const struct InstrumentId_t *instrument_id,
+                                    char *buf,
+                                    uintptr_t len);
+
 uint64_t instrument_id_hash(const struct InstrumentId_t *instrument_id);
 
 uint8_t instrument_id_is_synthetic(const struct InstrumentId_t *instrument_id);
 
+/**
+ * Returns a snapshot of the global string interner statistics.
+ */
+struct InternerStats_t interner_stats_get(void);
+
+/**
+ * Resets the global string interner counters to zero.
+ */
+void interner_stats_reset(void);
+
+/**
+ * Interns each C string in the array `ptrs` of length `len` in turn, returning the number of
+ * strings newly added to the cache.
+ *
+ * # Safety
+ *
+ * - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+ */
+uintptr_t interner_preload(const char *const *ptrs, uintptr_t len);
+
 /**
  * Returns a Nautilus identifier from a C string pointer.
  *
@@ -2243,8 +2889,13 @@ const char *symbol_topic(const struct Symbol_t *id);
  */
 struct TradeId_t trade_id_new(const char *ptr);
 
+uint8_t trade_id_eq(const struct TradeId_t *lhs, const struct TradeId_t *rhs);
+
 uint64_t trade_id_hash(const struct TradeId_t *id);
 
+/**
+ * Returns a [`TradeId`] as a C string pointer borrowed from `trade_id` (must not be freed).
+ */
 const char *trade_id_to_cstr(const struct TradeId_t *trade_id);
 
 /**
@@ -2348,10 +2999,98 @@ struct Price_t synthetic_instrument_calculate(struct SyntheticInstrument_API *sy
 
 struct OrderBook_API orderbook_new(struct InstrumentId_t instrument_id, enum BookType book_type);
 
+struct OrderBook_API orderbook_new_tick_indexed(struct InstrumentId_t instrument_id,
+                                                enum BookType book_type,
+                                                struct Price_t price_increment,
+                                                uintptr_t capacity);
+
+/**
+ * Returns a binary snapshot of the order book as a `CVec` of bytes.
+ *
+ * The returned `CVec` must be freed with `cvec_drop`.
+ */
+CVec orderbook_snapshot_to_bytes(const struct OrderBook_API *book);
+
+/**
+ * Restores an order book from a binary snapshot, writing it to `book`.
+ *
+ * Returns 1 on success, or 0 if the bytes are not a valid order book snapshot, in
+ * which case nothing is written.
+ *
+ * # Safety
+ *
+ * - Assumes `data` is a valid pointer to an array of bytes of length `len`.
+ * - Assumes `book` is a valid pointer which the restored book may be written to
+ *   without dropping its contents.
+ */
+uint8_t orderbook_restore_from_bytes(const uint8_t *data,
+                                     uintptr_t len,
+                                     struct OrderBook_API *book);
+
+/**
+ * Restores many order books from binary snapshots in parallel, writing them to `books`.
+ *
+ * Returns 1 on success, or 0 if any of the snapshots is not a valid order book
+ * snapshot, in which case all restored books are dropped and nothing is written.
+ *
+ * # Safety
+ *
+ * - Assumes `data` and `lens` are valid pointers to arrays of length `count`, where
+ *   each `data[i]` is a valid pointer to an array of bytes of length `lens[i]`.
+ * - Assumes `books` is a valid pointer to an array of length `count` which the
+ *   restored books may be written to without dropping its contents.
+ */
+uint8_t orderbook_restore_many_from_bytes(const uint8_t *const *data,
+                                          const uintptr_t *lens,
+                                          uintptr_t count,
+                                          struct OrderBook_API *books);
+
+struct OrderBook_API orderbook_new_depth10(struct InstrumentId_t instrument_id);
+
+/**
+ * Returns whether the book holds its levels in tick-indexed ladders.
+ */
+uint8_t orderbook_is_tick_indexed(const struct OrderBook_API *book);
+
+/**
+ * Returns the price increment of the tick-indexed ladders, or a zero price with zero
+ * precision if the book is not tick-indexed.
+ */
+struct Price_t orderbook_price_increment(const struct OrderBook_API *book);
+
+/**
+ * Returns whether the book is in fixed depth mode, loading depth snapshots into fixed
+ * MBP-10 arrays.
+ */
+uint8_t orderbook_is_fixed_depth(const struct OrderBook_API *book);
+
 void orderbook_drop(struct OrderBook_API book);
 
 void orderbook_reset(struct OrderBook_API *book);
 
+void orderbook_enable_cumulative_depth(struct OrderBook_API *book);
+
+uint8_t orderbook_has_cumulative_depth(const struct OrderBook_API *book);
+
+void orderbook_enable_sequencing(struct OrderBook_API *book, uintptr_t capacity);
+
+uint8_t orderbook_is_stale(const struct OrderBook_API *book);
+
+/**
+ * Returns the number of sequence gaps detected, or zero if sequencing is not enabled.
+ */
+uint64_t orderbook_sequence_gaps(const struct OrderBook_API *book);
+
+/**
+ * Returns the number of duplicate or late deltas dropped, or zero if sequencing is not enabled.
+ */
+uint64_t orderbook_sequence_dropped(const struct OrderBook_API *book);
+
+/**
+ * Returns the number of deltas held for reordering, or zero if sequencing is not enabled.
+ */
+uintptr_t orderbook_sequence_pending(const struct OrderBook_API *book);
+
 struct InstrumentId_t orderbook_instrument_id(const struct OrderBook_API *book);
 
 enum BookType orderbook_book_type(const struct OrderBook_API *book);
@@ -2390,12 +3129,51 @@ void orderbook_apply_delta(struct OrderBook_API *book, const struct OrderBookDel
 
 void orderbook_apply_deltas(struct OrderBook_API *book, const struct OrderBookDeltas_API *deltas);
 
+/**
+ * Applies a contiguous array of deltas to the order book, borrowed in place.
+ *
+ * # Safety
+ *
+ * - Assumes `deltas` is a valid pointer to an array of `OrderBookDelta` of length `len`.
+ */
+void orderbook_apply_deltas_raw(struct OrderBook_API *book,
+                                const struct OrderBookDelta_t *deltas,
+                                uintptr_t len);
+
 void orderbook_apply_depth(struct OrderBook_API *book, const struct OrderBookDepth10_t *depth);
 
 CVec orderbook_bids(struct OrderBook_API *book);
 
 CVec orderbook_asks(struct OrderBook_API *book);
 
+/**
+ * Writes up to `len` of the top bid levels into the caller provided column buffers,
+ * returning the number of levels written.
+ *
+ * # Safety
+ *
+ * - Assumes `prices`, `sizes` and `counts` are valid pointers to arrays of length `len`.
+ */
+uintptr_t orderbook_bids_depth(const struct OrderBook_API *book,
+                               int64_t *prices,
+                               uint64_t *sizes,
+                               uint32_t *counts,
+                               uintptr_t len);
+
+/**
+ * Writes up to `len` of the top ask levels into the caller provided column buffers,
+ * returning the number of levels written.
+ *
+ * # Safety
+ *
+ * - Assumes `prices`, `sizes` and `counts` are valid pointers to arrays of length `len`.
+ */
+uintptr_t orderbook_asks_depth(const struct OrderBook_API *book,
+                               int64_t *prices,
+                               uint64_t *sizes,
+                               uint32_t *counts,
+                               uintptr_t len);
+
 uint8_t orderbook_has_bid(struct OrderBook_API *book);
 
 uint8_t orderbook_has_ask(struct OrderBook_API *book);
@@ -2408,6 +3186,8 @@ struct Quantity_t orderbook_best_bid_size(struct OrderBook_API *book);
 
 struct Quantity_t orderbook_best_ask_size(struct OrderBook_API *book);
 
+struct TopOfBook_t orderbook_top_of_book(const struct OrderBook_API *book);
+
 double orderbook_spread(struct OrderBook_API *book);
 
 double orderbook_midpoint(struct OrderBook_API *book);
@@ -2469,6 +3249,207 @@ void vec_levels_drop(CVec v);
 
 void vec_orders_drop(CVec v);
 
+/**
+ * Creates a new book manager with `num_workers` worker threads, each pinned to a CPU
+ * core if `pin_workers` is non-zero (Linux only).
+ */
+struct BookManager_API book_manager_new(uintptr_t num_workers,
+                                        enum BookType book_type,
+                                        uint8_t pin_workers);
+
+/**
+ * Stops the worker threads of the manager and drops its books.
+ */
+void book_manager_drop(struct BookManager_API manager);
+
+/**
+ * Adds a copy of the given book to the manager, replacing any book for the same
+ * instrument.
+ *
+ * Returns 1 on success, or 0 if the worker owning the instrument has stopped.
+ */
+uint8_t book_manager_add_book(const struct BookManager_API *manager,
+                              const struct OrderBook_API *book);
+
+/**
+ * Routes a batch of interleaved data to the workers of the manager.
+ *
+ * Ownership of every element is moved into the manager, so the caller must not use or
+ * drop the elements of the array afterwards (the array itself remains owned by the
+ * caller). Returns 1 on success, or 0 if a worker has stopped.
+ *
+ * # Safety
+ *
+ * - Assumes `data` is a valid pointer to an array of `Data` of length `len`.
+ */
+uint8_t book_manager_apply(const struct BookManager_API *manager,
+                           struct Data_t *data,
+                           uintptr_t len);
+
+/**
+ * Blocks until all data passed to the manager so far has been applied.
+ *
+ * Returns 1 on success, or 0 if a worker has stopped.
+ */
+uint8_t book_manager_flush(const struct BookManager_API *manager);
+
+uint8_t book_manager_has_book(const struct BookManager_API *manager,
+                              struct InstrumentId_t instrument_id);
+
+struct TopOfBook_t book_manager_top_of_book(const struct BookManager_API *manager,
+                                            struct InstrumentId_t instrument_id);
+
+/**
+ * Writes a copy of the book for the given instrument to `book`, taken after all data
+ * passed to the manager so far has been applied.
+ *
+ * Returns 1 if a book was written, or 0 if no book exists for the instrument or its
+ * worker has stopped.
+ *
+ * # Safety
+ *
+ * - Assumes `book` is a valid pointer which the book may be written to without dropping
+ *   its contents.
+ */
+uint8_t book_manager_snapshot(const struct BookManager_API *manager,
+                              struct InstrumentId_t instrument_id,
+                              struct OrderBook_API *book);
+
+uintptr_t book_manager_count(const struct BookManager_API *manager);
+
+/**
+ * Returns a handle to the top of book published by `book`, starting publishing if needed.
+ *
+ * The handle may be read from any thread, and remains valid after the book is dropped.
+ */
+struct TopOfBookHandle_API orderbook_top_of_book_handle(struct OrderBook_API *book);
+
+struct TopOfBookHandle_API top_of_book_handle_clone(const struct TopOfBookHandle_API *handle);
+
+void top_of_book_handle_drop(struct TopOfBookHandle_API handle);
+
+struct TopOfBook_t top_of_book_handle_read(const struct TopOfBookHandle_API *handle);
+
+struct QuoteTickBatch_API quote_tick_batch_new(struct InstrumentId_t instrument_id,
+                                               uint8_t price_precision,
+                                               uint8_t size_precision);
+
+void quote_tick_batch_drop(struct QuoteTickBatch_API batch);
+
+void quote_tick_batch_push(struct QuoteTickBatch_API *batch, const struct QuoteTick_t *quote);
+
+uintptr_t quote_tick_batch_len(const struct QuoteTickBatch_API *batch);
+
+/**
+ * Returns the row of the batch at the given `index`.
+ *
+ * # Panics
+ *
+ * This function panics:
+ * - If `index` is out of bounds.
+ */
+struct QuoteTick_t quote_tick_batch_get(const struct QuoteTickBatch_API *batch, uintptr_t index);
+
+struct TradeTickBatch_API trade_tick_batch_new(struct InstrumentId_t instrument_id,
+                                               uint8_t price_precision,
+                                               uint8_t size_precision);
+
+void trade_tick_batch_drop(struct TradeTickBatch_API batch);
+
+void trade_tick_batch_push(struct TradeTickBatch_API *batch, const struct TradeTick_t *trade);
+
+uintptr_t trade_tick_batch_len(const struct TradeTickBatch_API *batch);
+
+/**
+ * Returns the row of the batch at the given `index`.
+ *
+ * # Panics
+ *
+ * This function panics:
+ * - If `index` is out of bounds.
+ */
+struct TradeTick_t trade_tick_batch_get(const struct TradeTickBatch_API *batch, uintptr_t index);
+
+struct BarBatch_API bar_batch_new(struct BarType_t bar_type,
+                                  uint8_t price_precision,
+                                  uint8_t size_precision);
+
+void bar_batch_drop(struct BarBatch_API batch);
+
+void bar_batch_push(struct BarBatch_API *batch, const struct Bar_t *bar);
+
+uintptr_t bar_batch_len(const struct BarBatch_API *batch);
+
+/**
+ * Returns the row of the batch at the given `index`.
+ *
+ * # Panics
+ *
+ * This function panics:
+ * - If `index` is out of bounds.
+ */
+struct Bar_t bar_batch_get(const struct BarBatch_API *batch, uintptr_t index);
+
+struct DeltaBatch_API delta_batch_new(struct InstrumentId_t instrument_id,
+                                      uint8_t price_precision,
+                                      uint8_t size_precision);
+
+void delta_batch_drop(struct DeltaBatch_API batch);
+
+void delta_batch_push(struct DeltaBatch_API *batch, const struct OrderBookDelta_t *delta);
+
+uintptr_t delta_batch_len(const struct DeltaBatch_API *batch);
+
+/**
+ * Returns the row of the batch at the given `index`.
+ *
+ * # Panics
+ *
+ * This function panics:
+ * - If `index` is out of bounds.
+ */
+struct OrderBookDelta_t delta_batch_get(const struct DeltaBatch_API *batch, uintptr_t index);
+
+struct BatchMerge_API batch_merge_new(void);
+
+void batch_merge_drop(struct BatchMerge_API merge);
+
+/**
+ * Adds the batch to the merge, taking ownership of it.
+ */
+void batch_merge_push_quote_tick_batch(struct BatchMerge_API *merge,
+                                       struct QuoteTickBatch_API batch);
+
+/**
+ * Adds the batch to the merge, taking ownership of it.
+ */
+void batch_merge_push_trade_tick_batch(struct BatchMerge_API *merge,
+                                       struct TradeTickBatch_API batch);
+
+/**
+ * Adds the batch to the merge, taking ownership of it.
+ */
+void batch_merge_push_bar_batch(struct BatchMerge_API *merge, struct BarBatch_API batch);
+
+/**
+ * Adds the batch to the merge, taking ownership of it.
+ */
+void batch_merge_push_delta_batch(struct BatchMerge_API *merge, struct DeltaBatch_API batch);
+
+uintptr_t batch_merge_remaining(const struct BatchMerge_API *merge);
+
+uint8_t batch_merge_is_exhausted(const struct BatchMerge_API *merge);
+
+/**
+ * Returns the next row of the merge in order of `ts_init`.
+ *
+ * # Panics
+ *
+ * This function panics:
+ * - If the merge is exhausted.
+ */
+struct Data_t batch_merge_next(struct BatchMerge_API *merge);
+
 /**
  * Returns a [`Currency`] from pointers and primitives.
  *
@@ -2527,6 +3508,98 @@ void price_add_assign(struct Price_t a, struct Price_t b);
 
 void price_sub_assign(struct Price_t a, struct Price_t b);
 
+/**
+ * Converts `len` values to raw `Price` values with the given `precision`.
+ *
+ * # Safety
+ *
+ * - Assumes `values` and `out` are valid pointers to arrays of length `len`.
+ */
+void price_raw_from_f64_array(const double *values, uint8_t precision, int64_t *out, uintptr_t len);
+
+/**
+ * Converts `len` raw `Price` values to `f64` values.
+ *
+ * # Safety
+ *
+ * - Assumes `raws` and `out` are valid pointers to arrays of length `len`.
+ */
+void price_raw_to_f64_array(const int64_t *raws, double *out, uintptr_t len);
+
+/**
+ * Rounds `len` raw `Price` values in place to the given `precision`.
+ *
+ * # Safety
+ *
+ * - Assumes `raws` is a valid pointer to an array of length `len`.
+ */
+void price_raw_rescale_array(int64_t *raws, uintptr_t len, uint8_t precision);
+
+/**
+ * Returns the minimum of `len` raw `Price` values (`i64::MAX` if `len` is zero).
+ *
+ * # Safety
+ *
+ * - Assumes `raws` is a valid pointer to an array of length `len`.
+ */
+int64_t price_raw_min(const int64_t *raws, uintptr_t len);
+
+/**
+ * Returns the maximum of `len` raw `Price` values (`i64::MIN` if `len` is zero).
+ *
+ * # Safety
+ *
+ * - Assumes `raws` is a valid pointer to an array of length `len`.
+ */
+int64_t price_raw_max(const int64_t *raws, uintptr_t len);
+
+/**
+ * Returns the sum of `len` raw `Price` values.
+ *
+ * # Safety
+ *
+ * - Assumes `raws` is a valid pointer to an array of length `len`.
+ *
+ * # Panics
+ *
+ * This function panics:
+ * - If the sum overflows `i64`.
+ */
+int64_t price_raw_sum(const int64_t *raws, uintptr_t len);
+
+/**
+ * Compares `len` raw `Price` values element-wise, writing -1, 0 or 1 to `out`.
+ *
+ * # Safety
+ *
+ * - Assumes `lhs`, `rhs` and `out` are valid pointers to arrays of length `len`.
+ */
+void price_raw_compare_arrays(const int64_t *lhs, const int64_t *rhs, int8_t *out, uintptr_t len);
+
+/**
+ * Parses the `delimiter` separated decimal values in the ASCII buffer `buf` of length `len`
+ * to raw `Price` values written to `out`.
+ *
+ * The number of values written is written to `count` and the maximum precision inferred
+ * across them to `precision`.
+ *
+ * Returns 1 on success, or 0 if any value fails to parse or there are more than `capacity`
+ * values (values before it remain written to `out`).
+ *
+ * # Safety
+ *
+ * - Assumes `buf` is a valid pointer to an array of length `len`.
+ * - Assumes `out` is a valid pointer to an array of length `capacity`.
+ * - Assumes `count` and `precision` are valid pointers.
+ */
+uint8_t price_raw_parse_delimited(const uint8_t *buf,
+                                  uintptr_t len,
+                                  uint8_t delimiter,
+                                  int64_t *out,
+                                  uintptr_t capacity,
+                                  uintptr_t *count,
+                                  uint8_t *precision);
+
 struct Quantity_t quantity_new(double value, uint8_t precision);
 
 struct Quantity_t quantity_from_raw(uint64_t raw, uint8_t precision);
@@ -2540,3 +3613,101 @@ void quantity_add_assign_u64(struct Quantity_t a, uint64_t b);
 void quantity_sub_assign(struct Quantity_t a, struct Quantity_t b);
 
 void quantity_sub_assign_u64(struct Quantity_t a, uint64_t b);
+
+/**
+ * Converts `len` values to raw `Quantity` values with the given `precision`.
+ *
+ * # Safety
+ *
+ * - Assumes `values` and `out` are valid pointers to arrays of length `len`.
+ */
+void quantity_raw_from_f64_array(const double *values,
+                                 uint8_t precision,
+                                 uint64_t *out,
+                                 uintptr_t len);
+
+/**
+ * Converts `len` raw `Quantity` values to `f64` values.
+ *
+ * # Safety
+ *
+ * - Assumes `raws` and `out` are valid pointers to arrays of length `len`.
+ */
+void quantity_raw_to_f64_array(const uint64_t *raws, double *out, uintptr_t len);
+
+/**
+ * Rounds `len` raw `Quantity` values in place to the given `precision`.
+ *
+ * # Safety
+ *
+ * - Assumes `raws` is a valid pointer to an array of length `len`.
+ */
+void quantity_raw_rescale_array(uint64_t *raws, uintptr_t len, uint8_t precision);
+
+/**
+ * Returns the minimum of `len` raw `Quantity` values (`u64::MAX` if `len` is zero).
+ *
+ * # Safety
+ *
+ * - Assumes `raws` is a valid pointer to an array of length `len`.
+ */
+uint64_t quantity_raw_min(const uint64_t *raws, uintptr_t len);
+
+/**
+ * Returns the maximum of `len` raw `Quantity` values (`u64::MIN` if `len` is zero).
+ *
+ * # Safety
+ *
+ * - Assumes `raws` is a valid pointer to an array of length `len`.
+ */
+uint64_t quantity_raw_max(const uint64_t *raws, uintptr_t len);
+
+/**
+ * Returns the sum of `len` raw `Quantity` values.
+ *
+ * # Safety
+ *
+ * - Assumes `raws` is a valid pointer to an array of length `len`.
+ *
+ * # Panics
+ *
+ * This function panics:
+ * - If the sum overflows `u64`.
+ */
+uint64_t quantity_raw_sum(const uint64_t *raws, uintptr_t len);
+
+/**
+ * Compares `len` raw `Quantity` values element-wise, writing -1, 0 or 1 to `out`.
+ *
+ * # Safety
+ *
+ * - Assumes `lhs`, `rhs` and `out` are valid pointers to arrays of length `len`.
+ */
+void quantity_raw_compare_arrays(const uint64_t *lhs,
+                                 const uint64_t *rhs,
+                                 int8_t *out,
+                                 uintptr_t len);
+
+/**
+ * Parses the `delimiter` separated decimal values in the ASCII buffer `buf` of length `len`
+ * to raw `Quantity` values written to `out`.
+ *
+ * The number of values written is written to `count` and the maximum precision inferred
+ * across them to `precision`.
+ *
+ * Returns 1 on success, or 0 if any value fails to parse or there are more than `capacity`
+ * values (values before it remain written to `out`).
+ *
+ * # Safety
+ *
+ * - Assumes `buf` is a valid pointer to an array of length `len`.
+ * - Assumes `out` is a valid pointer to an array of length `capacity`.
+ * - Assumes `count` and `precision` are valid pointers.
+ */
+uint8_t quantity_raw_parse_delimited(const uint8_t *buf,
+                                     uintptr_t len,
+                                     uint8_t delimiter,
+                                     uint64_t *out,
+                                     uintptr_t capacity,
+                                     uintptr_t *count,
+                                     uint8_t *precision);
@@ -1108,6 +1108,20 @@ class VenueOrderId:
     def from_str(cls, value: str) -> VenueOrderId: ...
     def value(self) -> str: ...
 
+class InternerStats:
+    entries: int
+    allocated_bytes: int
+    capacity_bytes: int
+    lookups: int
+    bulk_calls: int
+    bulk_strings: int
+    bulk_inserts: int
+    bulk_nanos: int
+
+def interner_stats() -> InternerStats: ...
+def interner_reset_stats() -> None: ...
+def intern_strings(values: list[str]) -> int: ...
+
 # Orders
 
 class LimitOrder:
@@ -1643,6 +1657,23 @@ class Quantity:
     def as_double(self) -> float: ...
     def to_formatted_str(self) -> str: ...
 
+def price_raw_from_f64(values: np.ndarray, precision: int, out: np.ndarray) -> None: ...
+def price_raw_to_f64(raws: np.ndarray, out: np.ndarray) -> None: ...
+def price_raw_rescale(raws: np.ndarray, precision: int) -> None: ...
+def price_raw_min(raws: np.ndarray) -> int | None: ...
+def price_raw_max(raws: np.ndarray) -> int | None: ...
+def price_raw_sum(raws: np.ndarray) -> int: ...
+def price_raw_compare(lhs: np.ndarray, rhs: np.ndarray, out: np.ndarray) -> None: ...
+def price_raw_parse_delimited(data: bytes, delimiter: int, out: np.ndarray) -> tuple[int, int]: ...
+def quantity_raw_from_f64(values: np.ndarray, precision: int, out: np.ndarray) -> None: ...
+def quantity_raw_to_f64(raws: np.ndarray, out: np.ndarray) -> None: ...
+def quantity_raw_rescale(raws: np.ndarray, precision: int) -> None: ...
+def quantity_raw_min(raws: np.ndarray) -> int | None: ...
+def quantity_raw_max(raws: np.ndarray) -> int | None: ...
+def quantity_raw_sum(raws: np.ndarray) -> int: ...
+def quantity_raw_compare(lhs: np.ndarray, rhs: np.ndarray, out: np.ndarray) -> None: ...
+def quantity_raw_parse_delimited(data: bytes, delimiter: int, out: np.ndarray) -> tuple[int, int]: ...
+
 class AccountBalance:
     def __init__(self, total: Money, locked: Money, free: Money): ...
     @classmethod
@@ -2473,6 +2504,8 @@ class OrderBook:
         self,
         instrument_id: InstrumentId,
         book_type: BookType,
+        price_increment: Price | None = None,
+        capacity: int = 1024,
     ) -> None: ...
     @property
     def instrument_id(self) -> InstrumentId: ...
@@ -2504,6 +2537,8 @@ class OrderBook:
     def best_ask_price(self) -> Price | None: ...
     def best_bid_size(self) -> Quantity | None: ...
     def best_ask_size(self) -> Quantity | None: ...
+    def top_of_book(self) -> TopOfBook: ...
+    def top_of_book_handle(self) -> TopOfBookHandle: ...
     def spread(self) -> float | None: ...
     def midpoint(self) -> float | None: ...
     def get_avg_px_for_quantity(self, qty: Quantity, order_side: OrderSide) -> float: ...
@@ -2511,6 +2546,23 @@ class OrderBook:
     def simulate_fills(self, order: BookOrder) -> list[tuple[Price, Quantity]]: ...
     def pprint(self, num_levels: int) -> str: ...
 
+class TopOfBook:
+    @property
+    def bid_price(self) -> Price: ...
+    @property
+    def bid_size(self) -> Quantity: ...
+    @property
+    def ask_price(self) -> Price: ...
+    @property
+    def ask_size(self) -> Quantity: ...
+    @property
+    def sequence(self) -> int: ...
+    @property
+    def ts_last(self) -> int: ...
+
+class TopOfBookHandle:
+    def read(self) -> TopOfBook: ...
+
 def update_book_with_quote_tick(book: OrderBook, quote: QuoteTick) -> None: ...
 def update_book_with_trade_tick(book: OrderBook, trade: TradeTick) -> None: ...
 
@@ -1,12 +1,15 @@
 # Warning, this file is autogenerated by cbindgen. Don't modify this manually. */
 
 from cpython.object cimport PyObject
-from libc.stdint cimport uint8_t, uint64_t, uintptr_t
+from libc.stdint cimport uint8_t, uint32_t, uint64_t, uintptr_t
 from nautilus_trader.core.rust.core cimport CVec, UUID4_t
 from nautilus_trader.core.rust.model cimport TraderId_t
 
 cdef extern from "../includes/common.h":
 
+    # The timer ID of events which are not from a recurring timer, which is never assigned.
+    const uint32_t TIMER_ID_NONE # = UINT32_MAX
+
     # The state of a component within the system.
     cpdef enum ComponentState:
         # When a component is instantiated, but not yet ready to fulfill its specification.
@@ -159,6 +162,9 @@ cdef extern from "../includes/common.h":
     cdef struct TimeEvent_t:
         # The event name, identifying the nature or purpose of the event.
         char* name;
+        # The numeric ID of the event name for recurring timers (see [`timer_id`]), otherwise
+        # [`TIMER_ID_NONE`].
+        uint32_t timer_id;
         # The unique identifier for the event.
         UUID4_t event_id;
         # UNIX timestamp (nanoseconds) when the event occurred.
@@ -254,6 +260,9 @@ cdef extern from "../includes/common.h":
     # - Assumes `name_ptr` is a valid C string pointer.
     uint64_t test_clock_next_time(TestClock_API *clock, const char *name_ptr);
 
+    # Returns the earliest next time of all active timers, or 0 if there are none.
+    uint64_t test_clock_next_event_time(TestClock_API *clock);
+
     # # Safety
     #
     # - Assumes `name_ptr` is a valid C string pointer.
@@ -326,6 +335,7 @@ cdef extern from "../includes/common.h":
 
     void live_clock_cancel_timers(LiveClock_API *clock);
 
+    # Returns the enum name as a C string pointer to static storage (must not be freed).
     const char *component_state_to_cstr(ComponentState value);
 
     # Returns an enum from a Python string.
@@ -335,6 +345,15 @@ cdef extern from "../includes/common.h":
     # - Assumes `ptr` is a valid C string pointer.
     ComponentState component_state_from_cstr(const char *ptr);
 
+    # Parses the array of C strings `ptrs` of length `len` into `out` as [`ComponentState`] codes.
+    #
+    # # Safety
+    #
+    # - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+    # - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+    void component_state_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
+    # Returns the enum name as a C string pointer to static storage (must not be freed).
     const char *component_trigger_to_cstr(ComponentTrigger value);
 
     # Returns an enum from a Python string.
@@ -344,6 +363,15 @@ cdef extern from "../includes/common.h":
     # - Assumes `ptr` is a valid C string pointer.
     ComponentTrigger component_trigger_from_cstr(const char *ptr);
 
+    # Parses the array of C strings `ptrs` of length `len` into `out` as [`ComponentTrigger`] codes.
+    #
+    # # Safety
+    #
+    # - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+    # - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+    void component_trigger_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
+    # Returns the enum name as a C string pointer to static storage (must not be freed).
     const char *log_level_to_cstr(LogLevel value);
 
     # Returns an enum from a Python string.
@@ -353,6 +381,15 @@ cdef extern from "../includes/common.h":
     # - Assumes `ptr` is a valid C string pointer.
     LogLevel log_level_from_cstr(const char *ptr);
 
+    # Parses the array of C strings `ptrs` of length `len` into `out` as [`LogLevel`] codes.
+    #
+    # # Safety
+    #
+    # - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+    # - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+    void log_level_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
+    # Returns the enum name as a C string pointer to static storage (must not be freed).
     const char *log_color_to_cstr(LogColor value);
 
     # Returns an enum from a Python string.
@@ -362,6 +399,14 @@ cdef extern from "../includes/common.h":
     # - Assumes `ptr` is a valid C string pointer.
     LogColor log_color_from_cstr(const char *ptr);
 
+    # Parses the array of C strings `ptrs` of length `len` into `out` as [`LogColor`] codes.
+    #
+    # # Safety
+    #
+    # - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+    # - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+    void log_color_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
     # Initializes logging.
     #
     # Logging should be used for Python and sync Rust logic which is most of
@@ -430,6 +475,20 @@ cdef extern from "../includes/common.h":
                                uint64_t ts_event,
                                uint64_t ts_init);
 
+    # Returns the name of a [`TimeEvent`] as a C string pointer.
+    #
+    # The pointer refers to the interned name, so is valid for the life of the process and must not
+    # be freed.
+    const char *time_event_name(const TimeEvent_t *event);
+
+    # Returns the numeric timer ID assigned to the given name, or `TIMER_ID_NONE` if no
+    # recurring timer has been registered with it (see [`registered_timer_id`]).
+    #
+    # # Safety
+    #
+    # - Assumes `name_ptr` is borrowed from a valid Python UTF-8 `str`.
+    uint32_t timer_id_from_cstr(const char *name_ptr);
+
     # Returns a [`TimeEvent`] as a C string pointer.
     const char *time_event_to_cstr(const TimeEvent_t *event);
 
@@ -34,8 +34,8 @@ cdef extern from "../includes/core.h":
     # Represents a pseudo-random UUID (universally unique identifier)
     # version 4 based on a 128-bit label as specified in RFC 4122.
     cdef struct UUID4_t:
-        # The UUID v4 value as a fixed-length C string byte array (includes null terminator).
-        uint8_t value[37];
+        # The UUID v4 value as a 16 byte array in RFC 4122 (big-endian) order.
+        uint8_t value[16];
 
     # Converts seconds to nanoseconds (ns).
     uint64_t secs_to_nanos(double secs);
@@ -65,6 +65,15 @@ cdef extern from "../includes/core.h":
     # Converts a UNIX nanoseconds timestamp to an ISO 8601 formatted C string pointer.
     const char *unix_nanos_to_iso8601_cstr(uint64_t timestamp_ns);
 
+    # Writes a UNIX nanoseconds timestamp as an ISO 8601 formatted nul-terminated C string into
+    # the caller provided buffer `buf` of capacity `len`, returning the full string length (the
+    # output was truncated if not less than `len`).
+    #
+    # # Safety
+    #
+    # - Assumes `buf` is a valid pointer to a writable array of length `len`.
+    uintptr_t unix_nanos_to_iso8601_cstr_buf(uint64_t timestamp_ns, char *buf, uintptr_t len);
+
     # Return the decimal precision inferred from the given C string.
     #
     # # Safety
@@ -115,8 +124,25 @@ cdef extern from "../includes/core.h":
     # - If `ptr` cannot be cast to a valid C string.
     UUID4_t uuid4_from_cstr(const char *ptr);
 
+    # Fills the array `out` of length `len` with newly generated [`UUID4`]s.
+    #
+    # # Safety
+    #
+    # - Assumes `out` is a valid pointer to an array of `UUID4` of length `len`.
+    void uuid4_fill(UUID4_t *out, uintptr_t len);
+
+    # Returns a [`UUID4`] as a C string pointer.
     const char *uuid4_to_cstr(const UUID4_t *uuid);
 
+    # Writes a [`UUID4`] as a nul-terminated C string into the caller provided buffer `buf` of
+    # capacity `len`, returning the full string length (the output was truncated if not less
+    # than `len`).
+    #
+    # # Safety
+    #
+    # - Assumes `buf` is a valid pointer to a writable array of length `len`.
+    uintptr_t uuid4_to_cstr_buf(const UUID4_t *uuid, char *buf, uintptr_t len);
+
     uint8_t uuid4_eq(const UUID4_t *lhs, const UUID4_t *rhs);
 
     uint64_t uuid4_hash(const UUID4_t *uuid);
@@ -1,6 +1,6 @@
 # Warning, this file is autogenerated by cbindgen. Don't modify this manually. */
 
-from libc.stdint cimport uint8_t, uint16_t, uint32_t, uint64_t, uintptr_t, int64_t
+from libc.stdint cimport uint8_t, uint16_t, uint32_t, uint64_t, uintptr_t, int8_t, int64_t
 from nautilus_trader.core.rust.core cimport CVec, UUID4_t
 
 cdef extern from "../includes/model.h":
@@ -10,6 +10,17 @@ cdef extern from "../includes/model.h":
     # The maximum length of ASCII characters for a `TradeId` string value (including null terminator).
     const uintptr_t TRADE_ID_LEN # = 37
 
+    # The current order book snapshot format version.
+    const uint8_t BOOK_SNAPSHOT_VERSION # = 1
+
+    # The default number of tick slots held in the array window of a [`TickLadder`].
+    const uintptr_t TICK_LADDER_DEFAULT_CAPACITY # = 1024
+
+    # The number of batches which may be queued for each worker before
+    # [`BookManager::apply`] blocks, so that a stalled worker applies backpressure rather
+    # than growing memory without limit.
+    const uintptr_t BOOK_MANAGER_QUEUE_CAPACITY # = 1024
+
     # The maximum fixed-point precision.
     const uint8_t FIXED_PRECISION # = 9
 
@@ -416,6 +427,35 @@ cdef extern from "../includes/model.h":
         # Based on the index price for the instrument.
         INDEX_PRICE # = 9,
 
+    # Represents a batch of bars for one bar type held as columns.
+    cdef struct BarBatch:
+        pass
+
+    # Provides a merge of many columnar batches in ascending order of `ts_init`.
+    #
+    # Each batch must itself be ordered by `ts_init`. Rows with equal `ts_init` are
+    # yielded in the order their batches were pushed. Only one cursor per batch is held,
+    # so no row is copied out of its batch until it is read.
+    cdef struct BatchMerge:
+        pass
+
+    # Provides a manager for many order books, which applies their data in parallel.
+    #
+    # Each instrument is assigned to one of a fixed pool of worker threads by the hash of
+    # its ID, and every worker applies the data for its instruments in the order received.
+    # Updates for the same instrument are therefore never reordered, while updates for
+    # instruments on different workers proceed concurrently.
+    #
+    # Each worker owns its books outright, so applying data takes no lock. Readers see the
+    # top of book through the seqlock handle each book publishes, which never waits on a
+    # worker, or take a full [`BookManager::snapshot`] ordered after the data sent so far.
+    cdef struct BookManager:
+        pass
+
+    # Represents a batch of order book deltas for one instrument held as columns.
+    cdef struct DeltaBatch:
+        pass
+
     # Represents a discrete price level in an order book.
     #
     # The level maintains a collection of orders as well as tracking insertion order
@@ -438,11 +478,26 @@ cdef extern from "../includes/model.h":
     cdef struct OrderBookDeltas_t:
         pass
 
+    # Represents a batch of quote ticks for one instrument held as columns.
+    cdef struct QuoteTickBatch:
+        pass
+
     # Represents a synthetic instrument with prices derived from component instruments using a
     # formula.
     cdef struct SyntheticInstrument:
         pass
 
+    # Provides a handle to the top of book published by an [`OrderBook`].
+    #
+    # The handle can be cloned and sent to any thread, which then reads the latest record
+    # without locking or messaging the thread which owns the book.
+    cdef struct TopOfBookHandle:
+        pass
+
+    # Represents a batch of trade ticks for one instrument held as columns.
+    cdef struct TradeTickBatch:
+        pass
+
     # Represents a valid ticker symbol ID for a tradable instrument.
     cdef struct Symbol_t:
         char* _0;
@@ -530,6 +585,9 @@ cdef extern from "../includes/model.h":
     # It implements the `Deref` trait, allowing instances of `OrderBookDeltas_API` to be
     # dereferenced to `OrderBookDeltas`, providing access to `OrderBookDeltas`'s methods without
     # having to manually access the underlying `OrderBookDeltas` instance.
+    #
+    # The underlying `OrderBookDeltas` is reference counted and shared between clones, so cloning
+    # is O(1). Mutable access copies the deltas first if they are shared (copy-on-write).
     cdef struct OrderBookDeltas_API:
         OrderBookDeltas_t *_0;
 
@@ -823,6 +881,122 @@ cdef extern from "../includes/model.h":
     cdef struct Level_API:
         Level *_0;
 
+    # Represents the best bid and ask of an order book at a point in its event sequence.
+    #
+    # A side with no levels has a zero price and size.
+    cdef struct TopOfBook_t:
+        # The best bid price.
+        Price_t bid_price;
+        # The size at the best bid price.
+        Quantity_t bid_size;
+        # The best ask price.
+        Price_t ask_price;
+        # The size at the best ask price.
+        Quantity_t ask_size;
+        # The last event sequence number for the order book.
+        uint64_t sequence;
+        # The timestamp of the last event applied to the order book.
+        uint64_t ts_last;
+
+    # Represents a snapshot of the global string interner statistics.
+    #
+    # The `entries` and byte counts describe the shared cache, while the remaining counters
+    # accumulate from process start (or the last [`reset_interner_stats`]).
+    cdef struct InternerStats_t:
+        # The number of distinct strings held by the cache.
+        uintptr_t entries;
+        # The total bytes allocated by the cache.
+        uintptr_t allocated_bytes;
+        # The total bytes of capacity reserved by the cache.
+        uintptr_t capacity_bytes;
+        # The number of single string lookups made through [`intern`].
+        uint64_t lookups;
+        # The number of calls to [`intern_bulk`].
+        uint64_t bulk_calls;
+        # The number of strings passed to [`intern_bulk`] (including duplicates).
+        uint64_t bulk_strings;
+        # The number of strings newly added to the cache by [`intern_bulk`].
+        uint64_t bulk_inserts;
+        # The total wall time spent in [`intern_bulk`] (nanoseconds).
+        uint64_t bulk_nanos;
+
+    # C compatible Foreign Function Interface (FFI) for an underlying `BookManager`.
+    #
+    # This struct wraps `BookManager` in a way that makes it compatible with C function
+    # calls, enabling interaction with `BookManager` in a C environment.
+    #
+    # It implements the `Deref` trait, allowing instances of `BookManager_API` to be
+    # dereferenced to `BookManager`, providing access to `BookManager`'s methods without
+    # having to manually access the underlying `BookManager` instance.
+    cdef struct BookManager_API:
+        BookManager *_0;
+
+    # C compatible Foreign Function Interface (FFI) for an underlying `TopOfBookHandle`.
+    #
+    # This struct wraps `TopOfBookHandle` in a way that makes it compatible with C function
+    # calls, enabling interaction with `TopOfBookHandle` in a C environment.
+    #
+    # It implements the `Deref` trait, allowing instances of `TopOfBookHandle_API` to be
+    # dereferenced to `TopOfBookHandle`, providing access to `TopOfBookHandle`'s methods without
+    # having to manually access the underlying `TopOfBookHandle` instance.
+    cdef struct TopOfBookHandle_API:
+        TopOfBookHandle *_0;
+
+    # C compatible Foreign Function Interface (FFI) for an underlying `QuoteTickBatch`.
+    #
+    # This struct wraps `QuoteTickBatch` in a way that makes it compatible with C function
+    # calls, enabling interaction with `QuoteTickBatch` in a C environment.
+    #
+    # It implements the `Deref` trait, allowing instances of `QuoteTickBatch_API` to be
+    # dereferenced to `QuoteTickBatch`, providing access to `QuoteTickBatch`'s methods without
+    # having to manually access the underlying `QuoteTickBatch` instance.
+    cdef struct QuoteTickBatch_API:
+        QuoteTickBatch *_0;
+
+    # C compatible Foreign Function Interface (FFI) for an underlying `TradeTickBatch`.
+    #
+    # This struct wraps `TradeTickBatch` in a way that makes it compatible with C function
+    # calls, enabling interaction with `TradeTickBatch` in a C environment.
+    #
+    # It implements the `Deref` trait, allowing instances of `TradeTickBatch_API` to be
+    # dereferenced to `TradeTickBatch`, providing access to `TradeTickBatch`'s methods without
+    # having to manually access the underlying `TradeTickBatch` instance.
+    cdef struct TradeTickBatch_API:
+        TradeTickBatch *_0;
+
+    # C compatible Foreign Function Interface (FFI) for an underlying `BarBatch`.
+    #
+    # This struct wraps `BarBatch` in a way that makes it compatible with C function
+    # calls, enabling interaction with `BarBatch` in a C environment.
+    #
+    # It implements the `Deref` trait, allowing instances of `BarBatch_API` to be
+    # dereferenced to `BarBatch`, providing access to `BarBatch`'s methods without
+    # having to manually access the underlying `BarBatch` instance.
+    cdef struct BarBatch_API:
+        BarBatch *_0;
+
+    # C compatible Foreign Function Interface (FFI) for an underlying `DeltaBatch`.
+    #
+    # This struct wraps `DeltaBatch` in a way that makes it compatible with C function
+    # calls, enabling interaction with `DeltaBatch` in a C environment.
+    #
+    # It implements the `Deref` trait, allowing instances of `DeltaBatch_API` to be
+    # dereferenced to `DeltaBatch`, providing access to `DeltaBatch`'s methods without
+    # having to manually access the underlying `DeltaBatch` instance.
+    cdef struct DeltaBatch_API:
+        DeltaBatch *_0;
+
+    # C compatible Foreign Function Interface (FFI) for an underlying `BatchMerge`.
+    #
+    # This struct wraps `BatchMerge` in a way that makes it compatible with C function
+    # calls, enabling interaction with `BatchMerge` in a C environment.
+    #
+    # It implements the `Deref` trait, allowing instances of `BatchMerge_API` to be
+    # dereferenced to `BatchMerge`, providing access to `BatchMerge`'s methods without
+    # having to manually access the underlying `BatchMerge` instance.
+    cdef struct BatchMerge_API:
+        BatchMerge *_0;
+
     # Represents a medium of exchange in a specified denomination with a fixed decimal precision.
     #
     # Handles up to 9 decimals of precision.
@@ -959,6 +1133,15 @@ cdef extern from "../includes/model.h":
     # Returns a [`Bar`] as a C string.
     const char *bar_to_cstr(const Bar_t *bar);
 
+    # Writes a [`Bar`] as a nul-terminated C string into the caller provided buffer `buf` of
+    # capacity `len`, returning the full string length (the output was truncated if not less
+    # than `len`).
+    #
+    # # Safety
+    #
+    # - Assumes `buf` is a valid pointer to a writable array of length `len`.
+    uintptr_t bar_to_cstr_buf(const Bar_t *bar, char *buf, uintptr_t len);
+
     OrderBookDelta_t orderbook_delta_new(InstrumentId_t instrument_id,
                                          BookAction action,
                                          BookOrder_t order,
@@ -1066,6 +1249,15 @@ cdef extern from "../includes/model.h":
     # Returns a [`QuoteTick`] as a C string pointer.
     const char *quote_tick_to_cstr(const QuoteTick_t *quote);
 
+    # Writes a [`QuoteTick`] as a nul-terminated C string into the caller provided buffer `buf` of
+    # capacity `len`, returning the full string length (the output was truncated if not less
+    # than `len`).
+    #
+    # # Safety
+    #
+    # - Assumes `buf` is a valid pointer to a writable array of length `len`.
+    uintptr_t quote_tick_to_cstr_buf(const QuoteTick_t *quote, char *buf, uintptr_t len);
+
     TradeTick_t trade_tick_new(InstrumentId_t instrument_id,
                                int64_t price_raw,
                                uint8_t price_prec,
@@ -1083,6 +1275,16 @@ cdef extern from "../includes/model.h":
     # Returns a [`TradeTick`] as a C string pointer.
     const char *trade_tick_to_cstr(const TradeTick_t *trade);
 
+    # Writes a [`TradeTick`] as a nul-terminated C string into the caller provided buffer `buf` of
+    # capacity `len`, returning the full string length (the output was truncated if not less
+    # than `len`).
+    #
+    # # Safety
+    #
+    # - Assumes `buf` is a valid pointer to a writable array of length `len`.
+    uintptr_t trade_tick_to_cstr_buf(const TradeTick_t *trade, char *buf, uintptr_t len);
+
+    # Returns the enum name as a C string pointer to static storage (must not be freed).
     const char *account_type_to_cstr(AccountType value);
 
     # Returns an enum from a Python string.
@@ -1092,6 +1294,15 @@ cdef extern from "../includes/model.h":
     # - Assumes `ptr` is a valid C string pointer.
     AccountType account_type_from_cstr(const char *ptr);
 
+    # Parses the array of C strings `ptrs` of length `len` into `out` as [`AccountType`] codes.
+    #
+    # # Safety
+    #
+    # - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+    # - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+    void account_type_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
+    # Returns the enum name as a C string pointer to static storage (must not be freed).
     const char *aggregation_source_to_cstr(AggregationSource value);
 
     # Returns an enum from a Python string.
@@ -1101,6 +1312,15 @@ cdef extern from "../includes/model.h":
     # - Assumes `ptr` is a valid C string pointer.
     AggregationSource aggregation_source_from_cstr(const char *ptr);
 
+    # Parses the array of C strings `ptrs` of length `len` into `out` as [`AggregationSource`] codes.
+    #
+    # # Safety
+    #
+    # - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+    # - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+    void aggregation_source_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
+    # Returns the enum name as a C string pointer to static storage (must not be freed).
     const char *aggressor_side_to_cstr(AggressorSide value);
 
     # Returns an enum from a Python string.
@@ -1110,6 +1330,15 @@ cdef extern from "../includes/model.h":
     # - Assumes `ptr` is a valid C string pointer.
     AggressorSide aggressor_side_from_cstr(const char *ptr);
 
+    # Parses the array of C strings `ptrs` of length `len` into `out` as [`AggressorSide`] codes.
+    #
+    # # Safety
+    #
+    # - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+    # - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+    void aggressor_side_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
+    # Returns the enum name as a C string pointer to static storage (must not be freed).
     const char *asset_class_to_cstr(AssetClass value);
 
     # Returns an enum from a Python string.
@@ -1119,6 +1348,15 @@ cdef extern from "../includes/model.h":
     # - Assumes `ptr` is a valid C string pointer.
     AssetClass asset_class_from_cstr(const char *ptr);
 
+    # Parses the array of C strings `ptrs` of length `len` into `out` as [`AssetClass`] codes.
+    #
+    # # Safety
+    #
+    # - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+    # - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+    void asset_class_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
+    # Returns the enum name as a C string pointer to static storage (must not be freed).
     const char *instrument_class_to_cstr(InstrumentClass value);
 
     # Returns an enum from a Python string.
@@ -1128,6 +1366,15 @@ cdef extern from "../includes/model.h":
     # - Assumes `ptr` is a valid C string pointer.
     InstrumentClass instrument_class_from_cstr(const char *ptr);
 
+    # Parses the array of C strings `ptrs` of length `len` into `out` as [`InstrumentClass`] codes.
+    #
+    # # Safety
+    #
+    # - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+    # - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+    void instrument_class_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
+    # Returns the enum name as a C string pointer to static storage (must not be freed).
     const char *bar_aggregation_to_cstr(uint8_t value);
 
     # Returns an enum from a Python string.
@@ -1137,6 +1384,15 @@ cdef extern from "../includes/model.h":
     # - Assumes `ptr` is a valid C string pointer.
     uint8_t bar_aggregation_from_cstr(const char *ptr);
 
+    # Parses the array of C strings `ptrs` of length `len` into `out` as [`BarAggregation`] codes.
+    #
+    # # Safety
+    #
+    # - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+    # - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+    void bar_aggregation_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
+    # Returns the enum name as a C string pointer to static storage (must not be freed).
     const char *book_action_to_cstr(BookAction value);
 
     # Returns an enum from a Python string.
@@ -1146,6 +1402,15 @@ cdef extern from "../includes/model.h":
     # - Assumes `ptr` is a valid C string pointer.
     BookAction book_action_from_cstr(const char *ptr);
 
+    # Parses the array of C strings `ptrs` of length `len` into `out` as [`BookAction`] codes.
+    #
+    # # Safety
+    #
+    # - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+    # - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+    void book_action_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
+    # Returns the enum name as a C string pointer to static storage (must not be freed).
     const char *book_type_to_cstr(BookType value);
 
     # Returns an enum from a Python string.
@@ -1155,6 +1420,15 @@ cdef extern from "../includes/model.h":
     # - Assumes `ptr` is a valid C string pointer.
     BookType book_type_from_cstr(const char *ptr);
 
+    # Parses the array of C strings `ptrs` of length `len` into `out` as [`BookType`] codes.
+    #
+    # # Safety
+    #
+    # - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+    # - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+    void book_type_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
+    # Returns the enum name as a C string pointer to static storage (must not be freed).
     const char *contingency_type_to_cstr(ContingencyType value);
 
     # Returns an enum from a Python string.
@@ -1164,6 +1438,15 @@ cdef extern from "../includes/model.h":
     # - Assumes `ptr` is a valid C string pointer.
     ContingencyType contingency_type_from_cstr(const char *ptr);
 
+    # Parses the array of C strings `ptrs` of length `len` into `out` as [`ContingencyType`] codes.
+    #
+    # # Safety
+    #
+    # - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+    # - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+    void contingency_type_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
+    # Returns the enum name as a C string pointer to static storage (must not be freed).
     const char *currency_type_to_cstr(CurrencyType value);
 
     # Returns an enum from a Python string.
@@ -1173,6 +1456,14 @@ cdef extern from "../includes/model.h":
     # - Assumes `ptr` is a valid C string pointer.
     CurrencyType currency_type_from_cstr(const char *ptr);
 
+    # Parses the array of C strings `ptrs` of length `len` into `out` as [`CurrencyType`] codes.
+    #
+    # # Safety
+    #
+    # - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+    # - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+    void currency_type_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
     # Returns an enum from a Python string.
     #
     # # Safety
@@ -1180,8 +1471,20 @@ cdef extern from "../includes/model.h":
     # - Assumes `ptr` is a valid C string pointer.
     InstrumentCloseType instrument_close_type_from_cstr(const char *ptr);
 
+    # Parses the array of C strings `ptrs` of length `len` into `out` as [`InstrumentCloseType`] codes.
+    #
+    # # Safety
+    #
+    # - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+    # - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+    void instrument_close_type_from_cstr_array(const char *const *ptrs,
+                                               uintptr_t len,
+                                               uint8_t *out);
+
+    # Returns the enum name as a C string pointer to static storage (must not be freed).
     const char *instrument_close_type_to_cstr(InstrumentCloseType value);
 
+    # Returns the enum name as a C string pointer to static storage (must not be freed).
     const char *liquidity_side_to_cstr(LiquiditySide value);
 
     # Returns an enum from a Python string.
@@ -1191,6 +1494,15 @@ cdef extern from "../includes/model.h":
     # - Assumes `ptr` is a valid C string pointer.
     LiquiditySide liquidity_side_from_cstr(const char *ptr);
 
+    # Parses the array of C strings `ptrs` of length `len` into `out` as [`LiquiditySide`] codes.
+    #
+    # # Safety
+    #
+    # - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+    # - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+    void liquidity_side_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
+    # Returns the enum name as a C string pointer to static storage (must not be freed).
     const char *market_status_to_cstr(MarketStatus value);
 
     # Returns an enum from a Python string.
@@ -1200,6 +1512,15 @@ cdef extern from "../includes/model.h":
     # - Assumes `ptr` is a valid C string pointer.
     MarketStatus market_status_from_cstr(const char *ptr);
 
+    # Parses the array of C strings `ptrs` of length `len` into `out` as [`MarketStatus`] codes.
+    #
+    # # Safety
+    #
+    # - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+    # - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+    void market_status_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
+    # Returns the enum name as a C string pointer to static storage (must not be freed).
     const char *market_status_action_to_cstr(MarketStatusAction value);
 
     # Returns an enum from a Python string.
@@ -1209,6 +1530,15 @@ cdef extern from "../includes/model.h":
     # - Assumes `ptr` is a valid C string pointer.
     MarketStatusAction market_status_action_from_cstr(const char *ptr);
 
+    # Parses the array of C strings `ptrs` of length `len` into `out` as [`MarketStatusAction`] codes.
+    #
+    # # Safety
+    #
+    # - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+    # - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+    void market_status_action_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
+    # Returns the enum name as a C string pointer to static storage (must not be freed).
     const char *oms_type_to_cstr(OmsType value);
 
     # Returns an enum from a Python string.
@@ -1218,6 +1548,15 @@ cdef extern from "../includes/model.h":
     # - Assumes `ptr` is a valid C string pointer.
     OmsType oms_type_from_cstr(const char *ptr);
 
+    # Parses the array of C strings `ptrs` of length `len` into `out` as [`OmsType`] codes.
+    #
+    # # Safety
+    #
+    # - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+    # - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+    void oms_type_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
+    # Returns the enum name as a C string pointer to static storage (must not be freed).
     const char *option_kind_to_cstr(OptionKind value);
 
     # Returns an enum from a Python string.
@@ -1227,6 +1566,15 @@ cdef extern from "../includes/model.h":
     # - Assumes `ptr` is a valid C string pointer.
     OptionKind option_kind_from_cstr(const char *ptr);
 
+    # Parses the array of C strings `ptrs` of length `len` into `out` as [`OptionKind`] codes.
+    #
+    # # Safety
+    #
+    # - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+    # - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+    void option_kind_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
+    # Returns the enum name as a C string pointer to static storage (must not be freed).
     const char *order_side_to_cstr(OrderSide value);
 
     # Returns an enum from a Python string.
@@ -1236,6 +1584,15 @@ cdef extern from "../includes/model.h":
     # - Assumes `ptr` is a valid C string pointer.
     OrderSide order_side_from_cstr(const char *ptr);
 
+    # Parses the array of C strings `ptrs` of length `len` into `out` as [`OrderSide`] codes.
+    #
+    # # Safety
+    #
+    # - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+    # - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+    void order_side_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
+    # Returns the enum name as a C string pointer to static storage (must not be freed).
     const char *order_status_to_cstr(OrderStatus value);
 
     # Returns an enum from a Python string.
@@ -1245,6 +1602,15 @@ cdef extern from "../includes/model.h":
     # - Assumes `ptr` is a valid C string pointer.
     OrderStatus order_status_from_cstr(const char *ptr);
 
+    # Parses the array of C strings `ptrs` of length `len` into `out` as [`OrderStatus`] codes.
+    #
+    # # Safety
+    #
+    # - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+    # - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+    void order_status_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
+    # Returns the enum name as a C string pointer to static storage (must not be freed).
     const char *order_type_to_cstr(OrderType value);
 
     # Returns an enum from a Python string.
@@ -1254,6 +1620,15 @@ cdef extern from "../includes/model.h":
     # - Assumes `ptr` is a valid C string pointer.
     OrderType order_type_from_cstr(const char *ptr);
 
+    # Parses the array of C strings `ptrs` of length `len` into `out` as [`OrderType`] codes.
+    #
+    # # Safety
+    #
+    # - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+    # - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+    void order_type_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
+    # Returns the enum name as a C string pointer to static storage (must not be freed).
     const char *position_side_to_cstr(PositionSide value);
 
     # Returns an enum from a Python string.
@@ -1263,6 +1638,15 @@ cdef extern from "../includes/model.h":
     # - Assumes `ptr` is a valid C string pointer.
     PositionSide position_side_from_cstr(const char *ptr);
 
+    # Parses the array of C strings `ptrs` of length `len` into `out` as [`PositionSide`] codes.
+    #
+    # # Safety
+    #
+    # - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+    # - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+    void position_side_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
+    # Returns the enum name as a C string pointer to static storage (must not be freed).
     const char *price_type_to_cstr(PriceType value);
 
     # Returns an enum from a Python string.
@@ -1272,6 +1656,15 @@ cdef extern from "../includes/model.h":
     # - Assumes `ptr` is a valid C string pointer.
     PriceType price_type_from_cstr(const char *ptr);
 
+    # Parses the array of C strings `ptrs` of length `len` into `out` as [`PriceType`] codes.
+    #
+    # # Safety
+    #
+    # - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+    # - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+    void price_type_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
+    # Returns the enum name as a C string pointer to static storage (must not be freed).
     const char *record_flag_to_cstr(RecordFlag value);
 
     # Returns an enum from a Python string.
@@ -1281,6 +1674,15 @@ cdef extern from "../includes/model.h":
     # - Assumes `ptr` is a valid C string pointer.
     RecordFlag record_flag_from_cstr(const char *ptr);
 
+    # Parses the array of C strings `ptrs` of length `len` into `out` as [`RecordFlag`] codes.
+    #
+    # # Safety
+    #
+    # - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+    # - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+    void record_flag_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
+    # Returns the enum name as a C string pointer to static storage (must not be freed).
     const char *time_in_force_to_cstr(TimeInForce value);
 
     # Returns an enum from a Python string.
@@ -1290,6 +1692,15 @@ cdef extern from "../includes/model.h":
     # - Assumes `ptr` is a valid C string pointer.
     TimeInForce time_in_force_from_cstr(const char *ptr);
 
+    # Parses the array of C strings `ptrs` of length `len` into `out` as [`TimeInForce`] codes.
+    #
+    # # Safety
+    #
+    # - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+    # - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+    void time_in_force_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
+    # Returns the enum name as a C string pointer to static storage (must not be freed).
     const char *trading_state_to_cstr(TradingState value);
 
     # Returns an enum from a Python string.
@@ -1299,6 +1710,15 @@ cdef extern from "../includes/model.h":
     # - Assumes `ptr` is a valid C string pointer.
     TradingState trading_state_from_cstr(const char *ptr);
 
+    # Parses the array of C strings `ptrs` of length `len` into `out` as [`TradingState`] codes.
+    #
+    # # Safety
+    #
+    # - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+    # - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+    void trading_state_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
+    # Returns the enum name as a C string pointer to static storage (must not be freed).
     const char *trailing_offset_type_to_cstr(TrailingOffsetType value);
 
     # Returns an enum from a Python string.
@@ -1308,6 +1728,15 @@ cdef extern from "../includes/model.h":
     # - Assumes `ptr` is a valid C string pointer.
     TrailingOffsetType trailing_offset_type_from_cstr(const char *ptr);
 
+    # Parses the array of C strings `ptrs` of length `len` into `out` as [`TrailingOffsetType`] codes.
+    #
+    # # Safety
+    #
+    # - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+    # - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+    void trailing_offset_type_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
+    # Returns the enum name as a C string pointer to static storage (must not be freed).
     const char *trigger_type_to_cstr(TriggerType value);
 
     # Returns an enum from a Python string.
@@ -1317,6 +1746,14 @@ cdef extern from "../includes/model.h":
     # - Assumes `ptr` is a valid C string pointer.
     TriggerType trigger_type_from_cstr(const char *ptr);
 
+    # Parses the array of C strings `ptrs` of length `len` into `out` as [`TriggerType`] codes.
+    #
+    # # Safety
+    #
+    # - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+    # - Assumes `out` is a valid pointer to a `u8` array of length `len`.
+    void trigger_type_from_cstr_array(const char *const *ptrs, uintptr_t len, uint8_t *out);
+
     # # Safety
     #
     # - Assumes `reason_ptr` is a valid C string pointer.
@@ -1444,10 +1881,35 @@ cdef extern from "../includes/model.h":
     # Returns an [`InstrumentId`] as a C string pointer.
     const char *instrument_id_to_cstr(const InstrumentId_t *instrument_id);
 
+    # Writes an [`InstrumentId`] as a nul-terminated C string into the caller provided buffer
+    # `buf` of capacity `len`, returning the full string length (the output was truncated if not
+    # less than `len`).
+    #
+    # # Safety
+    #
+    # - Assumes `buf` is a valid pointer to a writable array of length `len`.
+    uintptr_t instrument_id_to_cstr_buf(const InstrumentId_t *instrument_id,
+                                        char *buf,
+                                        uintptr_t len);
+
     uint64_t instrument_id_hash(const InstrumentId_t *instrument_id);
 
     uint8_t instrument_id_is_synthetic(const InstrumentId_t *instrument_id);
 
+    # Returns a snapshot of the global string interner statistics.
+    InternerStats_t interner_stats_get();
+
+    # Resets the global string interner counters to zero.
+    void interner_stats_reset();
+
+    # Interns each C string in the array `ptrs` of length `len` in turn, returning the number of
+    # strings newly added to the cache.
+    #
+    # # Safety
+    #
+    # - Assumes `ptrs` is a valid pointer to an array of valid C string pointers of length `len`.
+    uintptr_t interner_preload(const char *const *ptrs, uintptr_t len);
+
     # Returns a Nautilus identifier from a C string pointer.
     #
     # # Safety
@@ -1497,8 +1959,11 @@ cdef extern from "../includes/model.h":
     # - Assumes `ptr` is a valid C string pointer.
     TradeId_t trade_id_new(const char *ptr);
 
+    uint8_t trade_id_eq(const TradeId_t *lhs, const TradeId_t *rhs);
+
     uint64_t trade_id_hash(const TradeId_t *id);
 
+    # Returns a [`TradeId`] as a C string pointer borrowed from `trade_id` (must not be freed).
     const char *trade_id_to_cstr(const TradeId_t *trade_id);
 
     # Returns a Nautilus identifier from a C string pointer.
@@ -1585,10 +2050,80 @@ cdef extern from "../includes/model.h":
 
     OrderBook_API orderbook_new(InstrumentId_t instrument_id, BookType book_type);
 
+    OrderBook_API orderbook_new_tick_indexed(InstrumentId_t instrument_id,
+                                             BookType book_type,
+                                             Price_t price_increment,
+                                             uintptr_t capacity);
+
+    # Returns a binary snapshot of the order book as a `CVec` of bytes.
+    #
+    # The returned `CVec` must be freed with `cvec_drop`.
+    CVec orderbook_snapshot_to_bytes(const OrderBook_API *book);
+
+    # Restores an order book from a binary snapshot, writing it to `book`.
+    #
+    # Returns 1 on success, or 0 if the bytes are not a valid order book snapshot, in
+    # which case nothing is written.
+    #
+    # # Safety
+    #
+    # - Assumes `data` is a valid pointer to an array of bytes of length `len`.
+    # - Assumes `book` is a valid pointer which the restored book may be written to
+    #   without dropping its contents.
+    uint8_t orderbook_restore_from_bytes(const uint8_t *data,
+                                         uintptr_t len,
+                                         OrderBook_API *book);
+
+    # Restores many order books from binary snapshots in parallel, writing them to `books`.
+    #
+    # Returns 1 on success, or 0 if any of the snapshots is not a valid order book
+    # snapshot, in which case all restored books are dropped and nothing is written.
+    #
+    # # Safety
+    #
+    # - Assumes `data` and `lens` are valid pointers to arrays of length `count`, where
+    #   each `data[i]` is a valid pointer to an array of bytes of length `lens[i]`.
+    # - Assumes `books` is a valid pointer to an array of length `count` which the
+    #   restored books may be written to without dropping its contents.
+    uint8_t orderbook_restore_many_from_bytes(const uint8_t **data,
+                                              const uintptr_t *lens,
+                                              uintptr_t count,
+                                              OrderBook_API *books);
+
+    OrderBook_API orderbook_new_depth10(InstrumentId_t instrument_id);
+
+    # Returns whether the book holds its levels in tick-indexed ladders.
+    uint8_t orderbook_is_tick_indexed(const OrderBook_API *book);
+
+    # Returns the price increment of the tick-indexed ladders, or a zero price with zero
+    # precision if the book is not tick-indexed.
+    Price_t orderbook_price_increment(const OrderBook_API *book);
+
+    # Returns whether the book is in fixed depth mode, loading depth snapshots into fixed
+    # MBP-10 arrays.
+    uint8_t orderbook_is_fixed_depth(const OrderBook_API *book);
+
     void orderbook_drop(OrderBook_API book);
 
     void orderbook_reset(OrderBook_API *book);
 
+    void orderbook_enable_cumulative_depth(OrderBook_API *book);
+
+    uint8_t orderbook_has_cumulative_depth(const OrderBook_API *book);
+
+    void orderbook_enable_sequencing(OrderBook_API *book, uintptr_t capacity);
+
+    uint8_t orderbook_is_stale(const OrderBook_API *book);
+
+    # Returns the number of sequence gaps detected, or zero if sequencing is not enabled.
+    uint64_t orderbook_sequence_gaps(const OrderBook_API *book);
+
+    # Returns the number of duplicate or late deltas dropped, or zero if sequencing is not enabled.
+    uint64_t orderbook_sequence_dropped(const OrderBook_API *book);
+
+    # Returns the number of deltas held for reordering, or zero if sequencing is not enabled.
+    uintptr_t orderbook_sequence_pending(const OrderBook_API *book);
+
     InstrumentId_t orderbook_instrument_id(const OrderBook_API *book);
 
     BookType orderbook_book_type(const OrderBook_API *book);
@@ -1627,12 +2162,45 @@ cdef extern from "../includes/model.h":
 
     void orderbook_apply_deltas(OrderBook_API *book, const OrderBookDeltas_API *deltas);
 
+    # Applies a contiguous array of deltas to the order book, borrowed in place.
+    #
+    # # Safety
+    #
+    # - Assumes `deltas` is a valid pointer to an array of `OrderBookDelta` of length `len`.
+    void orderbook_apply_deltas_raw(OrderBook_API *book,
+                                    const OrderBookDelta_t *deltas,
+                                    uintptr_t len);
+
     void orderbook_apply_depth(OrderBook_API *book, const OrderBookDepth10_t *depth);
 
     CVec orderbook_bids(OrderBook_API *book);
 
     CVec orderbook_asks(OrderBook_API *book);
 
+    # Writes up to `len` of the top bid levels into the caller provided column buffers,
+    # returning the number of levels written.
+    #
+    # # Safety
+    #
+    # - Assumes `prices`, `sizes` and `counts` are valid pointers to arrays of length `len`.
+    uintptr_t orderbook_bids_depth(const OrderBook_API *book,
+                                   int64_t *prices,
+                                   uint64_t *sizes,
+                                   uint32_t *counts,
+                                   uintptr_t len);
+
+    # Writes up to `len` of the top ask levels into the caller provided column buffers,
+    # returning the number of levels written.
+    #
+    # # Safety
+    #
+    # - Assumes `prices`, `sizes` and `counts` are valid pointers to arrays of length `len`.
+    uintptr_t orderbook_asks_depth(const OrderBook_API *book,
+                                   int64_t *prices,
+                                   uint64_t *sizes,
+                                   uint32_t *counts,
+                                   uintptr_t len);
+
     uint8_t orderbook_has_bid(OrderBook_API *book);
 
     uint8_t orderbook_has_ask(OrderBook_API *book);
@@ -1645,6 +2213,8 @@ cdef extern from "../includes/model.h":
 
     Quantity_t orderbook_best_ask_size(OrderBook_API *book);
 
+    TopOfBook_t orderbook_top_of_book(const OrderBook_API *book);
+
     double orderbook_spread(OrderBook_API *book);
 
     double orderbook_midpoint(OrderBook_API *book);
@@ -1700,6 +2270,167 @@ cdef extern from "../includes/model.h":
 
     void vec_orders_drop(CVec v);
 
+    # Creates a new book manager with `num_workers` worker threads, each pinned to a CPU
+    # core if `pin_workers` is non-zero (Linux only).
+    BookManager_API book_manager_new(uintptr_t num_workers,
+                                     BookType book_type,
+                                     uint8_t pin_workers);
+
+    # Stops the worker threads of the manager and drops its books.
+    void book_manager_drop(BookManager_API manager);
+
+    # Adds a copy of the given book to the manager, replacing any book for the same
+    # instrument.
+    #
+    # Returns 1 on success, or 0 if the worker owning the instrument has stopped.
+    uint8_t book_manager_add_book(const BookManager_API *manager, const OrderBook_API *book);
+
+    # Routes a batch of interleaved data to the workers of the manager.
+    #
+    # Ownership of every element is moved into the manager, so the caller must not use or
+    # drop the elements of the array afterwards (the array itself remains owned by the
+    # caller). Returns 1 on success, or 0 if a worker has stopped.
+    #
+    # # Safety
+    #
+    # - Assumes `data` is a valid pointer to an array of `Data` of length `len`.
+    uint8_t book_manager_apply(const BookManager_API *manager, Data_t *data, uintptr_t len) nogil;
+
+    # Blocks until all data passed to the manager so far has been applied.
+    #
+    # Returns 1 on success, or 0 if a worker has stopped.
+    uint8_t book_manager_flush(const BookManager_API *manager) nogil;
+
+    uint8_t book_manager_has_book(const BookManager_API *manager, InstrumentId_t instrument_id);
+
+    TopOfBook_t book_manager_top_of_book(const BookManager_API *manager,
+                                         InstrumentId_t instrument_id);
+
+    # Writes a copy of the book for the given instrument to `book`, taken after all data
+    # passed to the manager so far has been applied.
+    #
+    # Returns 1 if a book was written, or 0 if no book exists for the instrument or its
+    # worker has stopped.
+    #
+    # # Safety
+    #
+    # - Assumes `book` is a valid pointer which the book may be written to without dropping
+    #   its contents.
+    uint8_t book_manager_snapshot(const BookManager_API *manager,
+                                  InstrumentId_t instrument_id,
+                                  OrderBook_API *book);
+
+    uintptr_t book_manager_count(const BookManager_API *manager);
+
+    # Returns a handle to the top of book published by `book`, starting publishing if needed.
+    #
+    # The handle may be read from any thread, and remains valid after the book is dropped.
+    TopOfBookHandle_API orderbook_top_of_book_handle(OrderBook_API *book);
+
+    TopOfBookHandle_API top_of_book_handle_clone(const TopOfBookHandle_API *handle);
+
+    void top_of_book_handle_drop(TopOfBookHandle_API handle);
+
+    TopOfBook_t top_of_book_handle_read(const TopOfBookHandle_API *handle);
+
+    QuoteTickBatch_API quote_tick_batch_new(InstrumentId_t instrument_id,
+                                            uint8_t price_precision,
+                                            uint8_t size_precision);
+
+    void quote_tick_batch_drop(QuoteTickBatch_API batch);
+
+    void quote_tick_batch_push(QuoteTickBatch_API *batch, const QuoteTick_t *quote);
+
+    uintptr_t quote_tick_batch_len(const QuoteTickBatch_API *batch);
+
+    # Returns the row of the batch at the given `index`.
+    #
+    # # Panics
+    #
+    # This function panics:
+    # - If `index` is out of bounds.
+    QuoteTick_t quote_tick_batch_get(const QuoteTickBatch_API *batch, uintptr_t index);
+
+    TradeTickBatch_API trade_tick_batch_new(InstrumentId_t instrument_id,
+                                            uint8_t price_precision,
+                                            uint8_t size_precision);
+
+    void trade_tick_batch_drop(TradeTickBatch_API batch);
+
+    void trade_tick_batch_push(TradeTickBatch_API *batch, const TradeTick_t *trade);
+
+    uintptr_t trade_tick_batch_len(const TradeTickBatch_API *batch);
+
+    # Returns the row of the batch at the given `index`.
+    #
+    # # Panics
+    #
+    # This function panics:
+    # - If `index` is out of bounds.
+    TradeTick_t trade_tick_batch_get(const TradeTickBatch_API *batch, uintptr_t index);
+
+    BarBatch_API bar_batch_new(BarType_t bar_type, uint8_t price_precision, uint8_t size_precision);
+
+    void bar_batch_drop(BarBatch_API batch);
+
+    void bar_batch_push(BarBatch_API *batch, const Bar_t *bar);
+
+    uintptr_t bar_batch_len(const BarBatch_API *batch);
+
+    # Returns the row of the batch at the given `index`.
+    #
+    # # Panics
+    #
+    # This function panics:
+    # - If `index` is out of bounds.
+    Bar_t bar_batch_get(const BarBatch_API *batch, uintptr_t index);
+
+    DeltaBatch_API delta_batch_new(InstrumentId_t instrument_id,
+                                   uint8_t price_precision,
+                                   uint8_t size_precision);
+
+    void delta_batch_drop(DeltaBatch_API batch);
+
+    void delta_batch_push(DeltaBatch_API *batch, const OrderBookDelta_t *delta);
+
+    uintptr_t delta_batch_len(const DeltaBatch_API *batch);
+
+    # Returns the row of the batch at the given `index`.
+    #
+    # # Panics
+    #
+    # This function panics:
+    # - If `index` is out of bounds.
+    OrderBookDelta_t delta_batch_get(const DeltaBatch_API *batch, uintptr_t index);
+
+    BatchMerge_API batch_merge_new();
+
+    void batch_merge_drop(BatchMerge_API merge);
+
+    # Adds the batch to the merge, taking ownership of it.
+    void batch_merge_push_quote_tick_batch(BatchMerge_API *merge, QuoteTickBatch_API batch);
+
+    # Adds the batch to the merge, taking ownership of it.
+    void batch_merge_push_trade_tick_batch(BatchMerge_API *merge, TradeTickBatch_API batch);
+
+    # Adds the batch to the merge, taking ownership of it.
+    void batch_merge_push_bar_batch(BatchMerge_API *merge, BarBatch_API batch);
+
+    # Adds the batch to the merge, taking ownership of it.
+    void batch_merge_push_delta_batch(BatchMerge_API *merge, DeltaBatch_API batch);
+
+    uintptr_t batch_merge_remaining(const BatchMerge_API *merge);
+
+    uint8_t batch_merge_is_exhausted(const BatchMerge_API *merge);
+
+    # Returns the next row of the merge in order of `ts_init`.
+    #
+    # # Panics
+    #
+    # This function panics:
+    # - If the merge is exhausted.
+    Data_t batch_merge_next(BatchMerge_API *merge);
+
     # Returns a [`Currency`] from pointers and primitives.
     #
     # # Safety
@@ -1752,6 +2483,88 @@ cdef extern from "../includes/model.h":
 
     void price_sub_assign(Price_t a, Price_t b);
 
+    # Converts `len` values to raw `Price` values with the given `precision`.
+    #
+    # # Safety
+    #
+    # - Assumes `values` and `out` are valid pointers to arrays of length `len`.
+    void price_raw_from_f64_array(const double *values,
+                                  uint8_t precision,
+                                  int64_t *out,
+                                  uintptr_t len);
+
+    # Converts `len` raw `Price` values to `f64` values.
+    #
+    # # Safety
+    #
+    # - Assumes `raws` and `out` are valid pointers to arrays of length `len`.
+    void price_raw_to_f64_array(const int64_t *raws, double *out, uintptr_t len);
+
+    # Rounds `len` raw `Price` values in place to the given `precision`.
+    #
+    # # Safety
+    #
+    # - Assumes `raws` is a valid pointer to an array of length `len`.
+    void price_raw_rescale_array(int64_t *raws, uintptr_t len, uint8_t precision);
+
+    # Returns the minimum of `len` raw `Price` values (`i64::MAX` if `len` is zero).
+    #
+    # # Safety
+    #
+    # - Assumes `raws` is a valid pointer to an array of length `len`.
+    int64_t price_raw_min(const int64_t *raws, uintptr_t len);
+
+    # Returns the maximum of `len` raw `Price` values (`i64::MIN` if `len` is zero).
+    #
+    # # Safety
+    #
+    # - Assumes `raws` is a valid pointer to an array of length `len`.
+    int64_t price_raw_max(const int64_t *raws, uintptr_t len);
+
+    # Returns the sum of `len` raw `Price` values.
+    #
+    # # Safety
+    #
+    # - Assumes `raws` is a valid pointer to an array of length `len`.
+    #
+    # # Panics
+    #
+    # This function panics:
+    # - If the sum overflows `i64`.
+    int64_t price_raw_sum(const int64_t *raws, uintptr_t len);
+
+    # Compares `len` raw `Price` values element-wise, writing -1, 0 or 1 to `out`.
+    #
+    # # Safety
+    #
+    # - Assumes `lhs`, `rhs` and `out` are valid pointers to arrays of length `len`.
+    void price_raw_compare_arrays(const int64_t *lhs,
+                                  const int64_t *rhs,
+                                  int8_t *out,
+                                  uintptr_t len);
+
+    # Parses the `delimiter` separated decimal values in the ASCII buffer `buf` of length `len`
+    # to raw `Price` values written to `out`.
+    #
+    # The number of values written is written to `count` and the maximum precision inferred
+    # across them to `precision`.
+    #
+    # Returns 1 on success, or 0 if any value fails to parse or there are more than `capacity`
+    # values (values before it remain written to `out`).
+    #
+    # # Safety
+    #
+    # - Assumes `buf` is a valid pointer to an array of length `len`.
+    # - Assumes `out` is a valid pointer to an array of length `capacity`.
+    # - Assumes `count` and `precision` are valid pointers.
+    uint8_t price_raw_parse_delimited(const uint8_t *buf,
+                                      uintptr_t len,
+                                      uint8_t delimiter,
+                                      int64_t *out,
+                                      uintptr_t capacity,
+                                      uintptr_t *count,
+                                      uint8_t *precision);
+
     Quantity_t quantity_new(double value, uint8_t precision);
 
     Quantity_t quantity_from_raw(uint64_t raw, uint8_t precision);
@@ -1765,3 +2578,85 @@ cdef extern from "../includes/model.h":
     void quantity_sub_assign(Quantity_t a, Quantity_t b);
 
     void quantity_sub_assign_u64(Quantity_t a, uint64_t b);
+
+    # Converts `len` values to raw `Quantity` values with the given `precision`.
+    #
+    # # Safety
+    #
+    # - Assumes `values` and `out` are valid pointers to arrays of length `len`.
+    void quantity_raw_from_f64_array(const double *values,
+                                     uint8_t precision,
+                                     uint64_t *out,
+                                     uintptr_t len);
+
+    # Converts `len` raw `Quantity` values to `f64` values.
+    #
+    # # Safety
+    #
+    # - Assumes `raws` and `out` are valid pointers to arrays of length `len`.
+    void quantity_raw_to_f64_array(const uint64_t *raws, double *out, uintptr_t len);
+
+    # Rounds `len` raw `Quantity` values in place to the given `precision`.
+    #
+    # # Safety
+    #
+    # - Assumes `raws` is a valid pointer to an array of length `len`.
+    void quantity_raw_rescale_array(uint64_t *raws, uintptr_t len, uint8_t precision);
+
+    # Returns the minimum of `len` raw `Quantity` values (`u64::MAX` if `len` is zero).
+    #
+    # # Safety
+    #
+    # - Assumes `raws` is a valid pointer to an array of length `len`.
+    uint64_t quantity_raw_min(const uint64_t *raws, uintptr_t len);
+
+    # Returns the maximum of `len` raw `Quantity` values (`u64::MIN` if `len` is zero).
+    #
+    # # Safety
+    #
+    # - Assumes `raws` is a valid pointer to an array of length `len`.
+    uint64_t quantity_raw_max(const uint64_t *raws, uintptr_t len);
+
+    # Returns the sum of `len` raw `Quantity` values.
+    #
+    # # Safety
+    #
+    # - Assumes `raws` is a valid pointer to an array of length `len`.
+    #
+    # # Panics
+    #
+    # This function panics:
+    # - If the sum overflows `u64`.
+    uint64_t quantity_raw_sum(const uint64_t *raws, uintptr_t len);
+
+    # Compares `len` raw `Quantity` values element-wise, writing -1, 0 or 1 to `out`.
+    #
+    # # Safety
+    #
+    # - Assumes `lhs`, `rhs` and `out` are valid pointers to arrays of length `len`.
+    void quantity_raw_compare_arrays(const uint64_t *lhs,
+                                     const uint64_t *rhs,
+                                     int8_t *out,
+                                     uintptr_t len);
+
+    # Parses the `delimiter` separated decimal values in the ASCII buffer `buf` of length `len`
+    # to raw `Quantity` values written to `out`.
+    #
+    # The number of values written is written to `count` and the maximum precision inferred
+    # across them to `precision`.
+    #
+    # Returns 1 on success, or 0 if any value fails to parse or there are more than `capacity`
+    # values (values before it remain written to `out`).
+    #
+    # # Safety
+    #
+    # - Assumes `buf` is a valid pointer to an array of length `len`.
+    # - Assumes `out` is a valid pointer to an array of length `capacity`.
+    # - Assumes `count` and `precision` are valid pointers.
+    uint8_t quantity_raw_parse_delimited(const uint8_t *buf,
+                                         uintptr_t len,
+                                         uint8_t delimiter,
+                                         uint64_t *out,
+                                         uintptr_t capacity,
+                                         uintptr_t *count,
+                                         uint8_t *precision);
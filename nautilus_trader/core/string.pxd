@@ -21,6 +21,10 @@ cdef extern from "Python.h":
     # UTF-8 encoded bytes. The size is determined with strlen().
     unicode PyUnicode_FromString(const char *u)  # noqa
 
+    # Create a Unicode object from the char buffer u. The bytes will be
+    # interpreted as being UTF-8 encoded. The buffer is copied into the new object.
+    unicode PyUnicode_FromStringAndSize(const char *u, Py_ssize_t size)  # noqa
+
     # Return value: New reference.
     # Return a new string object with the value v on success, and NULL
     # on failure. The parameter v must not be NULL; it will not be
@@ -67,6 +71,16 @@ cdef inline str cstr_to_pystr(const char* ptr, bint drop = True):
     return obj
 
 
+# Stack buffer length for values formatted with the Rust `*_to_cstr_buf` functions
+cdef enum:
+    CSTR_BUF_LEN = 256
+
+
+# Convert the first `length` bytes of a caller owned buffer to a Python string
+cdef inline str cstr_buf_to_pystr(const char* buf, size_t length):
+    return PyUnicode_FromStringAndSize(buf, length)
+
+
 # Convert a Rust interned string to a Python string
 cdef inline str ustr_to_pystr(const char* ptr):
     return PyUnicode_FromString(ptr)
@@ -18,8 +18,9 @@ from nautilus_trader.core.rust.core cimport uuid4_eq
 from nautilus_trader.core.rust.core cimport uuid4_from_cstr
 from nautilus_trader.core.rust.core cimport uuid4_hash
 from nautilus_trader.core.rust.core cimport uuid4_new
-from nautilus_trader.core.rust.core cimport uuid4_to_cstr
-from nautilus_trader.core.string cimport cstr_to_pystr
+from nautilus_trader.core.rust.core cimport uuid4_to_cstr_buf
+from nautilus_trader.core.string cimport CSTR_BUF_LEN
+from nautilus_trader.core.string cimport cstr_buf_to_pystr
 from nautilus_trader.core.string cimport pystr_to_cstr
 
 
@@ -67,7 +68,9 @@ cdef class UUID4:
         return f"{type(self).__name__}('{self}')"
 
     cdef str to_str(self):
-        return cstr_to_pystr(uuid4_to_cstr(&self._mem), False)
+        cdef char buf[CSTR_BUF_LEN]
+        cdef size_t length = uuid4_to_cstr_buf(&self._mem, buf, CSTR_BUF_LEN)
+        return cstr_buf_to_pystr(buf, length)
 
     @property
     def value(self) -> str:
@@ -13,30 +13,54 @@
 #  limitations under the License.
 # -------------------------------------------------------------------------------------------------
 
+from libc.stdint cimport int64_t
 from libc.stdint cimport uint8_t
+from libc.stdint cimport uint32_t
 from libc.stdint cimport uint64_t
 
 from nautilus_trader.core.data cimport Data
+from nautilus_trader.core.rust.model cimport BookManager_API
 from nautilus_trader.core.rust.model cimport BookType
 from nautilus_trader.core.rust.model cimport Level_API
 from nautilus_trader.core.rust.model cimport OrderBook_API
 from nautilus_trader.core.rust.model cimport OrderSide
+from nautilus_trader.core.rust.model cimport TopOfBookHandle_API
 from nautilus_trader.model.data cimport BookOrder
 from nautilus_trader.model.data cimport OrderBookDelta
 from nautilus_trader.model.data cimport OrderBookDeltas
 from nautilus_trader.model.data cimport OrderBookDepth10
 from nautilus_trader.model.data cimport QuoteTick
 from nautilus_trader.model.data cimport TradeTick
+from nautilus_trader.model.identifiers cimport InstrumentId
 from nautilus_trader.model.objects cimport Price
 from nautilus_trader.model.objects cimport Quantity
 from nautilus_trader.model.orders.base cimport Order
 
 
+cdef class TopOfBookHandle:
+    cdef TopOfBookHandle_API _mem
+
+    @staticmethod
+    cdef TopOfBookHandle from_mem_c(TopOfBookHandle_API mem)
+
+    cpdef tuple read(self)
+
+
 cdef class OrderBook(Data):
     cdef OrderBook_API _mem
     cdef BookType _book_type
+    cdef Price _price_increment
+
+    @staticmethod
+    cdef OrderBook_API _new_mem(InstrumentId instrument_id, BookType book_type, Price price_increment)
+    @staticmethod
+    cdef OrderBook from_mem_c(OrderBook_API mem)
+
+    cpdef bytes to_snapshot_bytes(self)
 
     cpdef void reset(self)
+    cpdef void enable_cumulative_depth(self)
+    cpdef void enable_sequencing(self, int capacity)
     cpdef void add(self, BookOrder order, uint64_t ts_event, uint8_t flags=*, uint64_t sequence=*)
     cpdef void update(self, BookOrder order, uint64_t ts_event, uint8_t flags=*, uint64_t sequence=*)
     cpdef void delete(self, BookOrder order, uint64_t ts_event, uint8_t flags=*, uint64_t sequence=*)
@@ -45,16 +69,22 @@ cdef class OrderBook(Data):
     cpdef void clear_asks(self, uint64_t ts_event, uint64_t sequence=*)
     cpdef void apply_delta(self, OrderBookDelta delta)
     cpdef void apply_deltas(self, OrderBookDeltas deltas)
+    cpdef void apply_deltas_from_capsule(self, capsule)
     cpdef void apply_depth(self, OrderBookDepth10 depth)
     cpdef void apply(self, Data data)
     cpdef void check_integrity(self)
 
     cpdef list bids(self)
     cpdef list asks(self)
+    cpdef int bids_depth_into(self, int64_t[::1] prices, uint64_t[::1] sizes, uint32_t[::1] counts)
+    cpdef int asks_depth_into(self, int64_t[::1] prices, uint64_t[::1] sizes, uint32_t[::1] counts)
+    cpdef tuple bids_depth(self, int num_levels)
+    cpdef tuple asks_depth(self, int num_levels)
     cpdef best_bid_price(self)
     cpdef best_ask_price(self)
     cpdef best_bid_size(self)
     cpdef best_ask_size(self)
+    cpdef TopOfBookHandle top_of_book_handle(self)
     cpdef spread(self)
     cpdef midpoint(self)
     cpdef double get_avg_px_for_quantity(self, Quantity quantity, OrderSide order_side)
@@ -74,3 +104,14 @@ cdef class Level:
 
     @staticmethod
     cdef Level from_mem_c(Level_API mem)
+
+
+cdef class BookManager:
+    cdef BookManager_API _mem
+
+    cpdef void add_book(self, OrderBook book)
+    cpdef void apply(self, list data)
+    cpdef void flush(self)
+    cpdef bint has_book(self, InstrumentId instrument_id)
+    cpdef tuple top_of_book(self, InstrumentId instrument_id)
+    cpdef OrderBook snapshot(self, InstrumentId instrument_id)
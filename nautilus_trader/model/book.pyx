@@ -16,26 +16,49 @@
 import pickle
 from operator import itemgetter
 
+import numpy as np
 import pandas as pd
 
+from cpython.mem cimport PyMem_Free
+from cpython.mem cimport PyMem_Malloc
+from cpython.pycapsule cimport PyCapsule_GetPointer
 from libc.stdint cimport INT64_MAX
 from libc.stdint cimport INT64_MIN
 from libc.stdint cimport int64_t
 from libc.stdint cimport uint8_t
+from libc.stdint cimport uint32_t
 from libc.stdint cimport uint64_t
+from libc.stdint cimport uintptr_t
 
 from nautilus_trader.core.correctness cimport Condition
 from nautilus_trader.core.data cimport Data
 from nautilus_trader.core.rust.core cimport CVec
+from nautilus_trader.core.rust.core cimport cvec_drop
+from nautilus_trader.core.rust.model cimport TICK_LADDER_DEFAULT_CAPACITY
 from nautilus_trader.core.rust.model cimport BookAction
+from nautilus_trader.core.rust.model cimport BookManager_API
 from nautilus_trader.core.rust.model cimport BookOrder_t
 from nautilus_trader.core.rust.model cimport BookType
+from nautilus_trader.core.rust.model cimport Data_t
+from nautilus_trader.core.rust.model cimport Data_t_Tag
 from nautilus_trader.core.rust.model cimport Level_API
 from nautilus_trader.core.rust.model cimport OrderBook_API
+from nautilus_trader.core.rust.model cimport OrderBookDelta_t
 from nautilus_trader.core.rust.model cimport OrderSide
 from nautilus_trader.core.rust.model cimport OrderType
 from nautilus_trader.core.rust.model cimport Price_t
 from nautilus_trader.core.rust.model cimport Quantity_t
+from nautilus_trader.core.rust.model cimport TopOfBook_t
+from nautilus_trader.core.rust.model cimport TopOfBookHandle_API
+from nautilus_trader.core.rust.model cimport book_manager_add_book
+from nautilus_trader.core.rust.model cimport book_manager_apply
+from nautilus_trader.core.rust.model cimport book_manager_count
+from nautilus_trader.core.rust.model cimport book_manager_drop
+from nautilus_trader.core.rust.model cimport book_manager_flush
+from nautilus_trader.core.rust.model cimport book_manager_has_book
+from nautilus_trader.core.rust.model cimport book_manager_new
+from nautilus_trader.core.rust.model cimport book_manager_snapshot
+from nautilus_trader.core.rust.model cimport book_manager_top_of_book
 from nautilus_trader.core.rust.model cimport book_order_from_raw
 from nautilus_trader.core.rust.model cimport level_clone
 from nautilus_trader.core.rust.model cimport level_drop
@@ -46,13 +69,16 @@ from nautilus_trader.core.rust.model cimport level_size
 from nautilus_trader.core.rust.model cimport orderbook_add
 from nautilus_trader.core.rust.model cimport orderbook_apply_delta
 from nautilus_trader.core.rust.model cimport orderbook_apply_deltas
+from nautilus_trader.core.rust.model cimport orderbook_apply_deltas_raw
 from nautilus_trader.core.rust.model cimport orderbook_apply_depth
 from nautilus_trader.core.rust.model cimport orderbook_asks
+from nautilus_trader.core.rust.model cimport orderbook_asks_depth
 from nautilus_trader.core.rust.model cimport orderbook_best_ask_price
 from nautilus_trader.core.rust.model cimport orderbook_best_ask_size
 from nautilus_trader.core.rust.model cimport orderbook_best_bid_price
 from nautilus_trader.core.rust.model cimport orderbook_best_bid_size
 from nautilus_trader.core.rust.model cimport orderbook_bids
+from nautilus_trader.core.rust.model cimport orderbook_bids_depth
 from nautilus_trader.core.rust.model cimport orderbook_book_type
 from nautilus_trader.core.rust.model cimport orderbook_check_integrity
 from nautilus_trader.core.rust.model cimport orderbook_clear
@@ -60,23 +86,43 @@ from nautilus_trader.core.rust.model cimport orderbook_clear_asks
 from nautilus_trader.core.rust.model cimport orderbook_clear_bids
 from nautilus_trader.core.rust.model cimport orderbook_count
 from nautilus_trader.core.rust.model cimport orderbook_delete
+from nautilus_trader.core.rust.model cimport orderbook_deltas_clone
+from nautilus_trader.core.rust.model cimport orderbook_deltas_drop
 from nautilus_trader.core.rust.model cimport orderbook_drop
+from nautilus_trader.core.rust.model cimport orderbook_enable_cumulative_depth
+from nautilus_trader.core.rust.model cimport orderbook_enable_sequencing
 from nautilus_trader.core.rust.model cimport orderbook_get_avg_px_for_quantity
 from nautilus_trader.core.rust.model cimport orderbook_get_quantity_for_price
 from nautilus_trader.core.rust.model cimport orderbook_has_ask
 from nautilus_trader.core.rust.model cimport orderbook_has_bid
+from nautilus_trader.core.rust.model cimport orderbook_has_cumulative_depth
 from nautilus_trader.core.rust.model cimport orderbook_instrument_id
+from nautilus_trader.core.rust.model cimport orderbook_is_fixed_depth
+from nautilus_trader.core.rust.model cimport orderbook_is_stale
+from nautilus_trader.core.rust.model cimport orderbook_is_tick_indexed
 from nautilus_trader.core.rust.model cimport orderbook_midpoint
 from nautilus_trader.core.rust.model cimport orderbook_new
+from nautilus_trader.core.rust.model cimport orderbook_new_depth10
+from nautilus_trader.core.rust.model cimport orderbook_new_tick_indexed
 from nautilus_trader.core.rust.model cimport orderbook_pprint_to_cstr
+from nautilus_trader.core.rust.model cimport orderbook_price_increment
 from nautilus_trader.core.rust.model cimport orderbook_reset
+from nautilus_trader.core.rust.model cimport orderbook_restore_from_bytes
+from nautilus_trader.core.rust.model cimport orderbook_restore_many_from_bytes
 from nautilus_trader.core.rust.model cimport orderbook_sequence
+from nautilus_trader.core.rust.model cimport orderbook_sequence_dropped
+from nautilus_trader.core.rust.model cimport orderbook_sequence_gaps
+from nautilus_trader.core.rust.model cimport orderbook_sequence_pending
 from nautilus_trader.core.rust.model cimport orderbook_simulate_fills
+from nautilus_trader.core.rust.model cimport orderbook_snapshot_to_bytes
 from nautilus_trader.core.rust.model cimport orderbook_spread
+from nautilus_trader.core.rust.model cimport orderbook_top_of_book_handle
 from nautilus_trader.core.rust.model cimport orderbook_ts_last
 from nautilus_trader.core.rust.model cimport orderbook_update
 from nautilus_trader.core.rust.model cimport orderbook_update_quote_tick
 from nautilus_trader.core.rust.model cimport orderbook_update_trade_tick
+from nautilus_trader.core.rust.model cimport top_of_book_handle_drop
+from nautilus_trader.core.rust.model cimport top_of_book_handle_read
 from nautilus_trader.core.rust.model cimport vec_fills_drop
 from nautilus_trader.core.rust.model cimport vec_levels_drop
 from nautilus_trader.core.rust.model cimport vec_orders_drop
@@ -97,19 +143,54 @@ from nautilus_trader.model.objects cimport Quantity
 cdef class OrderBook(Data):
     """
     Provides an order book which can handle L1/L2/L3 granularity data.
+
+    Parameters
+    ----------
+    instrument_id : InstrumentId
+        The instrument ID for the book.
+    book_type : BookType
+        The order book type.
+    price_increment : Price, optional
+        The instruments minimum price increment. If provided, each side of the book
+        holds its levels in a tick-indexed array rather than a tree.
+
     """
 
     def __init__(
         self,
         InstrumentId instrument_id not None,
         BookType book_type,
+        Price price_increment = None,
     ) -> None:
         self._book_type = book_type
-        self._mem = orderbook_new(
+        self._price_increment = price_increment
+        self._mem = self._new_mem(instrument_id, book_type, price_increment)
+
+    @staticmethod
+    cdef OrderBook_API _new_mem(InstrumentId instrument_id, BookType book_type, Price price_increment):
+        if price_increment is None:
+            return orderbook_new(
+                instrument_id._mem,
+                book_type,
+            )
+
+        return orderbook_new_tick_indexed(
             instrument_id._mem,
             book_type,
+            price_increment._mem,
+            TICK_LADDER_DEFAULT_CAPACITY,
         )
 
+    @staticmethod
+    cdef OrderBook from_mem_c(OrderBook_API mem):
+        cdef OrderBook book = OrderBook.__new__(OrderBook)
+        book._mem = mem
+        book._book_type = orderbook_book_type(&mem)
+        book._price_increment = None
+        if orderbook_is_tick_indexed(&mem):
+            book._price_increment = Price.from_mem_c(orderbook_price_increment(&mem))
+        return book
+
     def __del__(self) -> None:
         if self._mem._0 != NULL:
             orderbook_drop(self._mem)
@@ -132,15 +213,18 @@ cdef class OrderBook(Data):
             self.ts_last,
             self.sequence,
             pickle.dumps(orders),
+            self._price_increment,
+            self.is_fixed_depth,
         )
 
     def __setstate__(self, state):
         cdef InstrumentId instrument_id = InstrumentId.from_str_c(state[0])
         self._book_type = state[1]
-        self._mem = orderbook_new(
-            instrument_id._mem,
-            state[1],
-        )
+        self._price_increment = state[5]
+        if state[6]:
+            self._mem = orderbook_new_depth10(instrument_id._mem)
+        else:
+            self._mem = OrderBook._new_mem(instrument_id, state[1], state[5])
         cdef int64_t ts_last = state[2]
         cdef int64_t sequence = state[3]
         cdef list orders = pickle.loads(state[4])
@@ -149,6 +233,124 @@ cdef class OrderBook(Data):
         for i in range(len(orders)):
             self.add(orders[i], ts_last, sequence)
 
+    cpdef bytes to_snapshot_bytes(self):
+        """
+        Return a compact, versioned binary snapshot of the order book.
+
+        The snapshot holds both sides of the book with their orders in time priority,
+        along with the sequence, last event timestamp and update count.
+
+        Returns
+        -------
+        bytes
+
+        """
+        cdef CVec raw = orderbook_snapshot_to_bytes(&self._mem)
+        cdef bytes data = (<char *>raw.ptr)[:raw.len]
+        cvec_drop(raw)
+        return data
+
+    @staticmethod
+    def from_snapshot_bytes(bytes data not None) -> OrderBook:
+        """
+        Return an order book restored from the given binary snapshot.
+
+        Parameters
+        ----------
+        data : bytes
+            The snapshot from `to_snapshot_bytes`.
+
+        Returns
+        -------
+        OrderBook
+
+        Raises
+        ------
+        ValueError
+            If `data` is not a valid order book snapshot.
+
+        """
+        cdef OrderBook_API mem
+        if not orderbook_restore_from_bytes(<const uint8_t *><const char *>data, len(data), &mem):
+            raise ValueError("Invalid order book snapshot")
+        return OrderBook.from_mem_c(mem)
+
+    @staticmethod
+    def from_snapshot_bytes_many(list snapshots not None) -> list[OrderBook]:
+        """
+        Return the order books restored from the given binary snapshots.
+
+        The snapshots are restored in parallel across threads.
+
+        Parameters
+        ----------
+        snapshots : list[bytes]
+            The snapshots from `to_snapshot_bytes`.
+
+        Returns
+        -------
+        list[OrderBook]
+            In the same order as `snapshots`.
+
+        Raises
+        ------
+        ValueError
+            If any of `snapshots` is not a valid order book snapshot.
+
+        """
+        cdef uint64_t count = len(snapshots)
+        if count == 0:
+            return []
+
+        # Create temporary arrays to pass the snapshots to Rust
+        cdef const uint8_t **data = <const uint8_t **>PyMem_Malloc(count * sizeof(uint8_t *))
+        cdef uintptr_t *lens = <uintptr_t *>PyMem_Malloc(count * sizeof(uintptr_t))
+        cdef OrderBook_API *books = <OrderBook_API *>PyMem_Malloc(count * sizeof(OrderBook_API))
+        if data == NULL or lens == NULL or books == NULL:
+            PyMem_Free(data)
+            PyMem_Free(lens)
+            PyMem_Free(books)
+            raise MemoryError("Failed to allocate memory for data transfer array")
+
+        cdef uint64_t i
+        cdef bytes snapshot
+        try:
+            for i in range(count):
+                snapshot = snapshots[i]
+                data[i] = <const uint8_t *><const char *>snapshot
+                lens[i] = len(snapshot)
+
+            if not orderbook_restore_many_from_bytes(data, lens, count, books):
+                raise ValueError("Invalid order book snapshot")
+
+            return [OrderBook.from_mem_c(books[i]) for i in range(count)]
+        finally:
+            # Deallocate temporary data transfer arrays
+            PyMem_Free(data)
+            PyMem_Free(lens)
+            PyMem_Free(books)
+
+    @staticmethod
+    def depth10(InstrumentId instrument_id not None) -> OrderBook:
+        """
+        Return an L2 order book which holds the top ten levels of each side in fixed arrays.
+
+        Applying an `OrderBookDepth10` copies its arrays rather than rebuilding the
+        levels. Any add, update or delete moves the levels into ladder storage first, and
+        the next depth snapshot moves the book back into its fixed arrays.
+
+        Parameters
+        ----------
+        instrument_id : InstrumentId
+            The instrument ID for the book.
+
+        Returns
+        -------
+        OrderBook
+
+        """
+        return OrderBook.from_mem_c(orderbook_new_depth10(instrument_id._mem))
+
     @property
     def instrument_id(self) -> InstrumentId:
         """
@@ -233,12 +435,124 @@ cdef class OrderBook(Data):
         """
         return orderbook_count(&self._mem)
 
+    @property
+    def has_cumulative_depth(self) -> bool:
+        """
+        Return whether the cumulative depth index is enabled for the book.
+
+        Returns
+        -------
+        bool
+
+        """
+        return orderbook_has_cumulative_depth(&self._mem)
+
+    @property
+    def is_fixed_depth(self) -> bool:
+        """
+        Return whether the book is in fixed depth mode, loading depth snapshots into
+        fixed MBP-10 arrays.
+
+        The mode is kept while incremental changes hold the levels in ladders.
+
+        Returns
+        -------
+        bool
+
+        """
+        return orderbook_is_fixed_depth(&self._mem)
+
+    @property
+    def is_stale(self) -> bool:
+        """
+        Return whether sequenced ingestion has detected a gap the book has not yet been
+        resynchronized from by a clear delta.
+
+        Returns
+        -------
+        bool
+
+        """
+        return orderbook_is_stale(&self._mem)
+
+    @property
+    def sequence_gaps(self) -> int:
+        """
+        Return the number of sequence gaps detected by sequenced ingestion.
+
+        Returns
+        -------
+        int
+
+        """
+        return orderbook_sequence_gaps(&self._mem)
+
+    @property
+    def sequence_dropped(self) -> int:
+        """
+        Return the number of duplicate or late deltas dropped by sequenced ingestion.
+
+        Returns
+        -------
+        int
+
+        """
+        return orderbook_sequence_dropped(&self._mem)
+
+    @property
+    def sequence_pending(self) -> int:
+        """
+        Return the number of deltas held for reordering by sequenced ingestion.
+
+        Returns
+        -------
+        int
+
+        """
+        return orderbook_sequence_pending(&self._mem)
+
     cpdef void reset(self):
         """
         Reset the order book (clear all stateful values).
         """
         orderbook_reset(&self._mem)
 
+    cpdef void enable_cumulative_depth(self):
+        """
+        Enable the cumulative depth index for the order book.
+
+        Once enabled, `get_avg_px_for_quantity` and `get_quantity_for_price` binary search
+        integer prefix sums of level size and notional, patched as the book changes.
+
+        While a fixed depth book holds its levels in fixed arrays, those queries walk the
+        ten levels directly, and the index serves them once the levels move into ladders.
+
+        """
+        orderbook_enable_cumulative_depth(&self._mem)
+
+    cpdef void enable_sequencing(self, int capacity):
+        """
+        Enable sequenced ingestion of deltas for the order book.
+
+        Deltas are then applied in order of their sequence number, with up to `capacity`
+        held for reordering. When the buffer overflows the missing deltas are counted as
+        a gap and the book is marked stale until a clear delta resynchronizes it.
+
+        Parameters
+        ----------
+        capacity : int
+            The maximum number of out-of-order deltas to hold.
+
+        Raises
+        ------
+        ValueError
+            If `capacity` is negative.
+
+        """
+        Condition.not_negative_int(capacity, "capacity")
+
+        orderbook_enable_sequencing(&self._mem, capacity)
+
     cpdef void add(self, BookOrder order, uint64_t ts_event, uint8_t flags=0, uint64_t sequence=0):
         """
         Add the given order to the book.
@@ -358,6 +672,27 @@ cdef class OrderBook(Data):
 
         orderbook_apply_deltas(&self._mem, &deltas._mem)
 
+    cpdef void apply_deltas_from_capsule(self, capsule):
+        """
+        Apply the bulk deltas held in the given capsule to the order book.
+
+        The capsule must wrap a `CVec` of `OrderBookDelta_t` (as produced by the Rust
+        decoders and data wranglers), which is applied in place without first building
+        `OrderBookDelta` or `OrderBookDeltas` objects.
+
+        Parameters
+        ----------
+        capsule : PyCapsule
+            The capsule holding the deltas to apply.
+
+        """
+        Condition.not_none(capsule, "capsule")
+
+        # SAFETY: Do NOT deallocate the capsule here
+        # It is supposed to be deallocated by the creator
+        cdef CVec* data = <CVec*>PyCapsule_GetPointer(capsule, NULL)
+        orderbook_apply_deltas_raw(&self._mem, <OrderBookDelta_t*>data.ptr, data.len)
+
     cpdef void apply_depth(self, OrderBookDepth10 depth):
         """
         Apply the depth update to the order book.
@@ -455,6 +790,104 @@ cdef class OrderBook(Data):
 
         return levels
 
+    cpdef int bids_depth_into(self, int64_t[::1] prices, uint64_t[::1] sizes, uint32_t[::1] counts):
+        """
+        Write the top bid levels into the given buffers, without allocating.
+
+        Levels are written in descending order of price, up to the length of the
+        shortest buffer.
+
+        Parameters
+        ----------
+        prices : np.ndarray[int64]
+            The buffer for the raw level prices.
+        sizes : np.ndarray[uint64]
+            The buffer for the raw level sizes.
+        counts : np.ndarray[uint32]
+            The buffer for the level order counts.
+
+        Returns
+        -------
+        int
+            The number of levels written.
+
+        """
+        cdef Py_ssize_t length = min(prices.shape[0], sizes.shape[0], counts.shape[0])
+        if length == 0:
+            return 0
+
+        return orderbook_bids_depth(&self._mem, &prices[0], &sizes[0], &counts[0], length)
+
+    cpdef int asks_depth_into(self, int64_t[::1] prices, uint64_t[::1] sizes, uint32_t[::1] counts):
+        """
+        Write the top ask levels into the given buffers, without allocating.
+
+        Levels are written in ascending order of price, up to the length of the
+        shortest buffer.
+
+        Parameters
+        ----------
+        prices : np.ndarray[int64]
+            The buffer for the raw level prices.
+        sizes : np.ndarray[uint64]
+            The buffer for the raw level sizes.
+        counts : np.ndarray[uint32]
+            The buffer for the level order counts.
+
+        Returns
+        -------
+        int
+            The number of levels written.
+
+        """
+        cdef Py_ssize_t length = min(prices.shape[0], sizes.shape[0], counts.shape[0])
+        if length == 0:
+            return 0
+
+        return orderbook_asks_depth(&self._mem, &prices[0], &sizes[0], &counts[0], length)
+
+    cpdef tuple bids_depth(self, int num_levels):
+        """
+        Return the top bid levels as raw price, size and order count arrays.
+
+        Parameters
+        ----------
+        num_levels : int
+            The maximum number of levels to return.
+
+        Returns
+        -------
+        tuple[np.ndarray[int64], np.ndarray[uint64], np.ndarray[uint32]]
+            Sorted in descending order of price.
+
+        """
+        prices = np.empty(num_levels, dtype=np.int64)
+        sizes = np.empty(num_levels, dtype=np.uint64)
+        counts = np.empty(num_levels, dtype=np.uint32)
+        cdef int length = self.bids_depth_into(prices, sizes, counts)
+        return prices[:length], sizes[:length], counts[:length]
+
+    cpdef tuple asks_depth(self, int num_levels):
+        """
+        Return the top ask levels as raw price, size and order count arrays.
+
+        Parameters
+        ----------
+        num_levels : int
+            The maximum number of levels to return.
+
+        Returns
+        -------
+        tuple[np.ndarray[int64], np.ndarray[uint64], np.ndarray[uint32]]
+            Sorted in ascending order of price.
+
+        """
+        prices = np.empty(num_levels, dtype=np.int64)
+        sizes = np.empty(num_levels, dtype=np.uint64)
+        counts = np.empty(num_levels, dtype=np.uint32)
+        cdef int length = self.asks_depth_into(prices, sizes, counts)
+        return prices[:length], sizes[:length], counts[:length]
+
     cpdef best_bid_price(self):
         """
         Return the best bid price in the book (if no bids then returns ``None``).
@@ -511,6 +944,20 @@ cdef class OrderBook(Data):
 
         return Quantity.from_mem_c(orderbook_best_ask_size(&self._mem))
 
+    cpdef TopOfBookHandle top_of_book_handle(self):
+        """
+        Return a handle to the top of book published by the book.
+
+        The first call starts publishing, after which the book publishes a new record
+        whenever its best prices or sizes change.
+
+        Returns
+        -------
+        TopOfBookHandle
+
+        """
+        return TopOfBookHandle.from_mem_c(orderbook_top_of_book_handle(&self._mem))
+
     cpdef spread(self):
         """
         Return the top-of-book spread (if no bids or asks then returns ``None``).
@@ -815,3 +1262,268 @@ cdef class Level:
 
         """
         return level_exposure(&self._mem)
+
+
+cdef class TopOfBookHandle:
+    """
+    Provides a handle to the top of book published by an `OrderBook`.
+
+    Reads do not lock or wait on the book, and the handle remains valid after the
+    book is dropped.
+    """
+
+    def __del__(self) -> None:
+        if self._mem._0 != NULL:
+            top_of_book_handle_drop(self._mem)
+
+    @staticmethod
+    cdef TopOfBookHandle from_mem_c(TopOfBookHandle_API mem):
+        cdef TopOfBookHandle handle = TopOfBookHandle.__new__(TopOfBookHandle)
+        handle._mem = mem
+        return handle
+
+    cpdef tuple read(self):
+        """
+        Return the latest published top of book.
+
+        Returns
+        -------
+        tuple[Price, Quantity, Price, Quantity, int]
+            The best bid price and size, best ask price and size, and sequence.
+
+        """
+        cdef TopOfBook_t top = top_of_book_handle_read(&self._mem)
+        return (
+            Price.from_mem_c(top.bid_price),
+            Quantity.from_mem_c(top.bid_size),
+            Price.from_mem_c(top.ask_price),
+            Quantity.from_mem_c(top.ask_size),
+            top.sequence,
+        )
+
+
+cdef class BookManager:
+    """
+    Provides a set of order books maintained by a pool of worker threads.
+
+    Each instrument is owned by a single worker, so data for different instruments is
+    applied in parallel while data for the same instrument is applied in order.
+
+    Parameters
+    ----------
+    num_workers : int
+        The number of worker threads.
+    book_type : BookType
+        The order book type for books created on first data.
+    pin_workers : bool, default False
+        If each worker thread should be pinned to a CPU core (Linux only).
+
+    Raises
+    ------
+    ValueError
+        If `num_workers` is not positive.
+
+    """
+
+    def __init__(
+        self,
+        int num_workers,
+        BookType book_type,
+        bint pin_workers = False,
+    ) -> None:
+        Condition.positive_int(num_workers, "num_workers")
+        self._mem = book_manager_new(num_workers, book_type, pin_workers)
+
+    def __del__(self) -> None:
+        if self._mem._0 != NULL:
+            book_manager_drop(self._mem)
+
+    @property
+    def count(self) -> int:
+        """
+        Return the number of books held by the manager.
+
+        Returns
+        -------
+        int
+
+        """
+        return book_manager_count(&self._mem)
+
+    cpdef void add_book(self, OrderBook book):
+        """
+        Add a copy of the given book to the manager.
+
+        Replaces any book for the same instrument.
+
+        Parameters
+        ----------
+        book : OrderBook
+            The book to add.
+
+        Raises
+        ------
+        RuntimeError
+            If the worker owning the instrument has stopped.
+
+        """
+        Condition.not_none(book, "book")
+
+        if not book_manager_add_book(&self._mem, &book._mem):
+            raise RuntimeError("Book manager worker has stopped")
+
+    cpdef void apply(self, list data):
+        """
+        Apply the given batch of order book data to the books of the manager.
+
+        Books are created on first data for an instrument. Data other than
+        `OrderBookDelta`, `OrderBookDeltas` and `OrderBookDepth10` is ignored.
+        The GIL is released while waiting on a worker with a full queue.
+
+        Parameters
+        ----------
+        data : list[Data]
+            The data to apply.
+
+        Raises
+        ------
+        RuntimeError
+            If a worker has stopped.
+
+        """
+        Condition.not_none(data, "data")
+
+        cdef uint64_t count = len(data)
+        if count == 0:
+            return
+
+        # Create a temporary array to pass the data to Rust
+        cdef Data_t *raw = <Data_t *>PyMem_Malloc(count * sizeof(Data_t))
+        if raw == NULL:
+            raise MemoryError("Failed to allocate memory for data transfer array")
+
+        cdef uint64_t len_ = 0
+        cdef uint64_t i
+        cdef object item
+        cdef uint8_t success
+        cdef bint transferred = False
+        try:
+            for i in range(count):
+                item = data[i]
+                if isinstance(item, OrderBookDelta):
+                    raw[len_].tag = Data_t_Tag.DELTA
+                    raw[len_].delta = (<OrderBookDelta>item)._mem
+                elif isinstance(item, OrderBookDeltas):
+                    raw[len_].tag = Data_t_Tag.DELTAS
+                    raw[len_].deltas = orderbook_deltas_clone(&(<OrderBookDeltas>item)._mem)
+                elif isinstance(item, OrderBookDepth10):
+                    raw[len_].tag = Data_t_Tag.DEPTH10
+                    raw[len_].depth10 = (<OrderBookDepth10>item)._mem
+                else:
+                    continue
+                len_ += 1
+
+            # Ownership of the elements moves to Rust, which drops the cloned deltas
+            with nogil:
+                success = book_manager_apply(&self._mem, raw, len_)
+            transferred = True
+            if not success:
+                raise RuntimeError("Book manager worker has stopped")
+        finally:
+            if not transferred:
+                # Drop the deltas cloned before an error, as Rust never took ownership
+                for i in range(len_):
+                    if raw[i].tag == Data_t_Tag.DELTAS:
+                        orderbook_deltas_drop(raw[i].deltas)
+            # Deallocate temporary data transfer array
+            PyMem_Free(raw)
+
+    cpdef void flush(self):
+        """
+        Block until all data applied to the manager so far has been processed.
+
+        The GIL is released while waiting.
+
+        Raises
+        ------
+        RuntimeError
+            If a worker has stopped.
+
+        """
+        cdef uint8_t success
+        with nogil:
+            success = book_manager_flush(&self._mem)
+        if not success:
+            raise RuntimeError("Book manager worker has stopped")
+
+    cpdef bint has_book(self, InstrumentId instrument_id):
+        """
+        Return whether the manager holds a book for the given instrument ID.
+
+        Parameters
+        ----------
+        instrument_id : InstrumentId
+            The instrument ID for the book.
+
+        Returns
+        -------
+        bool
+
+        """
+        Condition.not_none(instrument_id, "instrument_id")
+
+        return book_manager_has_book(&self._mem, instrument_id._mem)
+
+    cpdef tuple top_of_book(self, InstrumentId instrument_id):
+        """
+        Return the latest published top of book for the given instrument ID.
+
+        Reads do not wait on the worker applying data to the book.
+
+        Parameters
+        ----------
+        instrument_id : InstrumentId
+            The instrument ID for the book.
+
+        Returns
+        -------
+        tuple[Price, Quantity, Price, Quantity, int] or ``None``
+            The best bid price and size, best ask price and size, and sequence.
+
+        """
+        Condition.not_none(instrument_id, "instrument_id")
+
+        if not book_manager_has_book(&self._mem, instrument_id._mem):
+            return None
+
+        cdef TopOfBook_t top = book_manager_top_of_book(&self._mem, instrument_id._mem)
+        return (
+            Price.from_mem_c(top.bid_price),
+            Quantity.from_mem_c(top.bid_size),
+            Price.from_mem_c(top.ask_price),
+            Quantity.from_mem_c(top.ask_size),
+            top.sequence,
+        )
+
+    cpdef OrderBook snapshot(self, InstrumentId instrument_id):
+        """
+        Return a copy of the book for the given instrument ID.
+
+        The copy is taken after all data applied to the manager so far has been processed.
+
+        Parameters
+        ----------
+        instrument_id : InstrumentId
+            The instrument ID for the book.
+
+        Returns
+        -------
+        OrderBook or ``None``
+
+        """
+        Condition.not_none(instrument_id, "instrument_id")
+
+        cdef OrderBook_API mem
+        if not book_manager_snapshot(&self._mem, instrument_id._mem, &mem):
+            return None
+        return OrderBook.from_mem_c(mem)
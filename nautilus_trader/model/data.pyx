@@ -62,6 +62,7 @@ from nautilus_trader.core.rust.model cimport bar_specification_lt
 from nautilus_trader.core.rust.model cimport bar_specification_new
 from nautilus_trader.core.rust.model cimport bar_specification_to_cstr
 from nautilus_trader.core.rust.model cimport bar_to_cstr
+from nautilus_trader.core.rust.model cimport bar_to_cstr_buf
 from nautilus_trader.core.rust.model cimport bar_type_aggregation_source
 from nautilus_trader.core.rust.model cimport bar_type_check_parsing
 from nautilus_trader.core.rust.model cimport bar_type_composite
@@ -112,13 +113,17 @@ from nautilus_trader.core.rust.model cimport quote_tick_eq
 from nautilus_trader.core.rust.model cimport quote_tick_hash
 from nautilus_trader.core.rust.model cimport quote_tick_new
 from nautilus_trader.core.rust.model cimport quote_tick_to_cstr
+from nautilus_trader.core.rust.model cimport quote_tick_to_cstr_buf
 from nautilus_trader.core.rust.model cimport symbol_new
 from nautilus_trader.core.rust.model cimport trade_id_new
 from nautilus_trader.core.rust.model cimport trade_tick_eq
 from nautilus_trader.core.rust.model cimport trade_tick_hash
 from nautilus_trader.core.rust.model cimport trade_tick_new
 from nautilus_trader.core.rust.model cimport trade_tick_to_cstr
+from nautilus_trader.core.rust.model cimport trade_tick_to_cstr_buf
 from nautilus_trader.core.rust.model cimport venue_new
+from nautilus_trader.core.string cimport CSTR_BUF_LEN
+from nautilus_trader.core.string cimport cstr_buf_to_pystr
 from nautilus_trader.core.string cimport cstr_to_pystr
 from nautilus_trader.core.string cimport pystr_to_cstr
 from nautilus_trader.core.string cimport ustr_to_pystr
@@ -1039,7 +1044,11 @@ cdef class Bar(Data):
         return hash(self.to_str())
 
     cdef str to_str(self):
-        return cstr_to_pystr(bar_to_cstr(&self._mem))
+        cdef char buf[CSTR_BUF_LEN]
+        cdef size_t length = bar_to_cstr_buf(&self._mem, buf, CSTR_BUF_LEN)
+        if length < CSTR_BUF_LEN:
+            return cstr_buf_to_pystr(buf, length)
+        return cstr_to_pystr(bar_to_cstr(&self._mem))  # Too long for the stack buffer
 
     def __str__(self) -> str:
         return self.to_str()
@@ -3655,7 +3664,11 @@ cdef class QuoteTick(Data):
         return f"{type(self).__name__}({self})"
 
     cdef str to_str(self):
-        return cstr_to_pystr(quote_tick_to_cstr(&self._mem))
+        cdef char buf[CSTR_BUF_LEN]
+        cdef size_t length = quote_tick_to_cstr_buf(&self._mem, buf, CSTR_BUF_LEN)
+        if length < CSTR_BUF_LEN:
+            return cstr_buf_to_pystr(buf, length)
+        return cstr_to_pystr(quote_tick_to_cstr(&self._mem))  # Too long for the stack buffer
 
     @property
     def instrument_id(self) -> InstrumentId:
@@ -4260,7 +4273,11 @@ cdef class TradeTick(Data):
         return f"{type(self).__name__}({self.to_str()})"
 
     cdef str to_str(self):
-        return cstr_to_pystr(trade_tick_to_cstr(&self._mem))
+        cdef char buf[CSTR_BUF_LEN]
+        cdef size_t length = trade_tick_to_cstr_buf(&self._mem, buf, CSTR_BUF_LEN)
+        if length < CSTR_BUF_LEN:
+            return cstr_buf_to_pystr(buf, length)
+        return cstr_to_pystr(trade_tick_to_cstr(&self._mem))  # Too long for the stack buffer
 
     @property
     def instrument_id(self) -> InstrumentId:
@@ -76,7 +76,7 @@ cpdef AccountType account_type_from_str(str value):
 
 
 cpdef str account_type_to_str(AccountType value):
-    return cstr_to_pystr(account_type_to_cstr(value))
+    return cstr_to_pystr(account_type_to_cstr(value), False)
 
 
 cpdef AggregationSource aggregation_source_from_str(str value):
@@ -84,7 +84,7 @@ cpdef AggregationSource aggregation_source_from_str(str value):
 
 
 cpdef str aggregation_source_to_str(AggregationSource value):
-    return cstr_to_pystr(aggregation_source_to_cstr(value))
+    return cstr_to_pystr(aggregation_source_to_cstr(value), False)
 
 
 cpdef AggressorSide aggressor_side_from_str(str value):
@@ -92,7 +92,7 @@ cpdef AggressorSide aggressor_side_from_str(str value):
 
 
 cpdef str aggressor_side_to_str(AggressorSide value):
-    return cstr_to_pystr(aggressor_side_to_cstr(value))
+    return cstr_to_pystr(aggressor_side_to_cstr(value), False)
 
 
 cpdef AssetClass asset_class_from_str(str value):
@@ -100,7 +100,7 @@ cpdef AssetClass asset_class_from_str(str value):
 
 
 cpdef str asset_class_to_str(AssetClass value):
-    return cstr_to_pystr(asset_class_to_cstr(value))
+    return cstr_to_pystr(asset_class_to_cstr(value), False)
 
 
 cpdef InstrumentClass instrument_class_from_str(str value):
@@ -108,7 +108,7 @@ cpdef InstrumentClass instrument_class_from_str(str value):
 
 
 cpdef str instrument_class_to_str(InstrumentClass value):
-    return cstr_to_pystr(instrument_class_to_cstr(value))
+    return cstr_to_pystr(instrument_class_to_cstr(value), False)
 
 
 cpdef BarAggregation bar_aggregation_from_str(str value):
@@ -116,7 +116,7 @@ cpdef BarAggregation bar_aggregation_from_str(str value):
 
 
 cpdef str bar_aggregation_to_str(BarAggregation value):
-    return cstr_to_pystr(bar_aggregation_to_cstr(<uint8_t>value))
+    return cstr_to_pystr(bar_aggregation_to_cstr(<uint8_t>value), False)
 
 
 cpdef BookAction book_action_from_str(str value):
@@ -124,7 +124,7 @@ cpdef BookAction book_action_from_str(str value):
 
 
 cpdef str book_action_to_str(BookAction value):
-    return cstr_to_pystr(book_action_to_cstr(value))
+    return cstr_to_pystr(book_action_to_cstr(value), False)
 
 
 cpdef BookType book_type_from_str(str value):
@@ -132,7 +132,7 @@ cpdef BookType book_type_from_str(str value):
 
 
 cpdef str book_type_to_str(BookType value):
-    return cstr_to_pystr(book_type_to_cstr(value))
+    return cstr_to_pystr(book_type_to_cstr(value), False)
 
 
 cpdef ContingencyType contingency_type_from_str(str value):
@@ -140,7 +140,7 @@ cpdef ContingencyType contingency_type_from_str(str value):
 
 
 cpdef str contingency_type_to_str(ContingencyType value):
-    return cstr_to_pystr(contingency_type_to_cstr(value))
+    return cstr_to_pystr(contingency_type_to_cstr(value), False)
 
 
 cpdef CurrencyType currency_type_from_str(str value):
@@ -148,7 +148,7 @@ cpdef CurrencyType currency_type_from_str(str value):
 
 
 cpdef str currency_type_to_str(CurrencyType value):
-    return cstr_to_pystr(currency_type_to_cstr(value))
+    return cstr_to_pystr(currency_type_to_cstr(value), False)
 
 
 cpdef InstrumentCloseType instrument_close_type_from_str(str value):
@@ -156,7 +156,7 @@ cpdef InstrumentCloseType instrument_close_type_from_str(str value):
 
 
 cpdef str instrument_close_type_to_str(InstrumentCloseType value):
-    return cstr_to_pystr(instrument_close_type_to_cstr(value))
+    return cstr_to_pystr(instrument_close_type_to_cstr(value), False)
 
 
 cpdef LiquiditySide liquidity_side_from_str(str value):
@@ -164,7 +164,7 @@ cpdef LiquiditySide liquidity_side_from_str(str value):
 
 
 cpdef str liquidity_side_to_str(LiquiditySide value):
-    return cstr_to_pystr(liquidity_side_to_cstr(value))
+    return cstr_to_pystr(liquidity_side_to_cstr(value), False)
 
 
 cpdef MarketStatus market_status_from_str(str value):
@@ -172,7 +172,7 @@ cpdef MarketStatus market_status_from_str(str value):
 
 
 cpdef str market_status_to_str(MarketStatus value):
-    return cstr_to_pystr(market_status_to_cstr(value))
+    return cstr_to_pystr(market_status_to_cstr(value), False)
 
 
 cpdef MarketStatusAction market_status_action_from_str(str value):
@@ -180,7 +180,7 @@ cpdef MarketStatusAction market_status_action_from_str(str value):
 
 
 cpdef str market_status_action_to_str(MarketStatusAction value):
-    return cstr_to_pystr(market_status_action_to_cstr(value))
+    return cstr_to_pystr(market_status_action_to_cstr(value), False)
 
 
 cpdef OmsType oms_type_from_str(str value):
@@ -188,7 +188,7 @@ cpdef OmsType oms_type_from_str(str value):
 
 
 cpdef str oms_type_to_str(OmsType value):
-    return cstr_to_pystr(oms_type_to_cstr(value))
+    return cstr_to_pystr(oms_type_to_cstr(value), False)
 
 
 cpdef OptionKind option_kind_from_str(str value):
@@ -196,7 +196,7 @@ cpdef OptionKind option_kind_from_str(str value):
 
 
 cpdef str option_kind_to_str(OptionKind value):
-    return cstr_to_pystr(option_kind_to_cstr(value))
+    return cstr_to_pystr(option_kind_to_cstr(value), False)
 
 
 cpdef OrderSide order_side_from_str(str value):
@@ -204,7 +204,7 @@ cpdef OrderSide order_side_from_str(str value):
 
 
 cpdef str order_side_to_str(OrderSide value):
-    return cstr_to_pystr(order_side_to_cstr(value))
+    return cstr_to_pystr(order_side_to_cstr(value), False)
 
 
 cpdef OrderStatus order_status_from_str(str value):
@@ -212,7 +212,7 @@ cpdef OrderStatus order_status_from_str(str value):
 
 
 cpdef str order_status_to_str(OrderStatus value):
-    return cstr_to_pystr(order_status_to_cstr(value))
+    return cstr_to_pystr(order_status_to_cstr(value), False)
 
 
 cpdef OrderType order_type_from_str(str value):
@@ -220,7 +220,7 @@ cpdef OrderType order_type_from_str(str value):
 
 
 cpdef str order_type_to_str(OrderType value):
-    return cstr_to_pystr(order_type_to_cstr(value))
+    return cstr_to_pystr(order_type_to_cstr(value), False)
 
 
 cpdef RecordFlag record_flag_from_str(str value):
@@ -228,7 +228,7 @@ cpdef RecordFlag record_flag_from_str(str value):
 
 
 cpdef str record_flag_to_str(RecordFlag value):
-    return cstr_to_pystr(record_flag_to_cstr(value))
+    return cstr_to_pystr(record_flag_to_cstr(value), False)
 
 
 cpdef PositionSide position_side_from_str(str value):
@@ -236,7 +236,7 @@ cpdef PositionSide position_side_from_str(str value):
 
 
 cpdef str position_side_to_str(PositionSide value):
-    return cstr_to_pystr(position_side_to_cstr(value))
+    return cstr_to_pystr(position_side_to_cstr(value), False)
 
 
 cpdef PriceType price_type_from_str(str value):
@@ -244,7 +244,7 @@ cpdef PriceType price_type_from_str(str value):
 
 
 cpdef str price_type_to_str(PriceType value):
-    return cstr_to_pystr(price_type_to_cstr(value))
+    return cstr_to_pystr(price_type_to_cstr(value), False)
 
 
 cpdef TimeInForce time_in_force_from_str(str value):
@@ -252,7 +252,7 @@ cpdef TimeInForce time_in_force_from_str(str value):
 
 
 cpdef str time_in_force_to_str(TimeInForce value):
-    return cstr_to_pystr(time_in_force_to_cstr(value))
+    return cstr_to_pystr(time_in_force_to_cstr(value), False)
 
 
 cpdef TradingState trading_state_from_str(str value):
@@ -260,7 +260,7 @@ cpdef TradingState trading_state_from_str(str value):
 
 
 cpdef str trading_state_to_str(TradingState value):
-    return cstr_to_pystr(trading_state_to_cstr(value))
+    return cstr_to_pystr(trading_state_to_cstr(value), False)
 
 
 cpdef TrailingOffsetType trailing_offset_type_from_str(str value):
@@ -268,7 +268,7 @@ cpdef TrailingOffsetType trailing_offset_type_from_str(str value):
 
 
 cpdef str trailing_offset_type_to_str(TrailingOffsetType value):
-    return cstr_to_pystr(trailing_offset_type_to_cstr(value))
+    return cstr_to_pystr(trailing_offset_type_to_cstr(value), False)
 
 
 cpdef TriggerType trigger_type_from_str(str value):
@@ -276,4 +276,4 @@ cpdef TriggerType trigger_type_from_str(str value):
 
 
 cpdef str trigger_type_to_str(TriggerType value):
-    return cstr_to_pystr(trigger_type_to_cstr(value))
+    return cstr_to_pystr(trigger_type_to_cstr(value), False)
@@ -13,6 +13,8 @@
 #  limitations under the License.
 # -------------------------------------------------------------------------------------------------
 
+from cpython.mem cimport PyMem_Free
+from cpython.mem cimport PyMem_Malloc
 from libc.string cimport strcmp
 
 from nautilus_trader.core.correctness cimport Condition
@@ -32,7 +34,11 @@ from nautilus_trader.core.rust.model cimport instrument_id_hash
 from nautilus_trader.core.rust.model cimport instrument_id_is_synthetic
 from nautilus_trader.core.rust.model cimport instrument_id_new
 from nautilus_trader.core.rust.model cimport instrument_id_to_cstr
+from nautilus_trader.core.rust.model cimport instrument_id_to_cstr_buf
 from nautilus_trader.core.rust.model cimport interned_string_stats
+from nautilus_trader.core.rust.model cimport interner_preload
+from nautilus_trader.core.rust.model cimport interner_stats_get
+from nautilus_trader.core.rust.model cimport interner_stats_reset
 from nautilus_trader.core.rust.model cimport order_list_id_hash
 from nautilus_trader.core.rust.model cimport order_list_id_new
 from nautilus_trader.core.rust.model cimport position_id_hash
@@ -44,6 +50,7 @@ from nautilus_trader.core.rust.model cimport symbol_is_composite
 from nautilus_trader.core.rust.model cimport symbol_new
 from nautilus_trader.core.rust.model cimport symbol_root
 from nautilus_trader.core.rust.model cimport symbol_topic
+from nautilus_trader.core.rust.model cimport trade_id_eq
 from nautilus_trader.core.rust.model cimport trade_id_hash
 from nautilus_trader.core.rust.model cimport trade_id_new
 from nautilus_trader.core.rust.model cimport trade_id_to_cstr
@@ -56,6 +63,8 @@ from nautilus_trader.core.rust.model cimport venue_is_synthetic
 from nautilus_trader.core.rust.model cimport venue_new
 from nautilus_trader.core.rust.model cimport venue_order_id_hash
 from nautilus_trader.core.rust.model cimport venue_order_id_new
+from nautilus_trader.core.string cimport CSTR_BUF_LEN
+from nautilus_trader.core.string cimport cstr_buf_to_pystr
 from nautilus_trader.core.string cimport cstr_to_pystr
 from nautilus_trader.core.string cimport pystr_to_cstr
 from nautilus_trader.core.string cimport ustr_to_pystr
@@ -341,7 +350,7 @@ cdef class InstrumentId(Identifier):
         return strcmp(self._mem.symbol._0, other._mem.symbol._0) == 0 and strcmp(self._mem.venue._0, other._mem.venue._0) == 0
 
     def __hash__(self) -> int:
-        return hash(self.to_str())
+        return instrument_id_hash(&self._mem)
 
     @staticmethod
     cdef InstrumentId from_mem_c(InstrumentId_t mem):
@@ -362,7 +371,11 @@ cdef class InstrumentId(Identifier):
         return instrument_id
 
     cdef str to_str(self):
-        return cstr_to_pystr(instrument_id_to_cstr(&self._mem))
+        cdef char buf[CSTR_BUF_LEN]
+        cdef size_t length = instrument_id_to_cstr_buf(&self._mem, buf, CSTR_BUF_LEN)
+        if length < CSTR_BUF_LEN:
+            return cstr_buf_to_pystr(buf, length)
+        return cstr_to_pystr(instrument_id_to_cstr(&self._mem))  # Too long for the stack buffer
 
     @staticmethod
     def from_str(value: str) -> InstrumentId:
@@ -995,10 +1008,10 @@ cdef class TradeId(Identifier):
     def __eq__(self, TradeId other) -> bool:
         if other is None:
             raise RuntimeError("other was None in __eq__")
-        return strcmp(trade_id_to_cstr(&self._mem), trade_id_to_cstr(&other._mem)) == 0
+        return trade_id_eq(&self._mem, &other._mem)
 
     def __hash__(self) -> int:
-        return hash(self.to_str())
+        return trade_id_hash(&self._mem)
 
     @staticmethod
     cdef TradeId from_mem_c(TradeId_t mem):
@@ -1008,3 +1021,58 @@ cdef class TradeId(Identifier):
 
     cdef str to_str(self):
         return cstr_to_pystr(trade_id_to_cstr(&self._mem), False)
+
+
+def interner_stats() -> dict[str, int]:
+    """
+    Return a snapshot of the global identifier string interner statistics.
+
+    Returns
+    -------
+    dict[str, int]
+
+    """
+    return interner_stats_get()
+
+
+def interner_reset_stats() -> None:
+    """
+    Reset the global identifier string interner counters to zero.
+    """
+    interner_stats_reset()
+
+
+def intern_strings(list values not None) -> int:
+    """
+    Intern each of the given strings in turn.
+
+    Use this to preload the identifier values (such as symbols and venues) of a large
+    instrument universe before constructing the identifiers themselves.
+
+    Parameters
+    ----------
+    values : list[str]
+        The strings to intern.
+
+    Returns
+    -------
+    int
+        The number of strings newly added to the interner.
+
+    """
+    cdef Py_ssize_t count = len(values)
+    if count == 0:
+        return 0
+
+    cdef const char **ptrs = <const char **>PyMem_Malloc(count * sizeof(const char *))
+    if ptrs == NULL:
+        raise MemoryError()
+
+    cdef Py_ssize_t i
+    try:
+        for i in range(count):
+            # Pointers borrow the cached UTF-8 of each string, kept alive by `values`
+            ptrs[i] = pystr_to_cstr(values[i])
+        return interner_preload(ptrs, count)
+    finally:
+        PyMem_Free(ptrs)
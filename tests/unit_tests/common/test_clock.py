@@ -507,6 +507,39 @@ class TestTestClock:
         assert "TEST_ALERT3" in event_names
         assert clock.timer_count == 0
 
+    def test_next_event_time_ns_with_no_timers_returns_zero(self):
+        # Arrange
+        clock = TestClock()
+
+        # Act, Assert
+        assert clock.next_event_time_ns() == 0
+
+    def test_next_event_time_ns_returns_earliest_timer(self):
+        # Arrange
+        clock = TestClock()
+        interval = timedelta(minutes=1)
+        clock.set_timer(
+            name="TEST_TIMER",
+            interval=interval,
+            start_time=UNIX_EPOCH,
+            stop_time=None,
+            callback=[].append,
+        )
+        clock.set_time_alert_ns(
+            name="TEST_ALERT",
+            alert_time_ns=30_000_000_000,
+            callback=[].append,
+        )
+
+        # Act
+        first = clock.next_event_time_ns()
+        clock.advance_time(first)
+        second = clock.next_event_time_ns()
+
+        # Assert
+        assert first == 30_000_000_000
+        assert second == 60_000_000_000
+
     def test_advance_time_with_set_timer_triggers_events(self):
         # Arrange
         clock = TestClock()
@@ -531,6 +564,73 @@ class TestTestClock:
         assert clock.timer_names == ["TEST_TIMER"]
         assert clock.timer_count == 1
 
+    def test_advance_time_and_dispatch_calls_handlers_in_order(self):
+        # Arrange
+        clock = TestClock()
+        handler = []
+        clock.set_timer(
+            name="TEST_TIMER1",
+            interval=timedelta(minutes=1),
+            start_time=UNIX_EPOCH,
+            stop_time=None,
+            callback=handler.append,
+        )
+        clock.set_timer(
+            name="TEST_TIMER2",
+            interval=timedelta(seconds=90),
+            start_time=UNIX_EPOCH,
+            stop_time=None,
+            callback=handler.append,
+        )
+
+        # Act
+        count = clock.advance_time_and_dispatch(3 * 60 * 1_000_000_000)
+
+        # Assert
+        assert count == 5
+        assert [(e.name, e.ts_event) for e in handler] == [
+            ("TEST_TIMER1", 60_000_000_000),
+            ("TEST_TIMER2", 90_000_000_000),
+            ("TEST_TIMER1", 120_000_000_000),
+            ("TEST_TIMER1", 180_000_000_000),
+            ("TEST_TIMER2", 180_000_000_000),
+        ]
+        assert clock.timestamp_ns() == 3 * 60 * 1_000_000_000
+
+    def test_advance_time_and_dispatch_when_callback_raises_dispatches_remaining(self):
+        # Arrange
+        clock = TestClock()
+        handler = []
+
+        def raise_error(event):
+            raise RuntimeError(f"Error handling {event.name}")
+
+        clock.set_timer(
+            name="TEST_TIMER1",
+            interval=timedelta(minutes=1),
+            start_time=UNIX_EPOCH,
+            stop_time=None,
+            callback=raise_error,
+        )
+        clock.set_timer(
+            name="TEST_TIMER2",
+            interval=timedelta(seconds=90),
+            start_time=UNIX_EPOCH,
+            stop_time=None,
+            callback=handler.append,
+        )
+
+        # Act
+        with pytest.raises(RuntimeError, match="TEST_TIMER1"):
+            clock.advance_time_and_dispatch(3 * 60 * 1_000_000_000)
+
+        # Assert
+        assert [(e.name, e.ts_event) for e in handler] == [
+            ("TEST_TIMER2", 90_000_000_000),
+            ("TEST_TIMER2", 180_000_000_000),
+        ]
+        assert clock.timestamp_ns() == 3 * 60 * 1_000_000_000
+
     def test_advance_time_with_multiple_set_timers_triggers_events(self):
         # Arrange
         clock = TestClock()
@@ -14,14 +14,18 @@
 # -------------------------------------------------------------------------------------------------
 
 import pickle
+from datetime import timedelta
 
 import pytest
 
+from nautilus_trader.common.component import TestClock
 from nautilus_trader.common.component import TimeEvent
+from nautilus_trader.common.component import timer_id_for_name
 from nautilus_trader.common.enums import ComponentState
 from nautilus_trader.common.messages import ComponentStateChanged
 from nautilus_trader.common.messages import TradingStateChanged
 from nautilus_trader.config import ActorConfig
+from nautilus_trader.core.datetime import millis_to_nanos
 from nautilus_trader.core.uuid import UUID4
 from nautilus_trader.model.enums import TradingState
 from nautilus_trader.model.identifiers import ComponentId
@@ -75,6 +79,58 @@ class TestCommonEvents:
 
         # Assert
         assert event == unpickled
+        assert unpickled.timer_id == event.timer_id
+
+    def test_time_event_not_from_recurring_timer_has_no_timer_id(self):
+        # Arrange, Act
+        event = TimeEvent("TIMER_ID_1", UUID4(), 1, 1)
+
+        # Assert
+        assert event.timer_id is None
+        assert event.name == "TIMER_ID_1"
+
+    def test_recurring_timer_events_share_timer_id(self):
+        # Arrange
+        clock = TestClock()
+        clock.register_default_handler(lambda e: None)
+        clock.set_timer("TIMER_ID_2", timedelta(milliseconds=100))
+        clock.set_timer("TIMER_ID_3", timedelta(milliseconds=100))
+
+        # Act
+        events = [handler.event for handler in clock.advance_time(millis_to_nanos(200))]
+
+        # Assert
+        timer_ids = {event.name: event.timer_id for event in events}
+        assert len(events) == 4
+        assert events[0].timer_id is not None
+        assert timer_ids["TIMER_ID_2"] != timer_ids["TIMER_ID_3"]
+        assert all(event.timer_id == timer_ids[event.name] for event in events)
+        assert timer_ids["TIMER_ID_2"] == timer_id_for_name("TIMER_ID_2")
+
+    def test_timer_id_for_unknown_name_does_not_register(self):
+        # Arrange
+        name = "TIMER_ID_UNKNOWN"
+
+        # Act
+        result = timer_id_for_name(name)
+
+        # Assert
+        assert result is None
+        assert timer_id_for_name(name) is None
+
+    def test_time_alert_events_have_no_timer_id(self):
+        # Arrange
+        clock = TestClock()
+        clock.register_default_handler(lambda e: None)
+        clock.set_time_alert_ns("TIMER_ID_ALERT", millis_to_nanos(100))
+
+        # Act
+        events = clock.advance_time(millis_to_nanos(100))
+
+        # Assert
+        assert len(events) == 1
+        assert events[0].event.timer_id is None
+        assert events[0].event.name == "TIMER_ID_ALERT"
 
     def test_component_state_changed(self):
         # Arrange
@@ -37,6 +37,7 @@ from nautilus_trader.core.datetime import nanos_to_secs
 from nautilus_trader.core.datetime import secs_to_millis
 from nautilus_trader.core.datetime import secs_to_nanos
 from nautilus_trader.core.datetime import unix_nanos_to_dt
+from nautilus_trader.core.datetime import unix_nanos_to_iso8601
 from nautilus_trader.test_kit.stubs.data import UNIX_EPOCH
 
 
@@ -330,6 +331,22 @@ class TestDatetimeFunctions:
         assert result4 == "1970-01-01T00:00:01.000Z"
         assert result5 == "1970-01-01T01:01:02.003Z"
 
+    @pytest.mark.parametrize(
+        ("value", "expected"),
+        [
+            [0, "1970-01-01T00:00:00.000000000Z"],
+            [1, "1970-01-01T00:00:00.000000001Z"],
+            [951_782_400_000_000_000, "2000-02-29T00:00:00.000000000Z"],
+            [1_709_251_200_123_456_789, "2024-03-01T00:00:00.123456789Z"],
+        ],
+    )
+    def test_unix_nanos_to_iso8601(self, value, expected):
+        # Arrange, Act
+        result = unix_nanos_to_iso8601(value)
+
+        # Assert
+        assert result == expected
+
     def test_datetime_and_pd_timestamp_equality(self):
         # Arrange
         timestamp1 = datetime(1970, 1, 1, 0, 0, 0, 0)
@@ -24,6 +24,8 @@ from nautilus_trader.model.identifiers import Symbol
 from nautilus_trader.model.identifiers import TradeId
 from nautilus_trader.model.identifiers import TraderId
 from nautilus_trader.model.identifiers import Venue
+from nautilus_trader.model.identifiers import intern_strings
+from nautilus_trader.model.identifiers import interner_stats
 
 
 def test_trader_identifier() -> None:
@@ -253,6 +255,18 @@ def test_instrument_id_from_str() -> None:
     assert result == instrument_id
 
 
+def test_instrument_id_hash_matches_for_equal_ids() -> None:
+    # Arrange
+    instrument_id1 = InstrumentId(Symbol("AUD/USD"), Venue("SIM"))
+    instrument_id2 = InstrumentId.from_str("AUD/USD.SIM")
+    instrument_id3 = InstrumentId(Symbol("GBP/USD"), Venue("SIM"))
+
+    # Act, Assert
+    assert hash(instrument_id1) == hash(instrument_id2)
+    assert hash(instrument_id1) != hash(instrument_id3)
+    assert {instrument_id1: 1}[instrument_id2] == 1
+
+
 @pytest.mark.parametrize(
     ("input", "expected_err"),
     [
@@ -296,3 +310,53 @@ def test_trade_id_maximum_length() -> None:
     # Arrange, Act, Assert
     with pytest.raises(ValueError):
         TradeId("A" * 37)
+
+
+@pytest.mark.parametrize(
+    "value",
+    [
+        "0",
+        "1234567890",
+        "0123",
+        "T-123456",
+        "c1d3a9e2-7b64-4f1e-9a5c-0d2f6e8b7a91",
+    ],
+)
+def test_trade_id_encodings_round_trip(value: str) -> None:
+    # Arrange
+    trade_id = TradeId(value)
+
+    # Act
+    unpickled = pickle.loads(pickle.dumps(trade_id))  # noqa: S301 (pickle is safe here)
+
+    # Assert
+    assert str(trade_id) == value
+    assert trade_id == TradeId(value)
+    assert hash(trade_id) == hash(TradeId(value))
+    assert unpickled == trade_id
+
+
+def test_intern_strings_preloads_and_counts() -> None:
+    # Arrange
+    values = ["INTERN-TEST-1", "INTERN-TEST-2", "INTERN-TEST-1"]
+    before = interner_stats()
+
+    # Act
+    inserted = intern_strings(values)
+    again = intern_strings(values)
+    Symbol("INTERN-TEST-1")
+    after = interner_stats()
+
+    # Assert
+    assert inserted == 2
+    assert again == 0
+    assert after["entries"] >= before["entries"] + 2
+    assert after["bulk_calls"] == before["bulk_calls"] + 2
+    assert after["bulk_strings"] == before["bulk_strings"] + 6
+    assert after["bulk_inserts"] == before["bulk_inserts"] + 2
+    assert after["lookups"] > before["lookups"]
+
+
+def test_intern_strings_with_empty_list() -> None:
+    # Arrange, Act, Assert
+    assert intern_strings([]) == 0
@@ -16,10 +16,12 @@
 import copy
 import pickle
 
+import numpy as np
 import pandas as pd
 import pytest
 
 from nautilus_trader.adapters.databento.loaders import DatabentoDataLoader
+from nautilus_trader.model.book import BookManager
 from nautilus_trader.model.book import OrderBook
 from nautilus_trader.model.data import BookOrder
 from nautilus_trader.model.data import OrderBookDelta
@@ -100,6 +102,144 @@ class TestOrderBook:
             book.apply_delta(update)
             copy.deepcopy(book)
 
+    def test_snapshot_round_trip(self):
+        # Arrange
+        data = self.sample_book.to_snapshot_bytes()
+
+        # Act
+        book = OrderBook.from_snapshot_bytes(data)
+
+        # Assert
+        assert book.instrument_id == self.sample_book.instrument_id
+        assert book.book_type == BookType.L3_MBO
+        assert book.sequence == self.sample_book.sequence
+        assert book.ts_last == self.sample_book.ts_last
+        assert book.count == self.sample_book.count
+        assert book.pprint(10) == self.sample_book.pprint(10)
+        assert book.to_snapshot_bytes() == data
+
+    def test_from_snapshot_bytes_many(self):
+        # Arrange
+        snapshots = [self.sample_book.to_snapshot_bytes(), self.empty_book.to_snapshot_bytes()]
+
+        # Act
+        books = OrderBook.from_snapshot_bytes_many(snapshots)
+
+        # Assert
+        assert len(books) == 2
+        assert books[0].best_bid_price() == self.sample_book.best_bid_price()
+        assert books[0].best_ask_price() == self.sample_book.best_ask_price()
+        assert books[1].book_type == BookType.L2_MBP
+        assert books[1].best_bid_price() is None
+
+    def test_snapshot_round_trip_preserves_price_increment(self):
+        # Arrange
+        book = OrderBook(
+            instrument_id=self.instrument.id,
+            book_type=BookType.L2_MBP,
+            price_increment=Price.from_str("0.00001"),
+        )
+
+        # Act
+        restored = OrderBook.from_snapshot_bytes(book.to_snapshot_bytes())
+        unpickled = pickle.loads(pickle.dumps(restored))  # noqa: S301 (pickle is safe here)
+
+        # Assert
+        assert restored.to_snapshot_bytes() == book.to_snapshot_bytes()
+        assert unpickled.to_snapshot_bytes() == book.to_snapshot_bytes()
+
+    @pytest.mark.parametrize(
+        "data",
+        [
+            b"",
+            b"NOPE",
+            b"NTOB\x02",
+        ],
+    )
+    def test_from_snapshot_bytes_with_invalid_data_raises_value_error(self, data: bytes):
+        # Arrange, Act, Assert
+        with pytest.raises(ValueError):
+            OrderBook.from_snapshot_bytes(data)
+
+    def test_from_snapshot_bytes_many_with_truncated_snapshot_raises_value_error(self):
+        # Arrange
+        data = self.sample_book.to_snapshot_bytes()
+        snapshots = [data, data[:-1]]
+
+        # Act, Assert
+        with pytest.raises(ValueError):
+            OrderBook.from_snapshot_bytes_many(snapshots)
+
+    def test_depth10_book_matches_l2_book(self):
+        # Arrange
+        depth = TestDataStubs.order_book_depth10()
+        book = OrderBook.depth10(depth.instrument_id)
+        expected = OrderBook(depth.instrument_id, BookType.L2_MBP)
+
+        # Act
+        book.apply_depth(depth)
+        expected.apply_depth(depth)
+
+        # Assert
+        assert book.is_fixed_depth
+        assert book.book_type == BookType.L2_MBP
+        assert book.count == expected.count
+        assert book.spread() == expected.spread()
+        assert book.midpoint() == expected.midpoint()
+        assert book.get_avg_px_for_quantity(
+            Quantity.from_int(500),
+            OrderSide.BUY,
+        ) == expected.get_avg_px_for_quantity(Quantity.from_int(500), OrderSide.BUY)
+        assert book.pprint(10) == expected.pprint(10)
+
+    def test_depth10_book_keeps_mode_after_incremental_update(self):
+        # Arrange
+        depth = TestDataStubs.order_book_depth10()
+        book = OrderBook.depth10(depth.instrument_id)
+        book.apply_depth(depth)
+        bid = BookOrder(
+            side=OrderSide.BUY,
+            price=Price.from_str("99.50"),
+            size=Quantity.from_int(75),
+            order_id=0,
+        )
+
+        # Act
+        book.add(bid, ts_event=1)
+        book.apply_depth(depth)
+
+        # Assert
+        assert book.is_fixed_depth
+        assert book.best_bid_size() == depth.bids[0].size
+
+    @pytest.mark.parametrize(
+        "spill",
+        [False, True],
+    )
+    def test_depth10_book_snapshot_and_pickle_keep_mode(self, spill: bool):
+        # Arrange
+        depth = TestDataStubs.order_book_depth10()
+        book = OrderBook.depth10(depth.instrument_id)
+        book.apply_depth(depth)
+        if spill:
+            bid = BookOrder(
+                side=OrderSide.BUY,
+                price=Price.from_str("99.50"),
+                size=Quantity.from_int(75),
+                order_id=0,
+            )
+            book.add(bid, ts_event=1)
+
+        # Act
+        restored = OrderBook.from_snapshot_bytes(book.to_snapshot_bytes())
+        unpickled = pickle.loads(pickle.dumps(book))
+
+        # Assert
+        assert restored.is_fixed_depth
+        assert unpickled.is_fixed_depth
+        assert restored.pprint(10) == book.pprint(10)
+        assert unpickled.pprint(10) == book.pprint(10)
+
     def make_sample_book(self):
         return TestDataStubs.make_book(
             instrument=self.instrument,
@@ -178,6 +318,35 @@ class TestOrderBook:
         # Act, Assert
         assert book.spread() is None
 
+    def test_top_of_book_handle_reads_published_top_of_book(self):
+        # Arrange
+        book = self.make_sample_book()
+        handle = book.top_of_book_handle()
+
+        # Act
+        book.add(
+            BookOrder(
+                price=Price.from_str("0.84000"),
+                size=Quantity.from_int(3),
+                side=OrderSide.BUY,
+                order_id=100,
+            ),
+            0,
+            0,
+            book.sequence + 1,
+        )
+        top = handle.read()
+        del book
+
+        # Assert
+        assert top[:4] == (
+            Price.from_str("0.84000"),
+            Quantity.from_int(3),
+            Price.from_str("0.88600"),
+            Quantity.from_int(5),
+        )
+        assert handle.read() == top
+
     @pytest.mark.parametrize(
         "order_side",
         [
@@ -512,6 +681,102 @@ class TestOrderBook:
         # Assert
         assert self.empty_book.best_ask_price() == Price(0.5814, 4)
 
+    def test_apply_deltas_from_capsule(self):
+        # Arrange
+        deltas = [
+            OrderBookDelta(
+                instrument_id=TestIdStubs.audusd_id(),
+                action=BookAction.ADD,
+                order=BookOrder(side, Price(price, 4), Quantity(100.0, 2), order_id),
+                flags=0,
+                sequence=order_id,
+                ts_event=order_id,
+                ts_init=order_id,
+            )
+            for side, price, order_id in [
+                (OrderSide.BUY, 0.5812, 1),
+                (OrderSide.BUY, 0.5811, 2),
+                (OrderSide.SELL, 0.5814, 3),
+            ]
+        ]
+        capsule = OrderBookDelta.capsule_from_list(deltas)
+
+        # Act
+        self.empty_book.apply_deltas_from_capsule(capsule)
+
+        # Assert
+        assert self.empty_book.best_bid_price() == Price(0.5812, 4)
+        assert self.empty_book.best_ask_price() == Price(0.5814, 4)
+        assert self.empty_book.sequence == 3
+        assert self.empty_book.count == 3
+
+    def test_sequenced_deltas_reorder_and_detect_gaps(self):
+        # Arrange
+        self.empty_book.enable_sequencing(1)
+        deltas = [
+            OrderBookDelta(
+                instrument_id=TestIdStubs.audusd_id(),
+                action=BookAction.ADD,
+                order=BookOrder(OrderSide.BUY, Price(price, 4), Quantity(100.0, 2), sequence),
+                flags=0,
+                sequence=sequence,
+                ts_event=sequence,
+                ts_init=sequence,
+            )
+            for price, sequence in [
+                (0.5810, 1),
+                (0.5812, 3),
+                (0.5811, 2),
+                (0.5815, 5),
+                (0.5816, 6),
+            ]
+        ]
+
+        # Act
+        for delta in deltas[:3]:
+            self.empty_book.apply_delta(delta)
+        reordered_sequence = self.empty_book.sequence
+        for delta in deltas[3:]:
+            self.empty_book.apply_delta(delta)
+
+        # Assert
+        assert reordered_sequence == 3
+        assert self.empty_book.sequence == 6
+        assert self.empty_book.sequence_gaps == 1
+        assert self.empty_book.sequence_dropped == 0
+        assert self.empty_book.sequence_pending == 0
+        assert self.empty_book.is_stale
+        assert self.empty_book.best_bid_price() == Price(0.5816, 4)
+
+    def test_bids_and_asks_depth(self):
+        # Arrange, Act
+        bid_prices, bid_sizes, bid_counts = self.sample_book.bids_depth(10)
+        ask_prices, ask_sizes, ask_counts = self.sample_book.asks_depth(2)
+
+        # Assert
+        assert bid_prices.tolist() == [Price(0.83, 5).raw, Price(0.82, 5).raw]
+        assert bid_sizes.tolist() == [Quantity(4.0, 0).raw, Quantity(1.0, 0).raw]
+        assert bid_counts.tolist() == [1, 1]
+        assert ask_prices.tolist() == [Price(0.886, 5).raw, Price(0.887, 5).raw]
+        assert ask_sizes.tolist() == [Quantity(5.0, 0).raw, Quantity(10.0, 0).raw]
+        assert ask_counts.tolist() == [1, 1]
+
+    def test_bids_depth_into_reused_buffers(self):
+        # Arrange
+        prices = np.zeros(1, dtype=np.int64)
+        sizes = np.zeros(1, dtype=np.uint64)
+        counts = np.zeros(1, dtype=np.uint32)
+
+        # Act
+        written = self.sample_book.bids_depth_into(prices, sizes, counts)
+
+        # Assert
+        assert written == 1
+        assert prices[0] == Price(0.83, 5).raw
+        assert sizes[0] == Quantity(4.0, 0).raw
+        assert counts[0] == 1
+        assert self.empty_book.asks_depth_into(prices, sizes, counts) == 0
+
     def test_orderbook_midpoint(self):
         assert self.sample_book.midpoint() == pytest.approx(0.858)
 
@@ -524,6 +789,23 @@ class TestOrderBook:
         assert bid_price == 0.88600
         assert ask_price == 0.82800
 
+    def test_l3_get_avg_px_and_quantity_with_cumulative_depth(self):
+        # Arrange
+        self.sample_book.enable_cumulative_depth()
+
+        # Act
+        bid_price = self.sample_book.get_avg_px_for_quantity(Quantity(5.0, 0), 1)
+        ask_price = self.sample_book.get_avg_px_for_quantity(Quantity(12.0, 0), 2)
+        bid_quantity = self.sample_book.get_quantity_for_price(Price(0.88700, 5), OrderSide.BUY)
+        ask_quantity = self.sample_book.get_quantity_for_price(Price(0.82000, 5), OrderSide.SELL)
+
+        # Assert
+        assert self.sample_book.has_cumulative_depth
+        assert bid_price == 0.88600
+        assert ask_price == 0.82800
+        assert bid_quantity == 15.0
+        assert ask_quantity == 5.0
+
     @pytest.mark.parametrize(
         ("is_buy", "price", "expected"),
         [
@@ -708,6 +990,41 @@ class TestOrderBook:
         assert book.best_bid_price() == Price.from_str("4810.00")
         assert book.best_ask_price() == Price.from_str("4810.25")
 
+    def test_orderbook_esh4_glbx_20231224_mbo_l3_tick_indexed(self) -> None:
+        # Arrange
+        loader = DatabentoDataLoader()
+        instrument = TestInstrumentProvider.es_future(expiry_year=2024, expiry_month=3)
+
+        path = TEST_DATA_DIR / "databento" / "esh4-glbx-mdp3-20231224.mbo.dbn.zst"
+        data = loader.from_dbn_file(
+            path,
+            instrument_id=instrument.id,
+            as_legacy_cython=True,
+        )
+
+        tree_book = OrderBook(instrument.id, BookType.L3_MBO)
+        tick_book = OrderBook(
+            instrument.id,
+            BookType.L3_MBO,
+            price_increment=instrument.price_increment,
+        )
+
+        # Act
+        for delta in data:
+            tree_book.apply_delta(delta)
+            tick_book.apply_delta(delta)
+
+        # Assert
+        assert [level.price for level in tick_book.bids()] == [
+            level.price for level in tree_book.bids()
+        ]
+        assert [level.price for level in tick_book.asks()] == [
+            level.price for level in tree_book.asks()
+        ]
+        assert tick_book.best_bid_price() == tree_book.best_bid_price()
+        assert tick_book.best_ask_price() == tree_book.best_ask_price()
+        assert pickle.loads(pickle.dumps(tick_book)).best_bid_price() == tick_book.best_bid_price()
+
     @pytest.mark.parametrize(
         ("book_type"),
         [
@@ -792,3 +1109,85 @@ class TestOrderBook:
         trade = TestDataStubs.trade_tick(self.instrument)
         with pytest.raises(RuntimeError):
             book.update_trade_tick(trade)
+
+
+class TestBookManager:
+    def setup(self):
+        self.instrument_id = TestIdStubs.audusd_id()
+
+    def make_delta(self, side: OrderSide, price: float, size: float, sequence: int):
+        order = BookOrder(
+            price=Price(price, 5),
+            size=Quantity(size, 0),
+            side=side,
+            order_id=sequence,
+        )
+        return TestDataStubs.order_book_delta(
+            instrument_id=self.instrument_id,
+            action=BookAction.ADD,
+            order=order,
+            sequence=sequence,
+        )
+
+    def test_apply_creates_book_and_publishes_top_of_book(self):
+        # Arrange
+        manager = BookManager(num_workers=2, book_type=BookType.L2_MBP)
+        data = [
+            self.make_delta(OrderSide.BUY, 1.00000, 10, 1),
+            self.make_delta(OrderSide.SELL, 1.00010, 20, 2),
+        ]
+
+        # Act
+        manager.apply(data)
+        manager.flush()
+
+        # Assert
+        assert manager.count == 1
+        assert manager.has_book(self.instrument_id)
+        assert manager.top_of_book(self.instrument_id) == (
+            Price.from_str("1.00000"),
+            Quantity.from_int(10),
+            Price.from_str("1.00010"),
+            Quantity.from_int(20),
+            2,
+        )
+
+    def test_snapshot_returns_copy_of_book(self):
+        # Arrange
+        manager = BookManager(num_workers=1, book_type=BookType.L2_MBP)
+        manager.apply([self.make_delta(OrderSide.BUY, 1.00000, 10, 1)])
+
+        # Act
+        book = manager.snapshot(self.instrument_id)
+
+        # Assert
+        assert book.instrument_id == self.instrument_id
+        assert book.best_bid_price() == Price.from_str("1.00000")
+        assert book.sequence == 1
+
+    def test_add_book_replaces_existing_book(self):
+        # Arrange
+        manager = BookManager(num_workers=1, book_type=BookType.L2_MBP)
+        book = OrderBook(self.instrument_id, BookType.L2_MBP)
+        book.apply_delta(self.make_delta(OrderSide.SELL, 1.00020, 5, 7))
+
+        # Act
+        manager.add_book(book)
+        manager.flush()
+
+        # Assert
+        assert manager.snapshot(self.instrument_id).best_ask_price() == Price.from_str("1.00020")
+
+    def test_unknown_instrument_returns_none(self):
+        # Arrange
+        manager = BookManager(num_workers=1, book_type=BookType.L2_MBP)
+
+        # Act, Assert
+        assert not manager.has_book(self.instrument_id)
+        assert manager.top_of_book(self.instrument_id) is None
+        assert manager.snapshot(self.instrument_id) is None
+
+    def test_zero_workers_raises_value_error(self):
+        # Act, Assert
+        with pytest.raises(ValueError):
+            BookManager(num_workers=0, book_type=BookType.L2_MBP)